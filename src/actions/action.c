@@ -0,0 +1,301 @@
+// action.c
+// Legal action generation, validation and application (see action.h)
+#include "action.h"
+#include "action_trace.h"
+#include "../core/card_actions.h"
+#include "../core/game_constants.h"
+#include "../structures/card_bitset.h"
+
+static uint8_t card_class_table[FULL_DECK_SIZE];
+
+static bool same_gameplay_stats(const struct card* a, const struct card* b)
+{ return a->card_type == b->card_type && a->cost == b->cost &&
+         a->defense_dice == b->defense_dice && a->attack_base == b->attack_base &&
+         a->color == b->color && a->species == b->species && a->order == b->order &&
+         a->draw_num == b->draw_num && a->choose_num == b->choose_num &&
+         a->exchange_cash == b->exchange_cash;
+}
+
+void actions_init(void)
+{ for(uint8_t i = 0; i < FULL_DECK_SIZE; i++)
+  { card_class_table[i] = i;
+    for(uint8_t j = 0; j < i; j++)
+    { if(card_class_table[j] == j && same_gameplay_stats(&fullDeck[i], &fullDeck[j]))
+      { card_class_table[i] = j;
+        break;
+      }
+    }
+  }
+} // actions_init
+
+uint8_t card_class(uint8_t card_idx)
+{ return card_class_table[card_idx];
+}
+
+static void push_action(ActionList* list, Action action)
+{ if(list->count >= MAX_LEGAL_ACTIONS)
+  { list->overflow = true;
+    return;
+  }
+  list->actions[list->count++] = action;
+}
+
+// Sort card indices by (class, index), so equivalent cards are adjacent
+static void sort_by_class(uint8_t* cards, uint8_t n)
+{ for(uint8_t i = 1; i < n; i++)
+  { uint8_t c = cards[i];
+    uint16_t key = (uint16_t)(card_class_table[c] << 8 | c);
+    int j = i - 1;
+    while(j >= 0 && (uint16_t)(card_class_table[cards[j]] << 8 | cards[j]) > key)
+    { cards[j + 1] = cards[j];
+      j--;
+    }
+    cards[j + 1] = c;
+  }
+}
+
+// In distinct mode a card is skipped when an equivalent card was already
+// tried at the same position of the subset (multiset combinations)
+static inline bool skip_equivalent(const uint8_t* cards, uint8_t pos, uint8_t first, bool distinct)
+{ return distinct && pos > first && card_class_table[cards[pos]] == card_class_table[cards[pos - 1]];
+}
+
+static void push_recall_actions(ActionList* list, uint8_t card, uint8_t recall_num,
+                                const uint8_t* champions, uint8_t n, bool distinct)
+{ if(recall_num < 1 || recall_num > 3 || n < recall_num) return;
+
+  // recall_num nested choices, as an index odometer over the sorted champions
+  uint8_t idx[3];
+  int depth = 0;
+  idx[0] = 0;
+  while(depth >= 0)
+  { uint8_t first = depth == 0 ? 0 : idx[depth - 1] + 1;
+    if(idx[depth] > n - (recall_num - depth))
+    { depth--;
+      if(depth >= 0) idx[depth]++;
+      continue;
+    }
+    if(skip_equivalent(champions, idx[depth], first, distinct))
+    { idx[depth]++;
+      continue;
+    }
+    if(depth + 1 < recall_num)
+    { depth++;
+      idx[depth] = idx[depth - 1] + 1;
+      continue;
+    }
+
+    Action action = {ACTION_RECALL, card, recall_num, {0}};
+    for(uint8_t k = 0; k < recall_num; k++)
+      action.cards[k] = champions[idx[k]];
+    push_action(list, action);
+    idx[depth]++;
+  }
+} // push_recall_actions
+
+void generate_legal_actions(const struct gamestate* gstate, PlayerID player, ActionList* list)
+{ list->count = 0;
+  list->num_single = 0;
+  list->overflow = false;
+  if(gstate->game_state != ACTIVE) return;
+
+  const Hand* hand = &gstate->hand[player];
+  uint16_t cash = gstate->current_cash_balance[player];
+  bool attack = player == gstate->current_player;
+  bool distinct = list->options & ACTIONS_DISTINCT;
+
+  push_action(list, (Action){ACTION_PASS, 0, 0, {0}});
+
+  uint8_t champions[sizeof(hand->cards)];
+  uint8_t num_champions = collect_champions(hand->cards, hand->size, champions, false);
+  sort_by_class(champions, num_champions);
+
+  // One card from the hand, in hand order
+  CardBitset seen;
+  CardBitset_clear(&seen);
+  for(uint8_t i = 0; i < hand->size; i++)
+  { uint8_t c = hand->cards[i];
+    const struct card* card = &fullDeck[c];
+    if(card->cost > cash) continue;
+    if(distinct)
+    { if(CardBitset_contains(&seen, card_class_table[c])) continue;
+      CardBitset_add(&seen, card_class_table[c]);
+    }
+
+    if(card->card_type == CHAMPION_CARD)
+      push_action(list, (Action){ACTION_CHAMPIONS, 0, 1, {c}});
+    else if(!attack)
+      continue;
+    else if(card->card_type == DRAW_CARD)
+      push_action(list, (Action){ACTION_DRAW, c, 0, {0}});
+    else if(card->card_type == CASH_CARD && num_champions > 0)
+    { if(list->options & ACTIONS_AUTO_EXCHANGE)
+        push_action(list, (Action){ACTION_CASH, c, 0, {0}});
+      else
+      { for(uint8_t h = 0; h < num_champions; h++)
+        { if(!skip_equivalent(champions, h, 0, distinct))
+            push_action(list, (Action){ACTION_CASH, c, 1, {champions[h]}});
+        }
+      }
+    }
+  }
+  list->num_single = list->count - 1;
+  if(list->options & ACTIONS_SINGLES_ONLY) return;
+
+  // Two or three champions
+  for(uint8_t i = 0; i < num_champions; i++)
+  { if(skip_equivalent(champions, i, 0, distinct)) continue;
+    uint16_t cost_i = fullDeck[champions[i]].cost;
+    if(cost_i > cash) continue;
+
+    for(uint8_t j = i + 1; j < num_champions; j++)
+    { if(skip_equivalent(champions, j, i + 1, distinct)) continue;
+      uint16_t cost_ij = cost_i + fullDeck[champions[j]].cost;
+      if(cost_ij > cash) continue;
+      push_action(list, (Action){ACTION_CHAMPIONS, 0, 2, {champions[i], champions[j]}});
+
+      for(uint8_t k = j + 1; k < num_champions; k++)
+      { if(skip_equivalent(champions, k, j + 1, distinct)) continue;
+        if(cost_ij + fullDeck[champions[k]].cost <= cash)
+          push_action(list, (Action){ACTION_CHAMPIONS, 0, 3,
+                                     {champions[i], champions[j], champions[k]}});
+      }
+    }
+  }
+
+  // Draw/recall cards played to take back champions from the discard
+  if(!attack || (list->options & ACTIONS_NO_RECALL)) return;
+
+  const Discard* discard = &gstate->discard[player];
+  uint8_t recallable[sizeof(discard->cards)];
+  uint8_t num_recallable = collect_champions(discard->cards, discard->size, recallable, false);
+  sort_by_class(recallable, num_recallable);
+
+  CardBitset_clear(&seen);
+  for(uint8_t i = 0; i < hand->size; i++)
+  { uint8_t c = hand->cards[i];
+    const struct card* card = &fullDeck[c];
+    if(card->card_type != DRAW_CARD || card->cost > cash) continue;
+    if(distinct)
+    { if(CardBitset_contains(&seen, card_class_table[c])) continue;
+      CardBitset_add(&seen, card_class_table[c]);
+    }
+    push_recall_actions(list, c, card->choose_num, recallable, num_recallable, distinct);
+  }
+} // generate_legal_actions
+
+static bool in_hand(const struct gamestate* gstate, PlayerID player, uint8_t card)
+{ return card < FULL_DECK_SIZE && Hand_contains(&gstate->hand[player], card);
+}
+
+static bool has_duplicates(const uint8_t* cards, uint8_t n)
+{ for(uint8_t i = 0; i < n; i++)
+  { for(uint8_t j = i + 1; j < n; j++)
+    { if(cards[i] == cards[j]) return true;
+    }
+  }
+  return false;
+}
+
+ActionError validate_action(const struct gamestate* gstate, PlayerID player, const Action* action)
+{ if(gstate->game_state != ACTIVE) return ACTION_ERR_GAME_OVER;
+  if(action->type >= ACTION_TYPE_COUNT) return ACTION_ERR_TYPE;
+  if(action->type != ACTION_PASS && action->type != ACTION_CHAMPIONS &&
+     player != gstate->current_player)
+    return ACTION_ERR_TYPE;
+
+  uint16_t cash = gstate->current_cash_balance[player];
+
+  switch(action->type)
+  { case ACTION_PASS:
+      return action->num_cards == 0 ? ACTION_OK : ACTION_ERR_CARD_COUNT;
+
+    case ACTION_CHAMPIONS:
+    { if(action->num_cards < 1 || action->num_cards > 3) return ACTION_ERR_CARD_COUNT;
+      if(has_duplicates(action->cards, action->num_cards)) return ACTION_ERR_DUPLICATE;
+      uint16_t cost = 0;
+      for(uint8_t i = 0; i < action->num_cards; i++)
+      { if(!in_hand(gstate, player, action->cards[i])) return ACTION_ERR_NOT_IN_HAND;
+        if(fullDeck[action->cards[i]].card_type != CHAMPION_CARD) return ACTION_ERR_CARD_TYPE;
+        cost += fullDeck[action->cards[i]].cost;
+      }
+      return cost <= cash ? ACTION_OK : ACTION_ERR_COST;
+    }
+
+    case ACTION_DRAW:
+    case ACTION_RECALL:
+    { if(!in_hand(gstate, player, action->card)) return ACTION_ERR_NOT_IN_HAND;
+      const struct card* card = &fullDeck[action->card];
+      if(card->card_type != DRAW_CARD) return ACTION_ERR_CARD_TYPE;
+      if(card->cost > cash) return ACTION_ERR_COST;
+      if(action->type == ACTION_DRAW)
+        return action->num_cards == 0 ? ACTION_OK : ACTION_ERR_CARD_COUNT;
+
+      // Recall is exact: choose_num champions, no fewer
+      if(action->num_cards != card->choose_num) return ACTION_ERR_CARD_COUNT;
+      if(has_duplicates(action->cards, action->num_cards)) return ACTION_ERR_DUPLICATE;
+      for(uint8_t i = 0; i < action->num_cards; i++)
+      { uint8_t c = action->cards[i];
+        if(c >= FULL_DECK_SIZE || !Discard_contains(&gstate->discard[player], c))
+          return ACTION_ERR_NOT_IN_DISCARD;
+        if(fullDeck[c].card_type != CHAMPION_CARD) return ACTION_ERR_CARD_TYPE;
+      }
+      return ACTION_OK;
+    }
+
+    case ACTION_CASH:
+    { if(!in_hand(gstate, player, action->card)) return ACTION_ERR_NOT_IN_HAND;
+      if(fullDeck[action->card].card_type != CASH_CARD) return ACTION_ERR_CARD_TYPE;
+      if(fullDeck[action->card].cost > cash) return ACTION_ERR_COST;
+      if(action->num_cards > 1) return ACTION_ERR_CARD_COUNT;
+      if(action->num_cards == 0)
+        return has_champion_in_hand((Hand*)&gstate->hand[player]) ?
+               ACTION_OK : ACTION_ERR_CARD_COUNT;
+      if(!in_hand(gstate, player, action->cards[0])) return ACTION_ERR_NOT_IN_HAND;
+      return fullDeck[action->cards[0]].card_type == CHAMPION_CARD ?
+             ACTION_OK : ACTION_ERR_CARD_TYPE;
+    }
+
+    default:
+      return ACTION_ERR_TYPE;
+  }
+} // validate_action
+
+void apply_action(struct gamestate* gstate, PlayerID player, const Action* action,
+                  GameContext* ctx)
+{ if(ctx->game_ctx != NULL && gstate == ctx->game)
+    ctx = ctx->game_ctx;
+  if(ctx->action_trace != NULL)
+    action_trace_add(ctx->action_trace, gstate, action);
+
+  switch(action->type)
+  { case ACTION_CHAMPIONS:
+      for(uint8_t i = 0; i < action->num_cards; i++)
+        play_champion(gstate, player, action->cards[i], ctx);
+      break;
+    case ACTION_DRAW:
+      play_draw_card(gstate, player, action->card, ctx);
+      break;
+    case ACTION_RECALL:
+      play_recall_card(gstate, player, action->card, action->cards, action->num_cards, ctx);
+      break;
+    case ACTION_CASH:
+      if(action->num_cards == 0)
+        play_cash_card_ai(gstate, player, action->card, ctx);
+      else
+        play_cash_card_interactive(gstate, player, action->card, action->cards[0], ctx);
+      break;
+    default:
+      break;
+  }
+} // apply_action
+
+uint64_t action_key(const Action* action)
+{ uint64_t key = (uint64_t)action->type | (uint64_t)action->num_cards << 3;
+
+  if(action->type != ACTION_PASS && action->type != ACTION_CHAMPIONS)
+    key |= (uint64_t)card_class_table[action->card] << 5;
+  for(uint8_t i = 0; i < action->num_cards; i++)
+    key |= (uint64_t)card_class_table[action->cards[i]] << (12 + 7 * i);
+  return key;
+}
@@ -0,0 +1,94 @@
+// action.h
+// Engine action API: one compact Action per legal choice of the player to move,
+// legal move generation into a caller-provided buffer, validation and
+// application. Shared by the AI strategies, the search agents and the CLI.
+
+#ifndef ACTION_H
+#define ACTION_H
+
+#include "../core/game_types.h"
+#include "../core/game_context.h"
+
+// Upper bound on generated actions. Without recall (ACTIONS_NO_RECALL) the
+// worst case is 1-3 champion subsets of a 12-card hand (298) plus draw and
+// cash cards, far below it; recall choices over a large discard can exceed it
+// (see ActionList.overflow).
+#define MAX_LEGAL_ACTIONS 1024
+
+typedef enum
+{ ACTION_PASS = 0,       // attack: pass; defense: decline to defend
+  ACTION_CHAMPIONS,      // play 1-3 champions into the combat zone
+  ACTION_DRAW,           // play a draw/recall card for its draw
+  ACTION_RECALL,         // play a draw/recall card to take back champions from discard
+  ACTION_CASH,           // play a cash card, exchanging a champion from hand
+  ACTION_TYPE_COUNT
+} ActionType;
+
+typedef struct
+{ uint8_t type;          // ActionType
+  uint8_t card;          // draw/recall or cash card played (fullDeck index)
+  uint8_t num_cards;     // entries used in cards[]
+  uint8_t cards[3];      // ACTION_CHAMPIONS: champions played from hand
+                         // ACTION_RECALL: champions taken back from discard
+                         // ACTION_CASH: champion exchanged (none: lowest power)
+} Action;
+
+// Generation options (ActionList.options)
+#define ACTIONS_ALL            0x00  // every legal action
+#define ACTIONS_DISTINCT       0x01  // one action per set of equivalent cards
+#define ACTIONS_NO_RECALL      0x02  // draw/recall cards are only played to draw
+#define ACTIONS_AUTO_EXCHANGE  0x04  // one cash action per card, lowest-power champion
+#define ACTIONS_SINGLES_ONLY   0x08  // stop after pass and the single-card actions
+
+typedef struct
+{ uint8_t options;       // ACTIONS_* flags, set by the caller
+  bool overflow;         // more than MAX_LEGAL_ACTIONS legal actions: list cut short
+  uint16_t count;
+  uint16_t num_single;   // leading actions that play exactly one hand card, in hand order
+  Action actions[MAX_LEGAL_ACTIONS];
+} ActionList;
+
+// Why validate_action() rejected an action
+typedef enum
+{ ACTION_OK = 0,
+  ACTION_ERR_GAME_OVER,      // the game has ended
+  ACTION_ERR_TYPE,           // unknown type, or an attack-only action by the defender
+  ACTION_ERR_CARD_COUNT,     // wrong number of cards for the action
+  ACTION_ERR_NOT_IN_HAND,    // a card to play or exchange is not in the hand
+  ACTION_ERR_NOT_IN_DISCARD, // a champion to recall is not in the discard
+  ACTION_ERR_DUPLICATE,      // the same card appears twice
+  ACTION_ERR_CARD_TYPE,      // e.g. a draw card offered as a champion
+  ACTION_ERR_COST            // not enough lunas
+} ActionError;
+
+// Card equivalence classes: cards with the same gameplay stats (type, cost,
+// dice, color, species, order, draw/recall and exchange values) share a class,
+// numbered by the class's lowest fullDeck index. actions_init() must run once
+// at startup (main() does it; tests call it themselves).
+void actions_init(void);
+uint8_t card_class(uint8_t card_idx);
+
+// The attacker is gstate->current_player; the other player can only defend
+// (pass or champions). This holds whether or not the caller has switched
+// gstate->turn_phase to DEFENSE yet.
+//
+// Legal actions of `player`, filtered by list->options.
+// Order: pass, then from index 1 the actions playing one card from the hand,
+// in hand order (list->num_single of them: the random strategy's choices),
+// then the 2-3 champion subsets, then the recall actions. Champions within an
+// action are sorted by class, so equivalent actions get the same action_key().
+void generate_legal_actions(const struct gamestate* gstate, PlayerID player, ActionList* list);
+
+// Checks the action against the rules for `player`; whose decision it is
+// stays the caller's business
+ActionError validate_action(const struct gamestate* gstate, PlayerID player, const Action* action);
+
+// Put the action's cards into play for `player` (turn flow is the caller's)
+void apply_action(struct gamestate* gstate, PlayerID player, const Action* action,
+                  GameContext* ctx);
+
+// Identifies a generated action up to card equivalence: equivalent actions
+// (from any hand or determinization) share a key
+uint64_t action_key(const Action* action);
+
+#endif // ACTION_H
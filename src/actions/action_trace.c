@@ -0,0 +1,141 @@
+// action_trace.c
+// Action log recording, encoding and replay (see action_trace.h)
+
+#include <stdio.h>
+
+#include "action_trace.h"
+
+void action_trace_record(ActionTrace* trace, uint8_t* bytes, uint32_t capacity)
+{ trace->mode = ACTION_TRACE_RECORD;
+  trace->bytes = bytes;
+  trace->input = NULL;
+  trace->capacity = capacity;
+  action_trace_start(trace, NULL);
+}
+
+void action_trace_replay(ActionTrace* trace, const uint8_t* input, uint32_t length)
+{ trace->mode = ACTION_TRACE_REPLAY;
+  trace->bytes = NULL;
+  trace->input = input;
+  trace->capacity = length;
+  action_trace_start(trace, NULL);
+}
+
+void action_trace_start(ActionTrace* trace, const struct gamestate* gstate)
+{ trace->gstate = gstate;
+  trace->failed = false;
+  trace->length = 0;
+  trace->phase = 0;
+  trace->pending = 0;
+}
+
+void action_trace_begin_phase(ActionTrace* trace, const struct gamestate* gstate)
+{ if(gstate != trace->gstate || trace->failed) return;
+
+  if(trace->length >= trace->capacity)
+  { trace->failed = true;
+    trace->pending = 0;
+    return;
+  }
+  if(trace->mode == ACTION_TRACE_REPLAY)
+    trace->pending = trace->input[trace->length++];
+  else
+  { trace->phase = trace->length;
+    trace->bytes[trace->length++] = 0;
+  }
+} // action_trace_begin_phase
+
+void action_trace_add(ActionTrace* trace, const struct gamestate* gstate, const Action* action)
+{ if(gstate != trace->gstate || trace->failed || trace->mode != ACTION_TRACE_RECORD) return;
+
+  if(trace->length + ACTION_TRACE_MAX_ACTION_BYTES > trace->capacity ||
+     trace->bytes[trace->phase] == UINT8_MAX)
+  { trace->failed = true;
+    return;
+  }
+  trace->length += action_encode(action, &trace->bytes[trace->length]);
+  trace->bytes[trace->phase]++;
+} // action_trace_add
+
+// The trace of the game ctx plays: an agent's context hands over to the game's
+static ActionTrace* trace_of(GameContext* ctx)
+{ return (ctx->game_ctx != NULL ? ctx->game_ctx : ctx)->action_trace;
+}
+
+static void replay_phase(struct gamestate* gstate, GameContext* ctx)
+{ ActionTrace* trace = trace_of(ctx);
+  if(trace == NULL || trace->mode != ACTION_TRACE_REPLAY || gstate != trace->gstate) return;
+
+  while(trace->pending > 0 && !trace->failed)
+  { Action action;
+    uint32_t used = action_decode(&trace->input[trace->length], trace->capacity - trace->length,
+                                  &action);
+    if(used == 0 || validate_action(gstate, gstate->player_to_move, &action) != ACTION_OK)
+    { trace->failed = true;
+      break;
+    }
+    trace->length += used;
+    trace->pending--;
+    apply_action(gstate, gstate->player_to_move, &action, ctx);
+  }
+} // replay_phase
+
+void action_trace_attack_strategy(struct gamestate* gstate, GameContext* ctx)
+{ replay_phase(gstate, ctx);
+}
+
+void action_trace_defense_strategy(struct gamestate* gstate, GameContext* ctx)
+{ replay_phase(gstate, ctx);
+}
+
+// Byte 0: type in the low nibble, number of cards in the high one; then the
+// card played for draw, recall and cash actions; then the cards
+static bool has_card(uint8_t type)
+{ return type == ACTION_DRAW || type == ACTION_RECALL || type == ACTION_CASH;
+}
+
+uint32_t action_encode(const Action* action, uint8_t* out)
+{ uint32_t n = 0;
+  out[n++] = (uint8_t)(action->type | action->num_cards << 4);
+  if(has_card(action->type))
+    out[n++] = action->card;
+  for(uint8_t i = 0; i < action->num_cards; i++)
+    out[n++] = action->cards[i];
+  return n;
+}
+
+uint32_t action_decode(const uint8_t* in, uint32_t available, Action* action)
+{ if(available == 0) return 0;
+
+  action->type = in[0] & 0x0f;
+  action->num_cards = in[0] >> 4;
+  action->card = 0;
+  if(action->type >= ACTION_TYPE_COUNT || action->num_cards > 3) return 0;
+
+  uint32_t n = 1 + has_card(action->type) + action->num_cards;
+  if(n > available) return 0;
+
+  uint32_t i = 1;
+  if(has_card(action->type))
+    action->card = in[i++];
+  for(uint8_t c = 0; c < action->num_cards; c++)
+    action->cards[c] = in[i++];
+  return n;
+} // action_decode
+
+void action_format(const Action* action, char* buf, size_t size)
+{ static const char* const names[ACTION_TYPE_COUNT] =
+    {"pass", "champions", "draw", "recall", "cash"};
+  if(action->type >= ACTION_TYPE_COUNT)
+  { snprintf(buf, size, "?");
+    return;
+  }
+
+  int n = snprintf(buf, size, "%s", names[action->type]);
+  if(has_card(action->type) && n >= 0 && (size_t)n < size)
+    n += snprintf(buf + n, size - n, " %u", action->card);
+  for(uint8_t i = 0; i < action->num_cards && n >= 0 && (size_t)n < size; i++)
+    n += snprintf(buf + n, size - n, "%s%u%s",
+                  (has_card(action->type) && i == 0) ? " (" : " ", action->cards[i],
+                  (has_card(action->type) && i + 1 == action->num_cards) ? ")" : "");
+} // action_format
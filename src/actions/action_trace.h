@@ -0,0 +1,65 @@
+// action_trace.h
+// Compact log of the actions played in one game, and its replay. Each
+// decision phase (attack, then defense when there is combat) is one count
+// byte, the number of actions applied in it, followed by those actions in
+// 1 to ACTION_TRACE_MAX_ACTION_BYTES bytes each. With the chance events
+// replayed from the same seed, applying the logged actions rebuilds the game
+// without running the agents.
+
+#ifndef ACTION_TRACE_H
+#define ACTION_TRACE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "action.h"
+
+#define ACTION_TRACE_MAX_ACTION_BYTES 5   // type and count, card, 3 cards
+
+typedef enum
+{ ACTION_TRACE_RECORD = 0,
+  ACTION_TRACE_REPLAY
+} ActionTraceMode;
+
+// Hooked to a game through GameContext.action_trace. Only actions applied to
+// the traced state count: an agent's search on copies of it leaves no trace.
+typedef struct ActionTrace
+{ uint8_t mode;                    // ActionTraceMode
+  bool failed;                     // record: out of room; replay: log ended or an action was illegal
+  const struct gamestate* gstate;  // the traced game (NULL between games)
+  uint8_t* bytes;                  // record: written here
+  const uint8_t* input;            // replay: read from here
+  uint32_t capacity;               // record: room in bytes; replay: log length
+  uint32_t length;                 // bytes written or read so far
+  uint32_t phase;                  // record: offset of the current phase's count byte
+  uint8_t pending;                 // replay: actions left in the current phase
+} ActionTrace;
+
+// Set the trace to record into bytes, or to replay the log in input; the
+// game itself is attached by action_trace_start
+void action_trace_record(ActionTrace* trace, uint8_t* bytes, uint32_t capacity);
+void action_trace_replay(ActionTrace* trace, const uint8_t* input, uint32_t length);
+// Attach the trace to gstate from its first turn on, or detach it (NULL)
+void action_trace_start(ActionTrace* trace, const struct gamestate* gstate);
+
+// A decision phase of gstate begins (turn_logic), and an action is applied to
+// gstate (apply_action); both ignore any state but the traced one
+void action_trace_begin_phase(ActionTrace* trace, const struct gamestate* gstate);
+void action_trace_add(ActionTrace* trace, const struct gamestate* gstate, const Action* action);
+
+// Strategies that play the logged actions of the phase instead of deciding:
+// each action is validated before it is applied, and a log that runs out or
+// no longer fits the game sets trace->failed and passes
+void action_trace_attack_strategy(struct gamestate* gstate, GameContext* ctx);
+void action_trace_defense_strategy(struct gamestate* gstate, GameContext* ctx);
+
+// Encode into out (ACTION_TRACE_MAX_ACTION_BYTES room), returns the length;
+// decode returns the length read, 0 if the bytes are not an action
+uint32_t action_encode(const Action* action, uint8_t* out);
+uint32_t action_decode(const uint8_t* in, uint32_t available, Action* action);
+
+// "pass", "champions 12 40", "draw 55", "recall 55 (12 40)", "cash 60 (12)"
+void action_format(const Action* action, char* buf, size_t size);
+
+#endif // ACTION_TRACE_H
@@ -1,3 +1,12 @@
+// ai_strat_heuristic1.c
+// Heuristic strategy (strat_heuristic1): one-move look-ahead on the advantage
+// of the design notes below (ai_strat_lib_heuristics.c)
+#include <math.h>
+#include <stddef.h>
+
+#include "ai_strat_heuristic1.h"
+#include "../util/debug.h"
+
 /*
    Heuristic approach to making decisions of which card(s) to play for both attacker and defender. '1 move look-ahead'
    Calculate player's advantage (the heuristic) and make the play / move (among all the possible moves) that maximizes the advantage following the play / move.
@@ -23,3 +32,62 @@
    to the total hand power
 
 */
+
+// One action per playable card class, champion subsets included; recall is
+// left out (its cards are no better than a draw's to the advantage) and a
+// cash card exchanges the lowest-power champion, as the engine's AI does
+#define HEURISTIC_ACTION_OPTIONS (ACTIONS_DISTINCT | ACTIONS_NO_RECALL | ACTIONS_AUTO_EXCHANGE)
+
+const HeuristicParams HEURISTIC_DEFAULT_PARAMS =
+{ HEURISTIC_DEFAULT_EPSILON, HEURISTIC_DEFAULT_GAMMA, HEURISTIC_DEFAULT_OPPONENT_CARDS,
+  HEURISTIC_DEFAULT_WIN_BONUS
+};
+
+bool heuristic_choose_move(const struct gamestate* gstate, const HeuristicParams* params,
+                           Action* best, double* best_advantage)
+{ const PlayerID player = gstate->player_to_move;
+  ActionList moves;
+  moves.options = HEURISTIC_ACTION_OPTIONS;
+  generate_legal_actions(gstate, player, &moves);
+  if(moves.count == 0) return false;
+
+  // The position is scanned once; every move is scored from its delta
+  HeuristicTerms root;
+  heuristic_terms_init(&root, gstate);
+  uint16_t chosen = 0;
+  double max_advantage = -INFINITY;
+  for(uint16_t m = 0; m < moves.count; m++)
+  { double advantage = heuristic_move_advantage(&root, player, &moves.actions[m], params);
+    if(advantage > max_advantage)
+    { max_advantage = advantage;
+      chosen = m;
+    }
+  }
+
+  *best = moves.actions[chosen];
+  if(best_advantage != NULL)
+    *best_advantage = max_advantage;
+  DEBUG_PRINT(" Heuristic: %u moves, best move type %u (advantage %.2f)\n",
+              moves.count, best->type, max_advantage);
+  return true;
+} // heuristic_choose_move
+
+static void heuristic_play(struct gamestate* gstate, GameContext* ctx)
+{ Action best;
+  if(heuristic_choose_move(gstate, &HEURISTIC_DEFAULT_PARAMS, &best, NULL))
+    apply_action(gstate, gstate->player_to_move, &best, ctx);
+}
+
+void heuristic_attack_strategy(struct gamestate* gstate, GameContext* ctx)
+{ heuristic_play(gstate, ctx);
+}
+
+void heuristic_defense_strategy(struct gamestate* gstate, GameContext* ctx)
+{ heuristic_play(gstate, ctx);
+}
+
+void rollout_heuristic(struct gamestate* gstate, const HeuristicParams* params, GameContext* ctx)
+{ Action best;
+  while(!is_terminal(gstate) && heuristic_choose_move(gstate, params, &best, NULL))
+    do_move(gstate, &best, ctx);
+}
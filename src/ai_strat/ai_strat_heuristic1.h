@@ -0,0 +1,27 @@
+// ai_strat_heuristic1.h
+// Heuristic strategy (strat_heuristic1): plays the legal move that leaves the
+// best Energy/Cards/Cash advantage (ai_strat_lib_heuristics.h), one move deep
+
+#ifndef AI_STRAT_HEURISTIC1_H
+#define AI_STRAT_HEURISTIC1_H
+
+#include "../core/game_types.h"
+#include "../core/game_context.h"
+#include "ai_strat_lib_heuristics.h"
+#include "ai_strat_lib_search.h"
+
+extern const HeuristicParams HEURISTIC_DEFAULT_PARAMS;
+
+// Best move of gstate->player_to_move (ties go to the first generated, pass
+// first); false if there is no legal move. best_advantage may be NULL.
+bool heuristic_choose_move(const struct gamestate* gstate, const HeuristicParams* params,
+                           Action* best, double* best_advantage);
+
+// Strategy functions for StrategySet (default parameters)
+void heuristic_attack_strategy(struct gamestate* gstate, GameContext* ctx);
+void heuristic_defense_strategy(struct gamestate* gstate, GameContext* ctx);
+
+// Like rollout_random(), with the heuristic choosing every move
+void rollout_heuristic(struct gamestate* gstate, const HeuristicParams* params, GameContext* ctx);
+
+#endif // AI_STRAT_HEURISTIC1_H
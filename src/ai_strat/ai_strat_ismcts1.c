@@ -1,3 +1,17 @@
+// ai_strat_ismcts1.c
+// Information Set Monte Carlo Tree Search strategy (strat_ismcts1)
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "ai_strat_ismcts1.h"
+#include "../core/game_state.h"
+#include "../util/arena.h"
+#include "../util/debug.h"
+#include "../util/rnd.h"
+
 /*
    Info Set Monte Carlo Tree Search (strat_ismcts1):
         define this strategy as a call to the ISMCTS() function, from the applyAttDefStrat() function
@@ -151,3 +165,359 @@
 
    end of rollOut() function
  * */
+
+/*
+   Implementation notes (single-observer ISMCTS, Cowling, Powley & Whitehouse 2012):
+   - nodes are not malloc'ed one by one and do not store gamestates: every
+     iteration determinizes a fresh clone of the root (Clone_And_Randomize) and
+     replays the tree moves on it with DoMove, so a node is just its move's
+     action_key() and statistics. Keys identify actions up to card
+     equivalence, so equivalent cards dealt differently in two
+     determinizations share a node. Nodes come from a bump arena (ctx->arena) that is reset at the
+     start of each decision -- after the first decisions no allocation happens.
+   - children are a sibling-linked list; a node's move may be legal in some
+     determinizations and not others, so UCB uses the child's availability
+     count instead of the parent's visit count.
+   - the statistics are relaxed atomics and children are published with a
+     compare-and-swap on first_child, so the same code runs one tree per
+     thread (root parallelization) or one tree for all threads (tree
+     parallelization). Visits are counted on the way down and wins on the way
+     up: an iteration in flight looks like a loss to the other threads
+     (virtual loss of 1), and for a serial search this is plain UCT.
+ */
+
+typedef struct ISMCTSNode
+{ struct ISMCTSNode* parent;
+  struct ISMCTSNode* _Atomic first_child;
+  struct ISMCTSNode* next_sibling;  // fixed once the node is linked
+  _Atomic uint32_t visits;          // includes iterations still in flight
+  _Atomic uint32_t avail;           // iterations in which this move was legal
+  _Atomic uint32_t half_wins;       // results for player_just_moved, in half points
+  uint64_t key;                     // action_key() of the move that led here
+  uint8_t player_just_moved;
+} ISMCTSNode;
+
+// One search thread: its own RNG stream and arena, a root that is private
+// (root parallelization) or shared (tree parallelization), and an iteration
+// counter shared with the threads that grow the same tree
+typedef struct
+{ const struct gamestate* root_state;
+  const ISMCTSParams* params;
+  ISMCTSNode* root;
+  GameContext* ctx;
+  _Atomic uint32_t* claimed;   // iterations started on this tree
+  uint32_t budget;             // iterations allowed on this tree
+  struct timespec start;
+  uint32_t iterations;         // out: iterations this thread completed
+  uint32_t nodes;              // out: nodes this thread allocated
+} ISMCTSWorker;
+
+#define LOAD(field) atomic_load_explicit(&(field), memory_order_relaxed)
+#define ADD(field, n) atomic_fetch_add_explicit(&(field), (n), memory_order_relaxed)
+
+static double elapsed_ms_since(const struct timespec* start)
+{ struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (now.tv_sec - start->tv_sec) * 1e3 + (now.tv_nsec - start->tv_nsec) * 1e-6;
+}
+
+ISMCTSParams ismcts_params_from_config(const config_t* cfg)
+{ ISMCTSParams params = {ISMCTS_DEFAULT_ITERATIONS, 0, ISMCTS_DEFAULT_EXPLORATION,
+                         1, AI_PARALLEL_ROOT};
+
+  if(cfg != NULL)
+  { if(cfg->ai_budget > 0) params.iterations = cfg->ai_budget;
+    params.time_limit_ms = cfg->ai_time_ms;
+    if(cfg->ai_threads > 0) params.threads = (uint32_t)cfg->ai_threads;
+    params.parallel = cfg->ai_parallel;
+  }
+  return params;
+}
+
+// Node for `move`, already counting the visit of the iteration creating it;
+// not linked into the tree yet
+static ISMCTSNode* new_node(ISMCTSWorker* w, ISMCTSNode* parent, const Action* move,
+                            uint8_t player_just_moved)
+{ ISMCTSNode* node = (ISMCTSNode*)arena_alloc(w->ctx->arena, sizeof(ISMCTSNode));
+  if(node == NULL) return NULL;
+
+  node->parent = parent;
+  atomic_init(&node->first_child, NULL);
+  node->next_sibling = NULL;
+  atomic_init(&node->visits, 1);
+  atomic_init(&node->avail, 1);
+  atomic_init(&node->half_wins, 0);
+  node->player_just_moved = player_just_moved;
+  node->key = move != NULL ? action_key(move) : 0;
+  w->nodes++;
+  return node;
+}
+
+static ISMCTSNode* find_child(ISMCTSNode* first, const ISMCTSNode* last, uint64_t key)
+{ for(ISMCTSNode* child = first; child != last; child = child->next_sibling)
+  { if(child->key == key) return child;
+  }
+  return NULL;
+}
+
+// Push child onto parent's list. If another thread linked the same move
+// first, that node wins (child stays unused in the arena) and is returned
+// with this iteration's visit added.
+static ISMCTSNode* link_child(ISMCTSNode* parent, ISMCTSNode* child)
+{ ISMCTSNode* head = atomic_load_explicit(&parent->first_child, memory_order_acquire);
+
+  for(;;)
+  { child->next_sibling = head;
+    if(atomic_compare_exchange_weak_explicit(&parent->first_child, &head, child,
+                                             memory_order_release, memory_order_acquire))
+      return child;
+
+    ISMCTSNode* twin = find_child(head, child->next_sibling, child->key);
+    if(twin != NULL)
+    { ADD(twin->visits, 1);
+      ADD(twin->avail, 1);
+      return twin;
+    }
+  }
+}
+
+// Selection and expansion on one determinization: descend by UCB among the
+// children legal in `det` until a node has an untried legal move, then add
+// that one child. Returns the node to back up from; `det` has followed it.
+static ISMCTSNode* select_and_expand(ISMCTSWorker* w, ISMCTSNode* node, struct gamestate* det)
+{ ActionList moves;
+  uint16_t untried[MAX_LEGAL_ACTIONS];
+  GameContext* ctx = w->ctx;
+
+  while(!is_terminal(det))
+  { get_search_actions(det, &moves);
+    uint16_t n = moves.count;
+    uint16_t num_untried = 0;
+    ISMCTSNode* first = atomic_load_explicit(&node->first_child, memory_order_acquire);
+    ISMCTSNode* best = NULL;
+    const Action* best_move = NULL;
+    double best_ucb = -1.0;
+
+    for(uint16_t i = 0; i < n; i++)
+    { ISMCTSNode* child = find_child(first, NULL, action_key(&moves.actions[i]));
+      if(child == NULL)
+      { untried[num_untried++] = i;
+        continue;
+      }
+      uint32_t avail = ADD(child->avail, 1) + 1;
+      uint32_t visits = LOAD(child->visits);
+      double ucb = LOAD(child->half_wins) * 0.5 / visits +
+                   w->params->exploration * sqrt(log(avail) / visits);
+      if(ucb > best_ucb)
+      { best_ucb = ucb;
+        best = child;
+        best_move = &moves.actions[i];
+      }
+    }
+
+    if(num_untried > 0)
+    { const Action* move = &moves.actions[untried[(uint16_t)(RND_uniform(ctx) * num_untried)]];
+      ISMCTSNode* child = new_node(w, node, move, det->player_to_move);
+      if(child == NULL) return node;  // out of memory: roll out from here
+      ISMCTSNode* linked = link_child(node, child);
+      if(linked != child)
+      { w->nodes--;
+        child = linked;
+      }
+      do_move(det, move, ctx);
+      return child;
+    }
+
+    ADD(best->visits, 1);  // virtual loss until the result is backed up
+    do_move(det, best_move, ctx);  // this determinization's cards for the node's move
+    node = best;
+  }
+  return node;
+} // select_and_expand
+
+static void* ismcts_worker_main(void* arg)
+{ ISMCTSWorker* w = (ISMCTSWorker*)arg;
+  PlayerID observer = w->root_state->player_to_move;
+  struct gamestate det;
+
+  while(atomic_fetch_add_explicit(w->claimed, 1, memory_order_relaxed) < w->budget)
+  { if(w->params->time_limit_ms > 0 &&
+       elapsed_ms_since(&w->start) >= w->params->time_limit_ms)
+      break;
+
+    clone_gamestate(&det, w->root_state);
+    randomize_hidden_information(&det, observer, w->ctx);
+
+    ADD(w->root->visits, 1);
+    ISMCTSNode* node = select_and_expand(w, w->root, &det);
+    rollout_random(&det, w->ctx);
+
+    for(; node != NULL; node = node->parent)
+      ADD(node->half_wins, (uint32_t)(2.0 * get_result(&det, node->player_just_moved)));
+    w->iterations++;
+  }
+  return NULL;
+} // ismcts_worker_main
+
+bool ismcts_choose_move(const struct gamestate* gstate, const ISMCTSParams* params,
+                        GameContext* ctx, Action* best, ISMCTSReport* report)
+{ struct timespec start;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+
+  ActionList root_moves;
+  get_search_actions(gstate, &root_moves);
+  uint16_t num_moves = root_moves.count;
+  if(num_moves == 0) return false;
+
+  if(ctx->arena == NULL)
+  { ctx->arena = arena_create(ISMCTS_ARENA_CHUNK_BYTES);
+    if(ctx->arena == NULL)
+    { *best = root_moves.actions[0];
+      return true;
+    }
+  }
+  arena_reset(ctx->arena);
+
+  uint32_t num_threads = params->threads;
+  if(num_threads < 1) num_threads = 1;
+  if(num_threads > MAX_AI_SEARCH_THREADS) num_threads = MAX_AI_SEARCH_THREADS;
+  bool shared_tree = params->parallel == AI_PARALLEL_TREE;
+
+  // Thread 0 is the caller and searches in ctx; the others get a context of
+  // their own, seeded from ctx, with an arena that lives for this decision
+  ISMCTSWorker workers[MAX_AI_SEARCH_THREADS];
+  GameContext worker_ctx[MAX_AI_SEARCH_THREADS];
+  _Atomic uint32_t claimed[MAX_AI_SEARCH_THREADS];
+  pthread_t threads[MAX_AI_SEARCH_THREADS];
+  bool running[MAX_AI_SEARCH_THREADS] = {false};
+  PlayerID observer = gstate->player_to_move;
+  uint32_t t;
+
+  for(t = 0; t < num_threads; t++)
+  { GameContext* wctx = ctx;
+    if(t > 0)
+    { wctx = &worker_ctx[t];
+      if(!init_worker_context(wctx, ctx, RND_next32(&ctx->rng)))
+        break;
+      wctx->arena = arena_create(ISMCTS_ARENA_CHUNK_BYTES);
+      if(wctx->arena == NULL)
+      { release_worker_context(wctx);
+        break;
+      }
+    }
+    atomic_init(&claimed[t], 0);
+    workers[t] = (ISMCTSWorker){ .root_state = gstate, .params = params, .ctx = wctx,
+                                 .start = start };
+    if(shared_tree && t > 0)
+    { workers[t].root = workers[0].root;
+      workers[t].claimed = &claimed[0];
+      workers[t].budget = params->iterations;
+    }
+    else
+    { workers[t].root = new_node(&workers[t], NULL, NULL, 1 - observer);
+      workers[t].claimed = &claimed[t];
+      workers[t].budget = params->iterations;
+      if(workers[t].root == NULL)
+      { if(t > 0)
+        { arena_destroy(wctx->arena);
+          RND_release(&wctx->rng);
+        }
+        break;
+      }
+      atomic_init(&workers[t].root->visits, 0);
+    }
+  }
+  if(t == 0)  // not even one tree: fall back to the first legal move
+  { *best = root_moves.actions[0];
+    return true;
+  }
+  num_threads = t;  // workers that could not be set up are dropped
+  if(!shared_tree)              // root parallel: split the budget
+  { for(t = 0; t < num_threads; t++)
+      workers[t].budget = params->iterations / num_threads +
+                          (t < params->iterations % num_threads);
+  }
+
+  for(t = 1; t < num_threads; t++)
+    running[t] = pthread_create(&threads[t], NULL, ismcts_worker_main, &workers[t]) == 0;
+  ismcts_worker_main(&workers[0]);
+  for(t = 1; t < num_threads; t++)
+  { if(running[t])
+      pthread_join(threads[t], NULL);
+    else
+      ismcts_worker_main(&workers[t]);
+  }
+
+  // Most visited root move over all trees (every root move is legal: the root
+  // is the observer's own decision)
+  uint32_t visits[MAX_LEGAL_ACTIONS] = {0};
+  uint32_t num_trees = shared_tree ? 1 : num_threads;
+  for(t = 0; t < num_trees; t++)
+  { if(workers[t].root == NULL) continue;
+    for(ISMCTSNode* child = atomic_load(&workers[t].root->first_child); child != NULL;
+        child = child->next_sibling)
+    { for(uint16_t i = 0; i < num_moves; i++)
+      { if(action_key(&root_moves.actions[i]) == child->key)
+        { visits[i] += LOAD(child->visits);
+          break;
+        }
+      }
+    }
+  }
+  uint16_t chosen = 0;
+  for(uint16_t i = 1; i < num_moves; i++)
+  { if(visits[i] > visits[chosen]) chosen = i;
+  }
+  *best = root_moves.actions[chosen];
+
+  uint32_t iterations = 0, nodes = 0;
+  size_t arena_bytes = ctx->arena->used, peak_arena_bytes = ctx->arena->peak;
+  for(t = 0; t < num_threads; t++)
+  { iterations += workers[t].iterations;
+    nodes += workers[t].nodes;
+    if(t > 0)
+    { arena_bytes += worker_ctx[t].arena->used;
+      peak_arena_bytes += worker_ctx[t].arena->peak;
+      release_worker_context(&worker_ctx[t]);
+    }
+  }
+
+  if(report != NULL)
+  { report->iterations = iterations;
+    report->nodes = nodes;
+    report->threads = num_threads;
+    report->elapsed_ms = elapsed_ms_since(&start);
+    report->iterations_per_sec = report->elapsed_ms > 0 ?
+                                 iterations / (report->elapsed_ms * 1e-3) : 0.0;
+    report->arena_bytes = arena_bytes;
+    report->peak_arena_bytes = peak_arena_bytes;
+  }
+
+  DEBUG_PRINT(" ISMCTS: %u iterations on %u threads, %u nodes, best move type %u\n",
+              iterations, num_threads, nodes, best->type);
+  return true;
+} // ismcts_choose_move
+
+static void ismcts_play(struct gamestate* gstate, GameContext* ctx)
+{ ISMCTSParams params = ismcts_params_from_config(ctx->config);
+  ISMCTSReport report;
+  Action best;
+
+  if(!ismcts_choose_move(gstate, &params, ctx, &best, &report)) return;
+  apply_action(gstate, gstate->player_to_move, &best, ctx);
+
+  if(ctx->config != NULL && ctx->config->verbose)
+    printf("ISMCTS: %u iterations on %u thread(s) in %.1f ms (%.0f iterations/s), "
+           "%u nodes, arena %zu bytes (peak %zu)\n",
+           report.iterations, report.threads, report.elapsed_ms,
+           report.iterations_per_sec, report.nodes, report.arena_bytes,
+           report.peak_arena_bytes);
+}
+
+void ismcts_attack_strategy(struct gamestate* gstate, GameContext* ctx)
+{ ismcts_play(gstate, ctx);
+}
+
+void ismcts_defense_strategy(struct gamestate* gstate, GameContext* ctx)
+{ ismcts_play(gstate, ctx);
+}
@@ -0,0 +1,58 @@
+// ai_strat_ismcts1.h
+// Information Set Monte Carlo Tree Search strategy (strat_ismcts1)
+
+#ifndef AI_STRAT_ISMCTS1_H
+#define AI_STRAT_ISMCTS1_H
+
+#include <stddef.h>
+
+#include "../core/game_types.h"
+#include "../core/game_context.h"
+#include "ai_strat_lib_search.h"
+
+#define ISMCTS_DEFAULT_ITERATIONS 2000
+#define ISMCTS_DEFAULT_EXPLORATION 0.7
+#define ISMCTS_ARENA_CHUNK_BYTES (1u << 20)
+
+typedef struct
+{ uint32_t iterations;      // 0 = ISMCTS_DEFAULT_ITERATIONS
+  uint32_t time_limit_ms;   // 0 = no wall-clock limit
+  double exploration;       // UCB constant
+  uint32_t threads;         // search threads per decision (0 or 1 = serial)
+  ai_parallel_t parallel;   // how threads > 1 share the work
+} ISMCTSParams;
+
+typedef struct
+{ uint32_t iterations;     // summed over threads
+  uint32_t nodes;
+  uint32_t threads;
+  double elapsed_ms;
+  double iterations_per_sec;
+  size_t arena_bytes;       // arena used by this decision's tree(s)
+  size_t peak_arena_bytes;  // ctx->arena high-water mark plus the workers' arenas
+} ISMCTSReport;
+
+// Budget and threading from the command line (--ai.budget, --ai.time,
+// --ai.workers, --ai.parallel); cfg may be NULL
+ISMCTSParams ismcts_params_from_config(const config_t* cfg);
+
+// Search from gstate (left untouched) for gstate->player_to_move. The tree
+// lives in ctx->arena (created on first use, reset at every call). Returns
+// false if there is no legal move; report may be NULL.
+//
+// With threads > 1 the iteration budget is shared by all threads and extra
+// threads draw their RNG seeds from ctx, so a seed still fixes the outcome of
+// a root-parallel search (thread timing makes tree-parallel runs vary):
+// - AI_PARALLEL_ROOT: every thread grows its own tree from its own
+//   determinizations; root visit counts are summed to pick the move.
+// - AI_PARALLEL_TREE: all threads grow one tree with atomic statistics; a
+//   node's visit count rises on the way down (virtual loss) so concurrent
+//   iterations spread over different branches.
+bool ismcts_choose_move(const struct gamestate* gstate, const ISMCTSParams* params,
+                        GameContext* ctx, Action* best, ISMCTSReport* report);
+
+// Strategy functions for StrategySet (print the report in verbose mode)
+void ismcts_attack_strategy(struct gamestate* gstate, GameContext* ctx);
+void ismcts_defense_strategy(struct gamestate* gstate, GameContext* ctx);
+
+#endif // AI_STRAT_ISMCTS1_H
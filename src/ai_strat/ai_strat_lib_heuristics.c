@@ -1 +1,154 @@
-// shared AI utility (library) functions
\ No newline at end of file
+// ai_strat_lib_heuristics.c
+// Advantage terms and their evaluation (see ai_strat_lib_heuristics.h)
+#include <math.h>
+#include <pthread.h>
+#include <string.h>
+
+#include "ai_strat_lib_heuristics.h"
+#include "../core/card_catalog.h"
+#include "../core/combo_bonus.h"
+#include "../core/game_constants.h"
+
+// Standard normal Z: the tail P(Z > z) and the excess E[max(Z - z, 0)],
+// interpolated from a table over [-NORMAL_CUTOFF, NORMAL_CUTOFF] (error under
+// 1e-4), and exact to float precision past the cutoff. The table is filled on
+// the first heuristic_terms_init().
+#define NORMAL_CUTOFF 6.0f
+#define NORMAL_STEPS_PER_UNIT 32
+#define NORMAL_TABLE_SIZE (2 * 6 * NORMAL_STEPS_PER_UNIT + 2)
+
+// 1 / sqrt(2) and 1 / sqrt(2 pi) (math.h's M_ constants are not ISO C)
+#define INV_SQRT2 0.70710678118654752440
+#define INV_SQRT_2PI 0.39894228040143267794
+
+static float normal_tail_table[NORMAL_TABLE_SIZE], normal_excess_table[NORMAL_TABLE_SIZE];
+static pthread_once_t normal_table_once = PTHREAD_ONCE_INIT;
+
+static void normal_table_init(void)
+{ for(int i = 0; i < NORMAL_TABLE_SIZE; i++)
+  { double z = -NORMAL_CUTOFF + (double)i / NORMAL_STEPS_PER_UNIT;
+    double tail = 0.5 * erfc(z * INV_SQRT2);
+    normal_tail_table[i] = (float)tail;
+    normal_excess_table[i] = (float)(exp(-0.5 * z * z) * INV_SQRT_2PI - z * tail);
+  }
+}
+
+static inline void normal_tail_excess(float z, float* tail, float* excess)
+{ if(z >= NORMAL_CUTOFF)
+  { *tail = *excess = 0.0f;
+    return;
+  }
+  if(z <= -NORMAL_CUTOFF)
+  { *tail = 1.0f;
+    *excess = -z;
+    return;
+  }
+  float x = (z + NORMAL_CUTOFF) * NORMAL_STEPS_PER_UNIT;
+  int i = (int)x;
+  float f = x - i;
+  *tail = normal_tail_table[i] + f * (normal_tail_table[i + 1] - normal_tail_table[i]);
+  *excess = normal_excess_table[i] + f * (normal_excess_table[i + 1] - normal_excess_table[i]);
+}
+
+static inline void zone_add(HeuristicTerms* terms, PlayerID player, uint8_t card)
+{ terms->zone[player][terms->zone_size[player]++] = card;
+  terms->zone_mean[player] +=
+    player == terms->attacker ? card_attack_mean[card] : card_defense_mean[card];
+  terms->zone_var[player] += card_dice_var[card];
+}
+
+void heuristic_terms_init(HeuristicTerms* terms, const struct gamestate* gstate)
+{ pthread_once(&normal_table_once, normal_table_init);
+  memset(terms, 0, sizeof(*terms));
+  terms->attacker = gstate->current_player;
+  for(int p = 0; p < 2; p++)
+  { terms->energy[p] = gstate->current_energy[p];
+    terms->cash[p] = gstate->current_cash_balance[p];
+    terms->cards[p] = gstate->hand[p].size;
+    for(uint8_t i = 0; i < gstate->combat_zone[p].size && i < 3; i++)
+      zone_add(terms, p, gstate->combat_zone[p].cards[i]);
+  }
+}
+
+static inline void terms_apply(HeuristicTerms* terms, PlayerID player, const Action* action)
+{ switch(action->type)
+  { case ACTION_CHAMPIONS:
+      for(uint8_t i = 0; i < action->num_cards; i++)
+      { terms->cash[player] -= fullDeck[action->cards[i]].cost;
+        zone_add(terms, player, action->cards[i]);
+      }
+      terms->cards[player] -= action->num_cards;
+      break;
+    case ACTION_DRAW:
+      terms->cash[player] -= fullDeck[action->card].cost;
+      terms->cards[player] += fullDeck[action->card].draw_num - 1;
+      break;
+    case ACTION_RECALL:
+      terms->cash[player] -= fullDeck[action->card].cost;
+      terms->cards[player] += action->num_cards - 1;
+      break;
+    case ACTION_CASH:
+      terms->cash[player] += fullDeck[action->card].exchange_cash - fullDeck[action->card].cost;
+      terms->cards[player] -= 2;
+      break;
+    default:
+      break;
+  }
+}
+
+void heuristic_terms_apply(HeuristicTerms* terms, PlayerID player, const Action* action)
+{ terms_apply(terms, player, action);
+}
+
+static inline int zone_combo(const HeuristicTerms* terms, PlayerID player)
+{ return terms->zone_size[player] < 2 ? 0 :
+         combo_bonus_lookup(terms->zone[player], terms->zone_size[player], DECK_RANDOM);
+}
+
+static inline double advantage(const HeuristicTerms* terms, PlayerID player,
+                               const HeuristicParams* params)
+{ const PlayerID opponent = 1 - player;
+  const PlayerID a = terms->attacker, d = 1 - a;
+  float energy[2] = {terms->energy[0], terms->energy[1]};
+  float dead[2] = {terms->energy[0] == 0, terms->energy[1] == 0};
+
+  // Damage = attack - defense, capped at the defender's energy: the defender
+  // dies if the damage reaches it (the totals are integers, so the cap is
+  // taken half a point lower)
+  if(terms->zone_size[a] > 0 && energy[d] > 0)
+  { float mu = terms->zone_mean[a] + zone_combo(terms, a) - terms->zone_mean[d] - zone_combo(terms, d);
+    float var = terms->zone_var[a] + terms->zone_var[d];
+    float cap = energy[d] - 0.5f;
+    if(var > 0.0f)
+    { float sd = sqrtf(var), inv_sd = 1.0f / sd;
+      float tail, excess_0, excess_cap;
+      normal_tail_excess(-mu * inv_sd, &tail, &excess_0);
+      normal_tail_excess((cap - mu) * inv_sd, &dead[d], &excess_cap);
+      energy[d] -= sd * (excess_0 - excess_cap);
+    }
+    else
+    { energy[d] -= fminf(fmaxf(mu, 0.0f), energy[d]);
+      dead[d] = mu > cap;
+    }
+  }
+
+  double energy_advantage = energy[player] - energy[opponent] +
+                            params->win_bonus * (dead[opponent] - dead[player]);
+  int cards[2] = {terms->cards[0], terms->cards[1]};
+  if(cards[a] > HEURISTIC_HAND_KEPT) cards[a] = HEURISTIC_HAND_KEPT;
+  double cards_advantage = cards[player] - params->opponent_cards * cards[opponent];
+  double cash_advantage = terms->cash[player] - terms->cash[opponent];
+  return params->epsilon * energy_advantage + params->gamma * cards_advantage + cash_advantage;
+} // advantage
+
+double heuristic_advantage(const HeuristicTerms* terms, PlayerID player,
+                           const HeuristicParams* params)
+{ return advantage(terms, player, params);
+}
+
+double heuristic_move_advantage(const HeuristicTerms* terms, PlayerID player, const Action* action,
+                                const HeuristicParams* params)
+{ HeuristicTerms scratch = *terms;
+  terms_apply(&scratch, player, action);
+  return advantage(&scratch, player, params);
+}
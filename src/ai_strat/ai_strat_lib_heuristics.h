@@ -0,0 +1,60 @@
+// ai_strat_lib_heuristics.h
+// Position evaluation for the heuristic agents (strat_heuristic1): the
+// Energy/Cards/Cash advantage described in ai_strat_heuristic1.c. A position
+// is reduced to a few terms (energy, cash, hand sizes, the combat zones'
+// totals) that an action updates by its delta, so scoring a move scans no
+// hand or discard.
+
+#ifndef AI_STRAT_LIB_HEURISTICS_H
+#define AI_STRAT_LIB_HEURISTICS_H
+
+#include "../core/game_types.h"
+#include "../actions/action.h"
+
+// Advantage = epsilon * Energy + gamma * Cards + Cash, from one player's side
+typedef struct
+{ double epsilon;         // weight of the energy advantage
+  double gamma;           // weight of the cards advantage
+  double opponent_cards;  // an opponent card (unseen) against one of ours
+  double win_bonus;       // energy advantage of a won game, times its probability
+} HeuristicParams;
+
+#define HEURISTIC_DEFAULT_EPSILON 1.0
+#define HEURISTIC_DEFAULT_GAMMA 8.0
+#define HEURISTIC_DEFAULT_OPPONENT_CARDS 1.0
+#define HEURISTIC_DEFAULT_WIN_BONUS 100.0
+
+// Cards in hand past this are discarded at the attacker's end of turn
+#define HEURISTIC_HAND_KEPT 7
+
+// The terms of a position. A pending combat (the attacker has champions out)
+// counts at its expectation: the totals are sums of independent dice, taken as
+// normal, so damage and the chance of a kill come out in closed form.
+typedef struct
+{ uint8_t attacker;              // gstate->current_player
+  uint8_t energy[2];
+  int16_t cash[2];
+  uint8_t cards[2];              // hand sizes
+  uint8_t zone[2][3];            // combat zones, for the combo bonus
+  uint8_t zone_size[2];
+  float zone_mean[2];            // expected total without the combo bonus
+  float zone_var[2];             // variance of the dice
+} HeuristicTerms;
+
+// Terms of gstate, by a full scan
+void heuristic_terms_init(HeuristicTerms* terms, const struct gamestate* gstate);
+
+// Terms after `player` plays the action (a draw counts its cards drawn, a
+// cash card the champion it gives up); the action is assumed legal
+void heuristic_terms_apply(HeuristicTerms* terms, PlayerID player, const Action* action);
+
+// The advantage of `player` in the position the terms describe
+double heuristic_advantage(const HeuristicTerms* terms, PlayerID player,
+                           const HeuristicParams* params);
+
+// The advantage of `player` after playing the action, scored on a scratch
+// copy of the terms (left untouched)
+double heuristic_move_advantage(const HeuristicTerms* terms, PlayerID player, const Action* action,
+                                const HeuristicParams* params);
+
+#endif // AI_STRAT_LIB_HEURISTICS_H
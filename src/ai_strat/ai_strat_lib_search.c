@@ -0,0 +1,169 @@
+// ai_strat_lib_search.c
+// Search primitives shared by the Monte Carlo agents (see ai_strat_lib_search.h)
+#include <stdio.h>
+
+#include "ai_strat_lib_search.h"
+#include "ai_strat_random.h"
+#include "../core/card_actions.h"
+#include "../core/combat.h"
+#include "../core/game_constants.h"
+#include "../core/turn_logic.h"
+#include "../core/zobrist.h"
+#include "../util/rnd.h"
+
+void get_search_actions(const struct gamestate* gstate, ActionList* list)
+{ list->options = SEARCH_ACTION_OPTIONS;
+  generate_legal_actions(gstate, gstate->player_to_move, list);
+}
+
+// Same sequence as play_turn() and the stda.auto game loop, from the point
+// where the attacker has played (or the defender has answered)
+static void finish_turn(struct gamestate* gstate, GameContext* ctx)
+{ if(gstate->someone_has_zero_energy) return;
+
+  end_of_turn(gstate, ctx);
+  if(gstate->turn >= MAX_NUMBER_OF_TURNS)
+  { gstate->game_state = DRAW;
+    return;
+  }
+  begin_of_turn(gstate, ctx);
+}
+
+static void after_attack(struct gamestate* gstate, GameContext* ctx)
+{ gstate->turn_phase = DEFENSE;
+  gstate->player_to_move = 1 - gstate->current_player;
+
+  if(gstate->combat_zone[gstate->current_player].size == 0)
+    finish_turn(gstate, ctx);
+}
+
+static void after_defense(struct gamestate* gstate, GameContext* ctx)
+{ resolve_combat(gstate, ctx);
+  finish_turn(gstate, ctx);
+}
+
+void do_move(struct gamestate* gstate, const Action* action, GameContext* ctx)
+{ apply_action(gstate, gstate->player_to_move, action, ctx);
+
+  if(gstate->turn_phase == ATTACK)
+    after_attack(gstate, ctx);
+  else
+    after_defense(gstate, ctx);
+}
+
+// A deck formed by a reshuffle holds only cards of gstate->reshuffled (an empty
+// one counts too: whatever is drawn next comes from the next reshuffle)
+static bool deck_reshuffled(const struct gamestate* gstate, PlayerID player)
+{ const struct deck_stack* deck = &gstate->deck[player];
+  return deck->size == 0 || CardBitset_contains(&gstate->reshuffled, deck->card_indices[0]);
+}
+
+void randomize_hidden_information(struct gamestate* gstate, PlayerID observer,
+                                  GameContext* ctx)
+{ PlayerID opponent = 1 - observer;
+  bool placed[FULL_DECK_SIZE] = {false};
+  uint8_t pool[FULL_DECK_SIZE], known[FULL_DECK_SIZE];
+  uint8_t n = 0, n_known = 0;
+
+  struct deck_stack* own_deck = &gstate->deck[observer];
+  struct deck_stack* opp_deck = &gstate->deck[opponent];
+  Hand* opp_hand = &gstate->hand[opponent];
+  uint8_t own_deck_size = own_deck->size;
+  uint8_t opp_deck_size = opp_deck->size;
+  uint8_t opp_hand_size = opp_hand->size;
+  bool own_reshuffled = deck_reshuffled(gstate, observer);
+  bool opp_reshuffled = deck_reshuffled(gstate, opponent);
+
+  // Cards the observer sees stay where they are
+  for(int p = 0; p < 2; p++)
+  { for(uint8_t i = 0; i < gstate->discard[p].size; i++)
+      placed[gstate->discard[p].cards[i]] = true;
+    for(uint8_t i = 0; i < gstate->combat_zone[p].size; i++)
+      placed[gstate->combat_zone[p].cards[i]] = true;
+  }
+  for(uint8_t i = 0; i < gstate->hand[observer].size; i++)
+    placed[gstate->hand[observer].cards[i]] = true;
+
+  // A reshuffled own deck holds known cards in an unknown order; a lazy deck
+  // has no order (draws sample it), so it is left as it is
+  if(own_reshuffled)
+  { for(uint8_t i = 0; i < own_deck_size; i++)
+    { known[i] = own_deck->card_indices[i];
+      placed[known[i]] = true;
+    }
+    if(!ctx->config->lazy_deck)
+    { RND_partial_shuffle(known, own_deck_size, own_deck_size, ctx);
+      DeckStk_emptyOut(own_deck);
+      for(uint8_t i = 0; i < own_deck_size; i++)
+        DeckStk_push(own_deck, known[i]);
+    }
+  }
+
+  // The opponent's reshuffled cards are known to be in its deck or hand, not
+  // which is where: its deck is drawn from them, the rest stay in hand
+  for(uint8_t i = 0; i < opp_deck_size; i++)
+  { if(CardBitset_contains(&gstate->reshuffled, opp_deck->card_indices[i]))
+      known[n_known++] = opp_deck->card_indices[i];
+  }
+  for(uint8_t i = 0; i < opp_hand_size; i++)
+  { if(CardBitset_contains(&gstate->reshuffled, opp_hand->cards[i]))
+      known[n_known++] = opp_hand->cards[i];
+  }
+  for(uint8_t i = 0; i < n_known; i++)
+    placed[known[i]] = true;
+  uint8_t deck_from_known = opp_reshuffled ? opp_deck_size : 0;
+  RND_partial_shuffle(known, n_known, n_known, ctx);
+
+  // Everything else is unseen: decks never reshuffled, the rest of the
+  // opponent's hand and the cards never dealt
+  for(uint8_t c = 0; c < FULL_DECK_SIZE; c++)
+  { if(!placed[c]) pool[n++] = c;
+  }
+  uint8_t needed = (own_reshuffled ? 0 : own_deck_size) + (opp_deck_size - deck_from_known) +
+                   (opp_hand_size - (n_known - deck_from_known));
+  RND_partial_shuffle(pool, n, needed, ctx);
+
+  uint8_t next = 0;
+  if(!own_reshuffled)
+  { DeckStk_emptyOut(own_deck);
+    for(uint8_t i = 0; i < own_deck_size; i++)
+      DeckStk_push(own_deck, pool[next++]);
+  }
+  DeckStk_emptyOut(opp_deck);
+  for(uint8_t i = 0; i < opp_deck_size; i++)
+    DeckStk_push(opp_deck, opp_reshuffled ? known[i] : pool[next++]);
+  Hand_clear(opp_hand);
+  for(uint8_t i = deck_from_known; i < n_known; i++)
+    Hand_add(opp_hand, known[i]);
+  while(opp_hand->size < opp_hand_size)
+    Hand_add(opp_hand, pool[next++]);
+  zobrist_refresh(gstate);
+} // randomize_hidden_information
+
+bool is_terminal(const struct gamestate* gstate)
+{ return gstate->game_state != ACTIVE;
+}
+
+double get_result(const struct gamestate* gstate, PlayerID player)
+{ switch(gstate->game_state)
+  { case PLAYER_A_WINS:
+      return player == PLAYER_A ? 1.0 : 0.0;
+    case PLAYER_B_WINS:
+      return player == PLAYER_B ? 1.0 : 0.0;
+    default:
+      return 0.5;
+  }
+}
+
+void rollout_random(struct gamestate* gstate, GameContext* ctx)
+{ while(!is_terminal(gstate))
+  { if(gstate->turn_phase == ATTACK)
+    { random_attack_strategy(gstate, ctx);
+      after_attack(gstate, ctx);
+    }
+    else
+    { random_defense_strategy(gstate, ctx);
+      after_defense(gstate, ctx);
+    }
+  }
+}
@@ -0,0 +1,50 @@
+// ai_strat_lib_search.h
+// Search primitives shared by the Monte Carlo agents (strat_simplemc1,
+// strat_ismcts1): action enumeration, DoMove, Clone_And_Randomize, GetResult and
+// random rollouts, on top of the engine action layer (actions/action.h).
+// Everything works in place on caller-owned gamestate buffers -- nothing here
+// allocates.
+
+#ifndef AI_STRAT_LIB_SEARCH_H
+#define AI_STRAT_LIB_SEARCH_H
+
+#include "../core/game_types.h"
+#include "../core/game_context.h"
+#include "../actions/action.h"
+
+// Actions the search agents branch on: the legal actions (action.h) up to
+// card equivalence, without recall -- its discard subsets would swamp the
+// tree, and no agent recalls yet
+#define SEARCH_ACTION_OPTIONS (ACTIONS_DISTINCT | ACTIONS_NO_RECALL)
+
+// Search actions of gstate->player_to_move in gstate->turn_phase (none once
+// the game is over)
+void get_search_actions(const struct gamestate* gstate, ActionList* list);
+
+// DoMove: apply the action for gstate->player_to_move, then advance the state
+// to the next decision point (defense after an attack with combat, otherwise
+// combat resolution, end of turn and the next player's begin of turn) or to
+// the end of the game
+void do_move(struct gamestate* gstate, const Action* action, GameContext* ctx);
+
+// Clone_And_Randomize, in place: re-deal every card the observer cannot see
+// (own deck order, opponent hand and deck, never-dealt cards) keeping all
+// pile sizes, so the state is one sample of the observer's information set.
+// A deck formed by a reshuffle is the old discard pile, seen by both players:
+// it keeps those cards (the opponent's may trade places with the ones it has
+// drawn into hand); under config.lazy_deck the observer's own is left as it
+// is, draws sampling it anyway. Cards in hand from before a player's last
+// reshuffle, and recalled champions, are sampled as unseen: they are drawn
+// from the unseen pool, though the observer may have seen them earlier.
+void randomize_hidden_information(struct gamestate* gstate, PlayerID observer,
+                                  GameContext* ctx);
+
+bool is_terminal(const struct gamestate* gstate);
+
+// GetResult: 1 if player won, 0 if it lost, 0.5 for a draw (terminal states only)
+double get_result(const struct gamestate* gstate, PlayerID player);
+
+// Play the game out with the random strategy for both players
+void rollout_random(struct gamestate* gstate, GameContext* ctx);
+
+#endif // AI_STRAT_LIB_SEARCH_H
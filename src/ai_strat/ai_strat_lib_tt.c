@@ -0,0 +1,126 @@
+// ai_strat_lib_tt.c
+// Lock-free transposition table (see ai_strat_lib_tt.h)
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ai_strat_lib_tt.h"
+
+#define TAG_SHIFT 48
+#define VISITS_SHIFT 25
+#define HALF_WINS_MASK ((1ull << VISITS_SHIFT) - 1)
+
+static inline uint64_t pack(uint64_t tag, uint32_t visits, uint32_t half_wins)
+{ return tag << TAG_SHIFT | (uint64_t)visits << VISITS_SHIFT | half_wins;
+}
+
+static inline uint64_t tag_of(uint64_t word)
+{ return word >> TAG_SHIFT;
+}
+
+static inline uint32_t visits_of(uint64_t word)
+{ return (uint32_t)(word >> VISITS_SHIFT) & TT_MAX_VISITS;
+}
+
+static inline uint32_t half_wins_of(uint64_t word)
+{ return (uint32_t)(word & HALF_WINS_MASK);
+}
+
+static inline _Atomic uint64_t* bucket_of(const TranspositionTable* tt, uint64_t key)
+{ return tt->slots + (key & tt->bucket_mask) * TT_BUCKET_SLOTS;
+}
+
+TranspositionTable* tt_create(uint8_t log2_slots)
+{ if(log2_slots < 3 || log2_slots > 32) return NULL;
+
+  TranspositionTable* tt = malloc(sizeof(TranspositionTable));
+  if(!tt) return NULL;
+
+  size_t bytes = sizeof(uint64_t) << log2_slots;
+  tt->slots = aligned_alloc(64, bytes < 64 ? 64 : bytes);
+  if(!tt->slots)
+  { free(tt);
+    return NULL;
+  }
+  tt->log2_slots = log2_slots;
+  tt->bucket_mask = ((uint64_t)1 << log2_slots) / TT_BUCKET_SLOTS - 1;
+  tt_clear(tt);
+  return tt;
+}
+
+void tt_destroy(TranspositionTable* tt)
+{ if(!tt) return;
+  free(tt->slots);
+  free(tt);
+}
+
+void tt_clear(TranspositionTable* tt)
+{ memset(tt->slots, 0, sizeof(uint64_t) << tt->log2_slots);
+}
+
+bool tt_probe(const TranspositionTable* tt, uint64_t key, TTStats* out)
+{ _Atomic uint64_t* bucket = bucket_of(tt, key);
+  uint64_t tag = tag_of(key);
+
+  for(int i = 0; i < TT_BUCKET_SLOTS; i++)
+  { uint64_t word = atomic_load_explicit(&bucket[i], memory_order_relaxed);
+    if(visits_of(word) > 0 && tag_of(word) == tag)
+    { out->visits = visits_of(word);
+      out->half_wins = half_wins_of(word);
+      return true;
+    }
+  }
+  return false;
+}
+
+void tt_add(TranspositionTable* tt, uint64_t key, uint32_t visits, uint32_t half_wins)
+{ if(half_wins > 2 * visits) half_wins = 2 * visits;
+  while(visits > TT_MAX_VISITS)
+  { visits >>= 1;
+    half_wins >>= 1;
+  }
+  if(visits == 0) return;
+
+  _Atomic uint64_t* bucket = bucket_of(tt, key);
+  uint64_t tag = tag_of(key);
+
+  for(;;)
+  { int victim = 0;
+    uint64_t victim_word = UINT64_MAX;
+
+    for(int i = 0; i < TT_BUCKET_SLOTS; i++)
+    { uint64_t word = atomic_load_explicit(&bucket[i], memory_order_relaxed);
+
+      // Our entry: fold the counts in, retrying while other threads update it
+      while(visits_of(word) > 0 && tag_of(word) == tag)
+      { uint32_t v = visits_of(word), hw = half_wins_of(word);
+        while(v + visits > TT_MAX_VISITS)
+        { v >>= 1;
+          hw >>= 1;
+        }
+        if(atomic_compare_exchange_weak_explicit(&bucket[i], &word,
+                                                 pack(tag, v + visits, hw + half_wins),
+                                                 memory_order_relaxed, memory_order_relaxed))
+          return;
+      }
+
+      if(victim_word == UINT64_MAX || visits_of(word) < visits_of(victim_word))
+      { victim = i;
+        victim_word = word;
+      }
+    }
+
+    // Not found: take the empty or least visited slot, unless it changed meanwhile
+    if(atomic_compare_exchange_strong_explicit(&bucket[victim], &victim_word,
+                                               pack(tag, visits, half_wins),
+                                               memory_order_relaxed, memory_order_relaxed))
+      return;
+  }
+} // tt_add
+
+size_t tt_count(const TranspositionTable* tt)
+{ size_t n = 0;
+  for(uint64_t i = 0; i < ((uint64_t)1 << tt->log2_slots); i++)
+    n += visits_of(atomic_load_explicit(&tt->slots[i], memory_order_relaxed)) > 0;
+  return n;
+}
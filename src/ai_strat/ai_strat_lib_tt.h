@@ -0,0 +1,50 @@
+// ai_strat_lib_tt.h
+// Fixed-size, lock-free transposition table of playout statistics, keyed by
+// gamestate_key() (core/zobrist.h) and shareable by any number of search threads
+
+#ifndef AI_STRAT_LIB_TT_H
+#define AI_STRAT_LIB_TT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Each slot is one 64-bit word: a 16-bit tag from the top of the key, 23 bits
+// of visits and 25 bits of half-wins (a win counts 2, a draw 1). Every update
+// is a single compare-and-swap, so readers never see a torn entry and an add
+// to an existing entry is never lost. A key probes the TT_BUCKET_SLOTS slots
+// of its bucket (half a cache line); a new key takes the first empty slot, or
+// evicts the least visited. Two keys are confused only if they share bucket
+// and tag.
+#define TT_BUCKET_SLOTS 4
+#define TT_MAX_VISITS ((1u << 23) - 1)
+
+typedef struct
+{ uint32_t visits;
+  uint32_t half_wins;
+} TTStats;
+
+typedef struct
+{ _Atomic uint64_t* slots;
+  uint64_t bucket_mask;   // number of buckets - 1
+  uint8_t log2_slots;
+} TranspositionTable;
+
+// 2^log2_slots slots (8 bytes each; log2_slots from 3 to 32).
+// Returns NULL if log2_slots is out of range or the allocation fails.
+TranspositionTable* tt_create(uint8_t log2_slots);
+void tt_destroy(TranspositionTable* tt);
+void tt_clear(TranspositionTable* tt);   // not concurrently with probes or adds
+
+// Statistics stored for key; false if the key is not in the table
+bool tt_probe(const TranspositionTable* tt, uint64_t key, TTStats* out);
+
+// Add visits and half_wins (at most 2 * visits) to the key's entry, creating it
+// if needed. When the visits would overflow, both counts are halved first (the
+// mean stays).
+void tt_add(TranspositionTable* tt, uint64_t key, uint32_t visits, uint32_t half_wins);
+
+// Slots currently holding an entry
+size_t tt_count(const TranspositionTable* tt);
+
+#endif // AI_STRAT_LIB_TT_H
@@ -3,38 +3,28 @@
 #include <stdlib.h>
 
 #include "ai_strat_random.h"
-#include "../core/card_actions.h"
+#include "../actions/action.h"
 #include "../core/game_constants.h"
 #include "../util/rnd.h"
-#include "../util/mtwister.h"
+
+// The random strategy plays one uniformly chosen card: its choices are the
+// single-card actions, one per affordable card, with the lowest-power
+// champion given up for a cash card
+#define RANDOM_ACTION_OPTIONS (ACTIONS_SINGLES_ONLY | ACTIONS_NO_RECALL | ACTIONS_AUTO_EXCHANGE)
 
 void random_attack_strategy(struct gamestate* gstate, GameContext* ctx)
 { PlayerID attacker = gstate->current_player;
 
   if(gstate->hand[attacker].size == 0) return;
 
-  // Build list of affordable cards
-  uint8_t affordable[gstate->hand[attacker].size];
-  uint8_t count = 0;
-
-  bool has_champions = has_champion_in_hand(&gstate->hand[attacker]);
-
-  for(uint8_t i = 0; i < gstate->hand[attacker].size; i++)
-  { uint8_t card_idx = gstate->hand[attacker].cards[i];
-
-    if(fullDeck[card_idx].cost <= gstate->current_cash_balance[attacker])
-    { // Skip cash cards if no champions available (in the hand)
-      if(fullDeck[card_idx].card_type == CASH_CARD && !has_champions)
-        continue;
-      affordable[count++] = card_idx;
-    }
-  }
-
-  if(count == 0) return;
+  ActionList list;
+  list.options = RANDOM_ACTION_OPTIONS;
+  generate_legal_actions(gstate, attacker, &list);
+  if(list.num_single == 0) return;
 
   // Play random affordable card
-  uint8_t chosen = RND_randn(count, ctx);
-  play_card(gstate, attacker, affordable[chosen], ctx);
+  uint8_t chosen = RND_randn((uint8_t)list.num_single, ctx);
+  apply_action(gstate, attacker, &list.actions[1 + chosen], ctx);
 } // random_attack_strategy
 
 void random_defense_strategy(struct gamestate* gstate, GameContext* ctx)
@@ -43,23 +33,15 @@ void random_defense_strategy(struct gamestate* gstate, GameContext* ctx)
   if(gstate->hand[defender].size == 0) return;
 
   // Only defend 47% of the time: this is a parameter of the strategy that could be set more dynamically and tested, the goal being to make the strategy as strong as possible
-  if(genRand(&ctx->rng) > 0.47) return; // TODO: move the 0.47 magic number to a better place and build an optimization framework to tune this parameter
-
-  // Build list of affordable champions
-  uint8_t affordable[gstate->hand[defender].size];
-  uint8_t count = 0;
-
-  for(uint8_t i = 0; i < gstate->hand[defender].size; i++)
-  { uint8_t card_idx = gstate->hand[defender].cards[i];
-
-    if(fullDeck[card_idx].card_type == CHAMPION_CARD &&
-       fullDeck[card_idx].cost <= gstate->current_cash_balance[defender])
-      affordable[count++] = card_idx;
-  }
+  if(RND_uniform(ctx) > 0.47) return; // TODO: move the 0.47 magic number to a better place and build an optimization framework to tune this parameter
 
-  if(count == 0) return;
+  // Affordable champions (the only single-card actions in the defense phase)
+  ActionList list;
+  list.options = RANDOM_ACTION_OPTIONS;
+  generate_legal_actions(gstate, defender, &list);
+  if(list.num_single == 0) return;
 
   // Play random champion
-  uint8_t chosen = RND_randn(count, ctx);
-  play_champion(gstate, defender, affordable[chosen], ctx);
+  uint8_t chosen = RND_randn((uint8_t)list.num_single, ctx);
+  apply_action(gstate, defender, &list.actions[1 + chosen], ctx);
 } // random_defense_strategy
@@ -1,3 +1,12 @@
+// ai_strat_simplemc1.c
+// Simple Monte Carlo strategy (strat_simplemc1), following the design notes below
+#include <math.h>
+#include <time.h>
+
+#include "ai_strat_simplemc1.h"
+#include "../core/game_state.h"
+#include "../util/debug.h"
+
 /*
    Monte Carlo Single Stage Analysis (strat_simplemc1):
       manually create 100 distinct 'attack' phase game states at various stages of the game.
@@ -40,3 +49,140 @@
 
 
  * */
+
+// Successive halving: every surviving move gets ROUND_PLAYOUTS[r] rollouts in
+// round r, then only the best Nm^ROUND_EXPONENT[r+1] (capped) are kept
+#define SIMPLEMC_ROUNDS 4
+static const uint16_t ROUND_PLAYOUTS[SIMPLEMC_ROUNDS] = {100, 200, 400, 800};
+static const double ROUND_EXPONENT[SIMPLEMC_ROUNDS] = {1.0, 0.75, 0.5, 0.25};
+static const uint16_t ROUND_MAX_KEEP[SIMPLEMC_ROUNDS] = {MAX_LEGAL_ACTIONS, 30, 10, 4};
+
+static double elapsed_ms_since(const struct timespec* start)
+{ struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (now.tv_sec - start->tv_sec) * 1e3 + (now.tv_nsec - start->tv_nsec) * 1e-6;
+}
+
+SimpleMCParams simplemc_params_from_config(const config_t* cfg)
+{ SimpleMCParams params = {SIMPLEMC_DEFAULT_PLAYOUTS, 0};
+
+  if(cfg != NULL)
+  { if(cfg->ai_budget > 0) params.playouts = cfg->ai_budget;
+    params.time_limit_ms = cfg->ai_time_ms;
+  }
+  return params;
+}
+
+static double mean_result(uint16_t c, const double wins[], const uint32_t visits[])
+{ return visits[c] > 0 ? wins[c] / visits[c] : -1.0;
+}
+
+// Insertion sort, best mean result first
+static void sort_candidates(uint16_t candidates[], uint16_t count,
+                            const double wins[], const uint32_t visits[])
+{ for(uint16_t i = 1; i < count; i++)
+  { uint16_t c = candidates[i];
+    double mean = mean_result(c, wins, visits);
+    int j = i - 1;
+    while(j >= 0 && mean_result(candidates[j], wins, visits) < mean)
+    { candidates[j + 1] = candidates[j];
+      j--;
+    }
+    candidates[j + 1] = c;
+  }
+}
+
+bool simplemc_choose_move(const struct gamestate* gstate, const SimpleMCParams* params,
+                          GameContext* ctx, Action* best, SimpleMCReport* report)
+{ struct timespec start;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+
+  // All search state lives on this stack frame: no heap allocation at all
+  ActionList moves;
+  double wins[MAX_LEGAL_ACTIONS] = {0};
+  uint32_t visits[MAX_LEGAL_ACTIONS] = {0};
+  uint16_t candidates[MAX_LEGAL_ACTIONS];
+  struct gamestate determinized, playout;
+
+  get_search_actions(gstate, &moves);
+  uint16_t num_moves = moves.count;
+  if(num_moves == 0) return false;
+
+  PlayerID observer = gstate->player_to_move;
+  uint32_t playouts = 0;
+
+  // Round sizes: the design schedule, scaled to the playout budget
+  uint16_t keep[SIMPLEMC_ROUNDS];
+  double planned = 0;
+  for(int r = 0; r < SIMPLEMC_ROUNDS; r++)
+  { double k = ceil(pow(num_moves, ROUND_EXPONENT[r]));
+    keep[r] = (uint16_t)fmin(k, ROUND_MAX_KEEP[r]);
+    if(r > 0 && keep[r] > keep[r - 1]) keep[r] = keep[r - 1];
+    planned += (double)ROUND_PLAYOUTS[r] * keep[r];
+  }
+  double scale = params->playouts / planned;
+
+  uint16_t num_candidates = num_moves;
+  for(uint16_t i = 0; i < num_moves; i++)
+    candidates[i] = i;
+
+  bool out_of_time = false;
+  for(int r = 0; r < SIMPLEMC_ROUNDS && num_candidates > 1 && !out_of_time; r++)
+  { uint32_t sims = (uint32_t)fmax(1.0, round(ROUND_PLAYOUTS[r] * scale));
+
+    for(uint32_t s = 0; s < sims; s++)
+    { if(params->time_limit_ms > 0 && elapsed_ms_since(&start) >= params->time_limit_ms)
+      { out_of_time = true;
+        break;
+      }
+
+      // One determinization shared by every candidate (common random numbers
+      // for the hidden cards), then one rollout per candidate
+      clone_gamestate(&determinized, gstate);
+      randomize_hidden_information(&determinized, observer, ctx);
+
+      for(uint16_t i = 0; i < num_candidates; i++)
+      { uint16_t c = candidates[i];
+        clone_gamestate(&playout, &determinized);
+        do_move(&playout, &moves.actions[c], ctx);
+        rollout_random(&playout, ctx);
+        wins[c] += get_result(&playout, observer);
+        visits[c]++;
+      }
+      playouts += num_candidates;
+    }
+
+    sort_candidates(candidates, num_candidates, wins, visits);
+    if(r + 1 < SIMPLEMC_ROUNDS) num_candidates = keep[r + 1];
+  }
+
+  uint16_t chosen = candidates[0];
+  *best = moves.actions[chosen];
+
+  if(report != NULL)
+  { report->num_moves = num_moves;
+    report->playouts = playouts;
+    report->best_mean = mean_result(chosen, wins, visits);
+    report->elapsed_ms = elapsed_ms_since(&start);
+  }
+
+  DEBUG_PRINT(" SimpleMC: %u moves, %u playouts, best move type %u (mean %.3f)\n",
+              num_moves, playouts, best->type, mean_result(chosen, wins, visits));
+  return true;
+} // simplemc_choose_move
+
+static void simplemc_play(struct gamestate* gstate, GameContext* ctx)
+{ SimpleMCParams params = simplemc_params_from_config(ctx->config);
+  Action best;
+
+  if(simplemc_choose_move(gstate, &params, ctx, &best, NULL))
+    apply_action(gstate, gstate->player_to_move, &best, ctx);
+}
+
+void simplemc_attack_strategy(struct gamestate* gstate, GameContext* ctx)
+{ simplemc_play(gstate, ctx);
+}
+
+void simplemc_defense_strategy(struct gamestate* gstate, GameContext* ctx)
+{ simplemc_play(gstate, ctx);
+}
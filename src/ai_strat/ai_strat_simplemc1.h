@@ -0,0 +1,40 @@
+// ai_strat_simplemc1.h
+// Simple Monte Carlo strategy (strat_simplemc1): flat random-rollout search
+// over the legal moves with successive-halving pruning
+
+#ifndef AI_STRAT_SIMPLEMC1_H
+#define AI_STRAT_SIMPLEMC1_H
+
+#include "../core/game_types.h"
+#include "../core/game_context.h"
+#include "ai_strat_lib_search.h"
+
+#define SIMPLEMC_DEFAULT_PLAYOUTS 2000
+
+// Per-decision budget: the pruning schedule is scaled to spend about
+// `playouts` rollouts, and stops early once `time_limit_ms` has elapsed
+typedef struct
+{ uint32_t playouts;      // 0 = SIMPLEMC_DEFAULT_PLAYOUTS
+  uint32_t time_limit_ms; // 0 = no wall-clock limit
+} SimpleMCParams;
+
+typedef struct
+{ uint16_t num_moves;     // legal moves at the root
+  uint32_t playouts;      // rollouts actually run
+  double best_mean;       // mean result of the chosen move
+  double elapsed_ms;
+} SimpleMCReport;
+
+// Budget from the command line (--ai.budget, --ai.time); cfg may be NULL
+SimpleMCParams simplemc_params_from_config(const config_t* cfg);
+
+// Search from gstate (left untouched) for gstate->player_to_move; returns
+// false if there is no legal move. report may be NULL.
+bool simplemc_choose_move(const struct gamestate* gstate, const SimpleMCParams* params,
+                          GameContext* ctx, Action* best, SimpleMCReport* report);
+
+// Strategy functions for StrategySet
+void simplemc_attack_strategy(struct gamestate* gstate, GameContext* ctx);
+void simplemc_defense_strategy(struct gamestate* gstate, GameContext* ctx);
+
+#endif // AI_STRAT_SIMPLEMC1_H
@@ -2,6 +2,10 @@
 // Strategy function pointer framework implementation
 
 #include "ai_strategy.h"
+#include "ai_strat_random.h"
+#include "ai_strat_heuristic1.h"
+#include "ai_strat_simplemc1.h"
+#include "ai_strat_ismcts1.h"
 #include <stdlib.h>
 
 StrategySet* create_strategy_set(void)
@@ -20,3 +24,27 @@ void free_strategy_set(StrategySet* strat)
 { if(strat != NULL)
     free(strat);
 }
+
+bool set_player_strategy_by_type(StrategySet* strat, PlayerID player,
+                                 AIStrategyType type)
+{ switch(type)
+  { case AI_STRATEGY_RANDOM:
+      set_player_strategy(strat, player,
+                          random_attack_strategy, random_defense_strategy);
+      return true;
+    case AI_STRATEGY_HEURISTIC:
+      set_player_strategy(strat, player,
+                          heuristic_attack_strategy, heuristic_defense_strategy);
+      return true;
+    case AI_STRATEGY_SIMPLE_MC:
+      set_player_strategy(strat, player,
+                          simplemc_attack_strategy, simplemc_defense_strategy);
+      return true;
+    case AI_STRATEGY_ISMCTS:
+      set_player_strategy(strat, player,
+                          ismcts_attack_strategy, ismcts_defense_strategy);
+      return true;
+    default:
+      return false;
+  }
+}
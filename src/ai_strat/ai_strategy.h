@@ -6,6 +6,7 @@
 
 #include "../core/game_types.h"
 #include "../core/game_context.h"
+#include "../ui/shared/player_config.h"
 
 // Strategy function pointer types
 typedef void (*AttackStrategyFunc)(struct gamestate* gstate, GameContext* ctx);
@@ -25,4 +26,9 @@ void set_player_strategy(StrategySet* strat, PlayerID player,
                          DefenseStrategyFunc def_func);
 void free_strategy_set(StrategySet* strat);
 
+// Install the strategy functions of an AI agent; returns false if that agent
+// is not implemented yet
+bool set_player_strategy_by_type(StrategySet* strat, PlayerID player,
+                                 AIStrategyType type);
+
 #endif // STRATEGY_H
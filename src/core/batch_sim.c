@@ -0,0 +1,506 @@
+// batch_sim.c
+// Lockstep batch simulator (see batch_sim.h): the card moves of each lane,
+// and the kernels of batch_sim_kernels.h built for AVX-512, AVX2 and scalar
+#include <stdio.h>
+#include <string.h>
+
+#include "batch_sim.h"
+#include "combo_bonus.h"
+#include "game_constants.h"
+#include "../util/xoshiro.h"
+
+// Per card: cost | type << 8 | dice << 16 | attack base << 24; entry
+// BATCH_NO_CARD (an empty combat slot) is all zero
+static int32_t batch_card_info[FULL_DECK_SIZE + 1];
+static float batch_card_power[FULL_DECK_SIZE];
+// Combo profile of each card (BATCH_NO_CARD gets the extra "no card"
+// profile), and the bonus of every profile triple, (c0 * stride + c1) *
+// stride + c2 with stride = profiles + 1
+static int32_t batch_combo_class[FULL_DECK_SIZE + 1];
+static int32_t batch_combo_table[(COMBO_MAX_CLASSES + 1) * (COMBO_MAX_CLASSES + 1) *
+                                 (COMBO_MAX_CLASSES + 1)];
+static int32_t batch_combo_stride;
+
+// ---------------------------------------------------------------------------
+// Kernels
+// ---------------------------------------------------------------------------
+
+// Scalar: one lane per "vector"
+#define BK(name) name##_scalar
+#define BK_NAME "scalar"
+#define VW 1
+typedef int32_t vec_t;
+typedef int32_t mask_t;
+#define V_LOAD_U8(p) ((int32_t)*(p))
+#define V_LOAD_32(p) (*(const int32_t*)(p))
+#define V_STORE_U8(p, v) (*(p) = (uint8_t)(v))
+#define V_STORE_32(p, v) (*(int32_t*)(p) = (v))
+#define V_SET1(x) ((int32_t)(x))
+#define V_ADD(a, b) ((int32_t)((uint32_t)(a) + (uint32_t)(b)))
+#define V_SUB(a, b) ((int32_t)((uint32_t)(a) - (uint32_t)(b)))
+#define V_MUL(a, b) ((int32_t)((uint32_t)(a) * (uint32_t)(b)))
+#define V_AND(a, b) ((a) & (b))
+#define V_XOR(a, b) ((a) ^ (b))
+#define V_MAX(a, b) ((a) > (b) ? (a) : (b))
+#define V_MIN(a, b) ((a) < (b) ? (a) : (b))
+#define V_SHL(v, n) ((int32_t)((uint32_t)(v) << (n)))
+#define V_SHR(v, n) ((int32_t)((uint32_t)(v) >> (n)))
+#define V_GATHER(table, idx) ((table)[idx])
+#define V_BLEND(m, a, b) ((m) ? (a) : (b))
+#define V_ADD_IF(v, m, x) ((m) ? V_ADD(v, x) : (v))
+#define M_EQ(a, b) ((a) == (b))
+#define M_GT(a, b) ((a) > (b))
+#define M_AND(a, b) ((a) & (b))
+#define M_OR(a, b) ((a) | (b))
+#define M_ANDNOT(a, b) ((!(a)) & (b))
+#define M_ANY(m) (m)
+#include "batch_sim_kernels.h"
+#undef BK
+#undef BK_NAME
+#undef VW
+#undef V_LOAD_U8
+#undef V_LOAD_32
+#undef V_STORE_U8
+#undef V_STORE_32
+#undef V_SET1
+#undef V_ADD
+#undef V_SUB
+#undef V_MUL
+#undef V_AND
+#undef V_XOR
+#undef V_MAX
+#undef V_MIN
+#undef V_SHL
+#undef V_SHR
+#undef V_GATHER
+#undef V_BLEND
+#undef V_ADD_IF
+#undef M_EQ
+#undef M_GT
+#undef M_AND
+#undef M_OR
+#undef M_ANDNOT
+#undef M_ANY
+
+#if defined(__x86_64__) || defined(__i386__)
+#define BATCH_SIM_X86 1
+#include <immintrin.h>
+
+// AVX2: 8 lanes, masks are all-ones lanes
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#define BK(name) name##_avx2
+#define BK_NAME "avx2"
+#define VW 8
+#define vec_t __m256i
+#define mask_t __m256i
+static inline void avx2_store_u8(uint8_t* p, __m256i v)
+{ __m128i w = _mm_packus_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+  _mm_storel_epi64((__m128i*)p, _mm_packus_epi16(w, w));
+}
+#define V_LOAD_U8(p) _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*)(p)))
+#define V_LOAD_32(p) _mm256_loadu_si256((const __m256i*)(p))
+#define V_STORE_U8(p, v) avx2_store_u8(p, v)
+#define V_STORE_32(p, v) _mm256_storeu_si256((__m256i*)(p), v)
+#define V_SET1(x) _mm256_set1_epi32(x)
+#define V_ADD(a, b) _mm256_add_epi32(a, b)
+#define V_SUB(a, b) _mm256_sub_epi32(a, b)
+#define V_MUL(a, b) _mm256_mullo_epi32(a, b)
+#define V_AND(a, b) _mm256_and_si256(a, b)
+#define V_XOR(a, b) _mm256_xor_si256(a, b)
+#define V_MAX(a, b) _mm256_max_epi32(a, b)
+#define V_MIN(a, b) _mm256_min_epi32(a, b)
+#define V_SHL(v, n) _mm256_slli_epi32(v, n)
+#define V_SHR(v, n) _mm256_srli_epi32(v, n)
+#define V_GATHER(table, idx) _mm256_i32gather_epi32(table, idx, 4)
+#define V_BLEND(m, a, b) _mm256_blendv_epi8(b, a, m)
+#define V_ADD_IF(v, m, x) _mm256_add_epi32(v, _mm256_and_si256(m, x))
+#define M_EQ(a, b) _mm256_cmpeq_epi32(a, b)
+#define M_GT(a, b) _mm256_cmpgt_epi32(a, b)
+#define M_AND(a, b) _mm256_and_si256(a, b)
+#define M_OR(a, b) _mm256_or_si256(a, b)
+#define M_ANDNOT(a, b) _mm256_andnot_si256(a, b)
+#define M_ANY(m) (!_mm256_testz_si256(m, m))
+#include "batch_sim_kernels.h"
+#undef BK
+#undef BK_NAME
+#undef VW
+#undef vec_t
+#undef mask_t
+#undef V_LOAD_U8
+#undef V_LOAD_32
+#undef V_STORE_U8
+#undef V_STORE_32
+#undef V_SET1
+#undef V_ADD
+#undef V_SUB
+#undef V_MUL
+#undef V_AND
+#undef V_XOR
+#undef V_MAX
+#undef V_MIN
+#undef V_SHL
+#undef V_SHR
+#undef V_GATHER
+#undef V_BLEND
+#undef V_ADD_IF
+#undef M_EQ
+#undef M_GT
+#undef M_AND
+#undef M_OR
+#undef M_ANDNOT
+#undef M_ANY
+#pragma GCC pop_options
+
+// AVX-512: all 16 lanes in one vector, masks are mask registers
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+#define BK(name) name##_avx512
+#define BK_NAME "avx512"
+#define VW 16
+#define vec_t __m512i
+#define mask_t __mmask16
+#define V_LOAD_U8(p) _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)(p)))
+#define V_LOAD_32(p) _mm512_loadu_si512((const void*)(p))
+#define V_STORE_U8(p, v) _mm_storeu_si128((__m128i*)(p), _mm512_cvtepi32_epi8(v))
+#define V_STORE_32(p, v) _mm512_storeu_si512((void*)(p), v)
+#define V_SET1(x) _mm512_set1_epi32(x)
+#define V_ADD(a, b) _mm512_add_epi32(a, b)
+#define V_SUB(a, b) _mm512_sub_epi32(a, b)
+#define V_MUL(a, b) _mm512_mullo_epi32(a, b)
+#define V_AND(a, b) _mm512_and_si512(a, b)
+#define V_XOR(a, b) _mm512_xor_si512(a, b)
+#define V_MAX(a, b) _mm512_max_epi32(a, b)
+#define V_MIN(a, b) _mm512_min_epi32(a, b)
+#define V_SHL(v, n) _mm512_slli_epi32(v, n)
+#define V_SHR(v, n) _mm512_srli_epi32(v, n)
+#define V_GATHER(table, idx) _mm512_i32gather_epi32(idx, table, 4)
+#define V_BLEND(m, a, b) _mm512_mask_blend_epi32(m, b, a)
+#define V_ADD_IF(v, m, x) _mm512_mask_add_epi32(v, m, v, x)
+#define M_EQ(a, b) _mm512_cmpeq_epi32_mask(a, b)
+#define M_GT(a, b) _mm512_cmpgt_epi32_mask(a, b)
+#define M_AND(a, b) ((__mmask16)((a) & (b)))
+#define M_OR(a, b) ((__mmask16)((a) | (b)))
+#define M_ANDNOT(a, b) ((__mmask16)(~(a) & (b)))
+#define M_ANY(m) ((m) != 0)
+#include "batch_sim_kernels.h"
+#pragma GCC pop_options
+#endif
+
+bool batch_sim_isa_supported(BatchIsa isa)
+{ switch(isa)
+  { case BATCH_ISA_AUTO:
+    case BATCH_ISA_SCALAR:
+      return true;
+#ifdef BATCH_SIM_X86
+    case BATCH_ISA_AVX2:
+      return __builtin_cpu_supports("avx2");
+    case BATCH_ISA_AVX512:
+      return __builtin_cpu_supports("avx512f");
+#endif
+    default:
+      return false;
+  }
+}
+
+static const BatchKernels* batch_kernels_for(BatchIsa isa)
+{ if(isa == BATCH_ISA_AUTO)
+  { for(isa = BATCH_ISA_COUNT - 1; !batch_sim_isa_supported(isa); isa--)
+      ;
+  }
+  switch(isa)
+  {
+#ifdef BATCH_SIM_X86
+    case BATCH_ISA_AVX512:
+      return &kernels_avx512;
+    case BATCH_ISA_AVX2:
+      return &kernels_avx2;
+#endif
+    default:
+      return &kernels_scalar;
+  }
+}
+
+static void batch_tables_init(void)
+{ for(int c = 0; c < FULL_DECK_SIZE; c++)
+  { const struct card* card = &fullDeck[c];
+    batch_card_info[c] = card->cost | card->card_type << 8 | card->defense_dice << 16 |
+                         card->attack_base << 24;
+    batch_card_power[c] = card->power;
+  }
+  batch_card_info[BATCH_NO_CARD] = 0;
+
+  // A card of each profile, to look the bonuses up with
+  int classes = combo_class_count();
+  uint8_t example[COMBO_MAX_CLASSES];
+  for(int c = FULL_DECK_SIZE - 1; c >= 0; c--)
+  { batch_combo_class[c] = combo_class_of((uint8_t)c);
+    example[batch_combo_class[c]] = (uint8_t)c;
+  }
+  batch_combo_class[BATCH_NO_CARD] = classes;
+  batch_combo_stride = classes + 1;
+
+  for(int c0 = 0; c0 <= classes; c0++)
+    for(int c1 = 0; c1 <= classes; c1++)
+      for(int c2 = 0; c2 <= classes; c2++)
+      { const int profile[3] = {c0, c1, c2};
+        uint8_t cards[3];
+        int n = 0;
+        for(int k = 0; k < 3; k++)
+          if(profile[k] < classes) cards[n++] = example[profile[k]];
+        batch_combo_table[(c0 * batch_combo_stride + c1) * batch_combo_stride + c2] =
+          combo_bonus_lookup(cards, n, DECK_RANDOM);
+      }
+} // batch_tables_init
+
+// ---------------------------------------------------------------------------
+// Per-lane card moves
+// ---------------------------------------------------------------------------
+
+static uint32_t lane_next(BatchSim* bs, int l)
+{ uint32_t* s0 = &bs->rng[0][l], *s1 = &bs->rng[1][l], *s2 = &bs->rng[2][l], *s3 = &bs->rng[3][l];
+  uint32_t x = *s1 * 5;
+  uint32_t r = ((x << 7) | (x >> 25)) * 9;
+  uint32_t t = *s1 << 9;
+  *s2 ^= *s0;
+  *s3 ^= *s1;
+  *s1 ^= *s2;
+  *s0 ^= *s3;
+  *s2 ^= t;
+  *s3 = (*s3 << 11) | (*s3 >> 21);
+  return r;
+}
+
+static uint8_t lane_randn(BatchSim* bs, int l, uint8_t n)
+{ return (uint8_t)(((uint64_t)lane_next(bs, l) * n) >> 32);
+}
+
+// Like Hand_add(), a card past the last slot is lost (10 is the most a hand
+// reaches)
+static void hand_add(BatchSim* bs, int p, int l, uint8_t card)
+{ if(bs->hand_size[p][l] < BATCH_HAND_SLOTS)
+    bs->hand[p][bs->hand_size[p][l]++][l] = card;
+}
+
+// Remove the card in slot s, keeping the others in order (Hand_remove())
+static uint8_t hand_take(BatchSim* bs, int p, int l, uint8_t s)
+{ uint8_t card = bs->hand[p][s][l];
+  uint8_t n = --bs->hand_size[p][l];
+  for(uint8_t k = s; k < n; k++)
+    bs->hand[p][k][l] = bs->hand[p][k + 1][l];
+  return card;
+}
+
+static void discard_add(BatchSim* bs, int p, int l, uint8_t card)
+{ bs->discard[p][bs->discard_size[p][l]++][l] = card;
+}
+
+// draw_1_card() on a lazy deck: an empty deck takes the discard back, and a
+// draw is a uniformly random card of the deck
+static void lane_draw(BatchSim* bs, int p, int l)
+{ if(bs->deck_size[p][l] == 0)
+  { for(uint8_t k = 0; k < bs->discard_size[p][l]; k++)
+      bs->deck[p][k][l] = bs->discard[p][k][l];
+    bs->deck_size[p][l] = bs->discard_size[p][l];
+    bs->discard_size[p][l] = 0;
+    if(bs->deck_size[p][l] == 0) return;
+  }
+  uint8_t n = --bs->deck_size[p][l];
+  uint8_t k = lane_randn(bs, l, n + 1);
+  uint8_t card = bs->deck[p][k][l];
+  bs->deck[p][k][l] = bs->deck[p][n][l];
+  hand_add(bs, p, l, card);
+}
+
+// Slot of the first lowest-power card of the hand (champions only if asked)
+static uint8_t lowest_power_slot(const BatchSim* bs, int p, int l, bool champions_only)
+{ float min_power = 100.0;
+  uint8_t slot = 0xff;
+  for(uint8_t k = 0; k < bs->hand_size[p][l]; k++)
+  { uint8_t card = bs->hand[p][k][l];
+    if(champions_only && fullDeck[card].card_type != CHAMPION_CARD) continue;
+    if(batch_card_power[card] < min_power)
+    { min_power = batch_card_power[card];
+      slot = k;
+    }
+  }
+  return slot;
+}
+
+// setup_game() and apply_mulligan()
+static void lane_start_game(BatchSim* bs, int l)
+{ uint8_t pool[FULL_DECK_SIZE];
+  for(uint8_t i = 0; i < FULL_DECK_SIZE; i++)
+    pool[i] = i;
+  for(uint8_t i = 0; i < 2 * MAX_DECK_STACK_SIZE; i++)
+  { uint8_t j = i + lane_randn(bs, l, FULL_DECK_SIZE - i);
+    uint8_t t = pool[i];
+    pool[i] = pool[j];
+    pool[j] = t;
+  }
+  for(int p = 0; p < 2; p++)
+  { for(uint8_t i = 0; i < MAX_DECK_STACK_SIZE; i++)
+      bs->deck[p][i][l] = pool[2 * i + p];
+    bs->deck_size[p][l] = MAX_DECK_STACK_SIZE;
+    bs->hand_size[p][l] = 0;
+    bs->discard_size[p][l] = 0;
+    bs->combat_size[p][l] = 0;
+    for(int k = 0; k < BATCH_COMBAT_SLOTS; k++)
+      bs->combat[p][k][l] = BATCH_NO_CARD;
+    bs->energy[p][l] = INITIAL_ENERGY_DEFAULT;
+    bs->cash[p][l] = bs->initial_cash;
+    // The deal is in random order: the top six are as good as any six
+    for(uint8_t i = 0; i < INITAL_HAND_SIZE_DEFAULT; i++)
+      hand_add(bs, p, l, bs->deck[p][--bs->deck_size[p][l]][l]);
+  }
+
+  // Player B gives back up to 2 cards under the average power
+  uint8_t mulligan = 0;
+  for(uint8_t k = 0; k < bs->hand_size[PLAYER_B][l] && mulligan < 2; k++)
+    if(batch_card_power[bs->hand[PLAYER_B][k][l]] < AVERAGE_POWER_FOR_MULLIGAN)
+      mulligan++;
+  for(uint8_t i = 0; i < mulligan; i++)
+    discard_add(bs, PLAYER_B, l,
+                hand_take(bs, PLAYER_B, l, lowest_power_slot(bs, PLAYER_B, l, false)));
+  for(uint8_t i = 0; i < mulligan; i++)
+    lane_draw(bs, PLAYER_B, l);
+
+  bs->turn[l] = 0;
+  bs->active[l] = 1;
+} // lane_start_game
+
+// The attacker's chosen card: a champion to the combat zone, a draw card
+// (draw_num cards, then to the discard), or a cash card exchanged for the
+// lowest-power champion
+static void lane_play_attack(BatchSim* bs, int l, uint8_t slot)
+{ const int p = bs->attacker;
+  uint8_t card = hand_take(bs, p, l, slot);
+  bs->cash[p][l] -= fullDeck[card].cost;
+  switch(fullDeck[card].card_type)
+  { case CHAMPION_CARD:
+      bs->combat[p][bs->combat_size[p][l]++][l] = card;
+      break;
+    case DRAW_CARD:
+      for(uint8_t i = 0; i < fullDeck[card].draw_num; i++)
+        lane_draw(bs, p, l);
+      discard_add(bs, p, l, card);
+      break;
+    case CASH_CARD:
+      discard_add(bs, p, l, hand_take(bs, p, l, lowest_power_slot(bs, p, l, true)));
+      bs->cash[p][l] += fullDeck[card].exchange_cash;
+      discard_add(bs, p, l, card);
+      break;
+  }
+}
+
+static void lane_clear_combat(BatchSim* bs, int l)
+{ for(int p = bs->attacker, i = 0; i < 2; p = 1 - p, i++)
+  { for(uint8_t k = 0; k < bs->combat_size[p][l]; k++)
+    { discard_add(bs, p, l, bs->combat[p][k][l]);
+      bs->combat[p][k][l] = BATCH_NO_CARD;
+    }
+    bs->combat_size[p][l] = 0;
+  }
+}
+
+// end_of_turn(): a luna, and the hand down to 7 by lowest power
+static void lane_end_turn(BatchSim* bs, int l)
+{ const int p = bs->attacker;
+  bs->cash[p][l]++;
+  while(bs->hand_size[p][l] > 7)
+    discard_add(bs, p, l, hand_take(bs, p, l, lowest_power_slot(bs, p, l, false)));
+}
+
+// ---------------------------------------------------------------------------
+// Batch
+// ---------------------------------------------------------------------------
+
+bool batch_sim_init(BatchSim* bs, uint64_t num_games, uint16_t initial_cash,
+                    uint64_t seed, BatchIsa isa)
+{ if(!batch_sim_isa_supported(isa)) return false;
+  if(batch_combo_stride == 0)
+    batch_tables_init();
+
+  memset(bs, 0, sizeof(*bs));
+  bs->kernels = batch_kernels_for(isa);
+  bs->games_left = num_games;
+  bs->initial_cash = initial_cash;
+  bs->attacker = PLAYER_A;
+
+  // splitmix64 of the seed for every lane's state (never all zero)
+  for(int l = 0; l < BATCH_LANES; l++)
+    for(int w = 0; w < 4; w += 2)
+    { uint64_t z = mix64(seed += 0x9e3779b97f4a7c15ULL);
+      bs->rng[w][l] = (uint32_t)z;
+      bs->rng[w + 1][l] = (uint32_t)(z >> 32) | 1;
+    }
+  for(int p = 0; p < 2; p++)
+    for(int k = 0; k < BATCH_COMBAT_SLOTS; k++)
+      memset(bs->combat[p][k], BATCH_NO_CARD, BATCH_LANES);
+  return true;
+} // batch_sim_init
+
+bool batch_sim_done(const BatchSim* bs)
+{ if(bs->games_left > 0) return false;
+  for(int l = 0; l < BATCH_LANES; l++)
+    if(bs->active[l]) return false;
+  return true;
+}
+
+uint32_t batch_sim_step(BatchSim* bs, BatchResult results[BATCH_LANES])
+{ const int a = bs->attacker, d = 1 - a;
+  uint32_t num_results = 0;
+  uint8_t slot[BATCH_LANES];
+
+  // begin_of_turn()
+  for(int l = 0; l < BATCH_LANES; l++)
+  { if(!bs->active[l])
+    { if(a != PLAYER_A || bs->games_left == 0) continue;
+      bs->games_left--;
+      lane_start_game(bs, l);
+    }
+    if(++bs->turn[l] > 1)
+      lane_draw(bs, a, l);
+  }
+
+  // Attack, defense if anyone attacked, combat
+  bs->kernels->choose_attack(bs, slot);
+  bool combat = false;
+  for(int l = 0; l < BATCH_LANES; l++)
+  { if(bs->active[l] && slot[l] != 0xff)
+      lane_play_attack(bs, l, slot[l]);
+    combat |= bs->combat_size[a][l] > 0;
+  }
+  if(combat)
+  { bs->kernels->choose_defense(bs, slot);
+    for(int l = 0; l < BATCH_LANES; l++)
+    { if(bs->combat_size[a][l] == 0 || slot[l] == 0xff) continue;
+      uint8_t card = hand_take(bs, d, l, slot[l]);
+      bs->cash[d][l] -= fullDeck[card].cost;
+      bs->combat[d][bs->combat_size[d][l]++][l] = card;
+    }
+    bs->kernels->resolve_combat(bs);
+  }
+
+  // Clear the zones, then end of turn or end of game
+  for(int l = 0; l < BATCH_LANES; l++)
+  { if(!bs->active[l]) continue;
+    if(bs->combat_size[a][l] > 0)
+      lane_clear_combat(bs, l);
+    uint8_t game_state = ACTIVE;
+    if(bs->energy[d][l] == 0)
+      game_state = a == PLAYER_A ? PLAYER_A_WINS : PLAYER_B_WINS;
+    else
+    { lane_end_turn(bs, l);
+      if(bs->turn[l] >= MAX_NUMBER_OF_TURNS)
+        game_state = DRAW;
+    }
+    if(game_state != ACTIVE)
+    { results[num_results++] = (BatchResult){bs->turn[l], game_state};
+      bs->active[l] = 0;
+    }
+  }
+
+  bs->attacker = d;
+  return num_results;
+} // batch_sim_step
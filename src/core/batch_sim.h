@@ -0,0 +1,87 @@
+// batch_sim.h
+// Lockstep batch simulator: BATCH_LANES random-vs-random stda.auto games
+// advanced one turn at a time together, with the game state laid out as
+// structures of arrays ([player][slot][lane]) so that the random policy and
+// combat resolution run as vector operations over the lanes (AVX-512, AVX2,
+// or a scalar build of the same kernels; picked at run time).
+//
+// Every lane plays the rules of play_stda_auto_game() with the random
+// strategy on both seats: same deal, mulligan, draws, card choices, combat
+// and end of turn. What is not reproduced is the engine's random stream:
+// each lane has its own xoshiro128** generator, and decks are drawn from
+// lazily (a uniformly random card, see draw_1_card()), so results match
+// run_simulation() in distribution, not game for game. Games run on the
+// same thread in every lane start together on player A's turn, so all lanes
+// always have the same attacker; a lane whose game ends on B's turn waits
+// one turn for the next.
+
+#ifndef BATCH_SIM_H
+#define BATCH_SIM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "../structures/deckstack.h"
+
+#define BATCH_LANES 16
+#define BATCH_HAND_SLOTS 12
+#define BATCH_COMBAT_SLOTS 3
+#define BATCH_NO_CARD 120   // FULL_DECK_SIZE: an empty combat slot
+
+typedef enum
+{ BATCH_ISA_AUTO = 0,     // the widest the CPU supports
+  BATCH_ISA_SCALAR,
+  BATCH_ISA_AVX2,
+  BATCH_ISA_AVX512,
+  BATCH_ISA_COUNT
+} BatchIsa;
+
+typedef struct
+{ uint16_t turns;
+  uint8_t game_state;     // PLAYER_A_WINS, PLAYER_B_WINS or DRAW
+} BatchResult;
+
+typedef struct BatchSim BatchSim;
+
+// The vector parts of a turn, built once per instruction set
+typedef struct
+{ const char* name;
+  void (*choose_attack)(BatchSim* bs, uint8_t slot[BATCH_LANES]);
+  void (*choose_defense)(BatchSim* bs, uint8_t slot[BATCH_LANES]);
+  void (*resolve_combat)(BatchSim* bs);
+} BatchKernels;
+
+struct BatchSim
+{ // Card piles: card index of each slot, lane-minor
+  uint8_t hand[2][BATCH_HAND_SLOTS][BATCH_LANES];
+  uint8_t deck[2][MAX_DECK_STACK_SIZE][BATCH_LANES];     // unordered
+  uint8_t discard[2][MAX_DECK_STACK_SIZE][BATCH_LANES];
+  uint8_t combat[2][BATCH_COMBAT_SLOTS][BATCH_LANES];    // BATCH_NO_CARD if empty
+  uint8_t hand_size[2][BATCH_LANES];
+  uint8_t deck_size[2][BATCH_LANES];
+  uint8_t discard_size[2][BATCH_LANES];
+  uint8_t combat_size[2][BATCH_LANES];
+  // 32 bits wide, the kernels' lane width
+  int32_t energy[2][BATCH_LANES];
+  int32_t cash[2][BATCH_LANES];
+  uint32_t rng[4][BATCH_LANES];     // xoshiro128** state of each lane
+  uint16_t turn[BATCH_LANES];
+  uint8_t active[BATCH_LANES];      // a game is in progress in the lane
+  uint8_t attacker;                 // current player, the same in every lane
+  uint64_t games_left;              // games not started yet
+  uint16_t initial_cash;
+  const BatchKernels* kernels;
+};
+
+// Whether this build and CPU can run the kernels of isa
+bool batch_sim_isa_supported(BatchIsa isa);
+// Set bs up to play num_games games; false if isa is not supported.
+// combo_bonus_init() must have run.
+bool batch_sim_init(BatchSim* bs, uint64_t num_games, uint16_t initial_cash,
+                    uint64_t seed, BatchIsa isa);
+// Play one turn in every lane (starting games in the idle lanes on A's
+// turns); the games that ended go to results, and their number is returned
+uint32_t batch_sim_step(BatchSim* bs, BatchResult results[BATCH_LANES]);
+bool batch_sim_done(const BatchSim* bs);
+
+#endif // BATCH_SIM_H
@@ -0,0 +1,175 @@
+// batch_sim_kernels.h
+// The vector kernels of the batch simulator, written once against the small
+// set of lane operations below and included by batch_sim.c once per
+// instruction set. The includer defines:
+//   BK(name)                 the kernel's name for this instruction set
+//   VW                       lanes per vector (BATCH_LANES is a multiple)
+//   vec_t, mask_t            32-bit lanes, and a per-lane condition
+//   V_LOAD_U8(p), V_LOAD_32(p), V_STORE_U8(p, v), V_STORE_32(p, v)
+//   V_SET1(x), V_ADD, V_SUB, V_MUL, V_AND, V_XOR, V_MAX, V_MIN (signed)
+//   V_SHL(v, n), V_SHR(v, n)  (logical)
+//   V_GATHER(table, idx)     table[idx] per lane, int32_t table
+//   V_BLEND(m, a, b)         m ? a : b per lane
+//   V_ADD_IF(v, m, x)        v + (m ? x : 0) per lane
+//   M_EQ(a, b), M_GT(a, b)   (signed)
+//   M_AND(a, b), M_OR(a, b), M_ANDNOT(a, b) (~a & b), M_ANY(m)
+// and the tables batch_card_info, batch_combo_class, batch_combo_table and
+// batch_combo_stride (see batch_sim.c).
+
+#define V_ROTL(v, n) V_XOR(V_SHL(v, n), V_SHR(v, 32 - (n)))
+// Uniform in [0, n) from the high half of a 32-bit draw (n < 2^16)
+#define V_BOUNDED(r, n) V_SHR(V_MUL(V_SHR(r, 16), n), 16)
+#define V_CARD_COST(info) V_AND(info, V_SET1(0xff))
+#define V_CARD_TYPE(info) V_AND(V_SHR(info, 8), V_SET1(0xff))
+#define V_CARD_DICE(info) V_AND(V_SHR(info, 16), V_SET1(0xff))
+#define V_CARD_BASE(info) V_SHR(info, 24)
+
+// Next xoshiro128** output of every lane
+static void BK(rng_next)(uint32_t s[4][BATCH_LANES], uint32_t out[BATCH_LANES])
+{ for(int l = 0; l < BATCH_LANES; l += VW)
+  { vec_t s0 = V_LOAD_32(&s[0][l]), s1 = V_LOAD_32(&s[1][l]);
+    vec_t s2 = V_LOAD_32(&s[2][l]), s3 = V_LOAD_32(&s[3][l]);
+    vec_t r = V_MUL(V_ROTL(V_MUL(s1, V_SET1(5)), 7), V_SET1(9));
+    vec_t t = V_SHL(s1, 9);
+    s2 = V_XOR(s2, s0);
+    s3 = V_XOR(s3, s1);
+    s1 = V_XOR(s1, s2);
+    s0 = V_XOR(s0, s3);
+    s2 = V_XOR(s2, t);
+    s3 = V_ROTL(s3, 11);
+    V_STORE_32(&s[0][l], s0);
+    V_STORE_32(&s[1][l], s1);
+    V_STORE_32(&s[2][l], s2);
+    V_STORE_32(&s[3][l], s3);
+    V_STORE_32(&out[l], r);
+  }
+}
+
+// Slot of the k-th (0-based, k = choice) eligible card, 0xff if none is
+static inline vec_t BK(nth_eligible)(const mask_t eligible[BATCH_HAND_SLOTS], vec_t choice)
+{ vec_t slot = V_SET1(0xff), seen = V_SET1(0);
+  for(int k = 0; k < BATCH_HAND_SLOTS; k++)
+  { slot = V_BLEND(M_AND(eligible[k], M_EQ(seen, choice)), V_SET1(k), slot);
+    seen = V_ADD_IF(seen, eligible[k], V_SET1(1));
+  }
+  return slot;
+}
+
+// random_attack_strategy(): one affordable card of the attacker's hand,
+// uniformly; a cash card only if a champion is there to exchange
+static void BK(choose_attack)(BatchSim* bs, uint8_t slot_out[BATCH_LANES])
+{ const uint8_t p = bs->attacker;
+  uint32_t r[BATCH_LANES];
+  BK(rng_next)(bs->rng, r);
+
+  for(int l = 0; l < BATCH_LANES; l += VW)
+  { vec_t size = V_LOAD_U8(&bs->hand_size[p][l]);
+    vec_t cash = V_LOAD_32(&bs->cash[p][l]);
+    vec_t info[BATCH_HAND_SLOTS];
+    mask_t held[BATCH_HAND_SLOTS];
+    mask_t champion_held = M_GT(V_SET1(0), V_SET1(0));
+    for(int k = 0; k < BATCH_HAND_SLOTS; k++)
+    { info[k] = V_GATHER(batch_card_info, V_LOAD_U8(&bs->hand[p][k][l]));
+      held[k] = M_GT(size, V_SET1(k));
+      champion_held = M_OR(champion_held,
+                           M_AND(held[k], M_EQ(V_CARD_TYPE(info[k]), V_SET1(CHAMPION_CARD))));
+    }
+
+    mask_t eligible[BATCH_HAND_SLOTS];
+    vec_t count = V_SET1(0);
+    for(int k = 0; k < BATCH_HAND_SLOTS; k++)
+    { mask_t affordable = M_ANDNOT(M_GT(V_CARD_COST(info[k]), cash), held[k]);
+      mask_t idle_cash = M_ANDNOT(champion_held, M_EQ(V_CARD_TYPE(info[k]), V_SET1(CASH_CARD)));
+      eligible[k] = M_ANDNOT(idle_cash, affordable);
+      count = V_ADD_IF(count, eligible[k], V_SET1(1));
+    }
+    vec_t choice = V_BOUNDED(V_LOAD_32(&r[l]), count);
+    V_STORE_U8(&slot_out[l], BK(nth_eligible)(eligible, choice));
+  }
+}
+
+// random_defense_strategy(): 47% of the time, one affordable champion of the
+// defender's hand, uniformly
+static void BK(choose_defense)(BatchSim* bs, uint8_t slot_out[BATCH_LANES])
+{ const uint8_t d = 1 - bs->attacker;
+  uint32_t u[BATCH_LANES], r[BATCH_LANES];
+  BK(rng_next)(bs->rng, u);
+  BK(rng_next)(bs->rng, r);
+  // u / 2^32 > 0.47 passes; compared on 31 bits, the lanes being signed
+  const int32_t pass_above = (int32_t)(0.47 * 2147483648.0);
+
+  for(int l = 0; l < BATCH_LANES; l += VW)
+  { vec_t size = V_LOAD_U8(&bs->hand_size[d][l]);
+    vec_t cash = V_LOAD_32(&bs->cash[d][l]);
+    mask_t defends = M_ANDNOT(M_GT(V_SHR(V_LOAD_32(&u[l]), 1), V_SET1(pass_above)),
+                              M_GT(size, V_SET1(0)));
+    mask_t eligible[BATCH_HAND_SLOTS];
+    vec_t count = V_SET1(0);
+    for(int k = 0; k < BATCH_HAND_SLOTS; k++)
+    { vec_t info = V_GATHER(batch_card_info, V_LOAD_U8(&bs->hand[d][k][l]));
+      mask_t champion = M_AND(M_GT(size, V_SET1(k)),
+                              M_EQ(V_CARD_TYPE(info), V_SET1(CHAMPION_CARD)));
+      eligible[k] = M_AND(defends, M_ANDNOT(M_GT(V_CARD_COST(info), cash), champion));
+      count = V_ADD_IF(count, eligible[k], V_SET1(1));
+    }
+    vec_t choice = V_BOUNDED(V_LOAD_32(&r[l]), count);
+    V_STORE_U8(&slot_out[l], BK(nth_eligible)(eligible, choice));
+  }
+}
+
+// Combo profile index of a combat zone's slots (empty slots included)
+static inline vec_t BK(combo_index)(const uint8_t zone[BATCH_COMBAT_SLOTS][BATCH_LANES], int l)
+{ vec_t index = V_SET1(0);
+  for(int k = 0; k < BATCH_COMBAT_SLOTS; k++)
+    index = V_ADD(V_MUL(index, V_SET1(batch_combo_stride)),
+                  V_GATHER(batch_combo_class, V_LOAD_U8(&zone[k][l])));
+  return index;
+}
+
+// resolve_combat() in the lanes where the attacker has champions out:
+// base + roll per attacker, roll per defender, combo bonus on each side, and
+// the damage to the defender's energy. The zones are emptied by the caller.
+static void BK(resolve_combat)(BatchSim* bs)
+{ const uint8_t a = bs->attacker, d = 1 - a;
+  // One die per slot in use in any lane
+  uint32_t roll_a[BATCH_COMBAT_SLOTS][BATCH_LANES], roll_d[BATCH_COMBAT_SLOTS][BATCH_LANES];
+  uint8_t slots_a = 0, slots_d = 0;
+  for(int l = 0; l < BATCH_LANES; l++)
+  { slots_a = bs->combat_size[a][l] > slots_a ? bs->combat_size[a][l] : slots_a;
+    slots_d = bs->combat_size[d][l] > slots_d ? bs->combat_size[d][l] : slots_d;
+  }
+  if(slots_a == 0) return;
+  for(int k = 0; k < slots_a; k++)
+    BK(rng_next)(bs->rng, roll_a[k]);
+  for(int k = 0; k < slots_d; k++)
+    BK(rng_next)(bs->rng, roll_d[k]);
+
+  for(int l = 0; l < BATCH_LANES; l += VW)
+  { mask_t fight = M_GT(V_LOAD_U8(&bs->combat_size[a][l]), V_SET1(0));
+    if(!M_ANY(fight)) continue;
+
+    vec_t attack = V_GATHER(batch_combo_table, BK(combo_index)(bs->combat[a], l));
+    vec_t defense = V_GATHER(batch_combo_table, BK(combo_index)(bs->combat[d], l));
+    // An empty slot has 0 dice and base 0, and rolls 0
+    for(int k = 0; k < slots_a; k++)
+    { vec_t info = V_GATHER(batch_card_info, V_LOAD_U8(&bs->combat[a][k][l]));
+      vec_t dice = V_CARD_DICE(info);
+      vec_t roll = V_ADD(V_BOUNDED(V_LOAD_32(&roll_a[k][l]), dice), V_MIN(dice, V_SET1(1)));
+      attack = V_ADD(attack, V_ADD(V_CARD_BASE(info), roll));
+    }
+    for(int k = 0; k < slots_d; k++)
+    { vec_t dice = V_CARD_DICE(V_GATHER(batch_card_info, V_LOAD_U8(&bs->combat[d][k][l])));
+      vec_t roll = V_ADD(V_BOUNDED(V_LOAD_32(&roll_d[k][l]), dice), V_MIN(dice, V_SET1(1)));
+      defense = V_ADD(defense, roll);
+    }
+
+    vec_t damage = V_MAX(V_SUB(attack, defense), V_SET1(0));
+    vec_t energy = V_LOAD_32(&bs->energy[d][l]);
+    energy = V_BLEND(fight, V_MAX(V_SUB(energy, damage), V_SET1(0)), energy);
+    V_STORE_32(&bs->energy[d][l], energy);
+  }
+}
+
+static const BatchKernels BK(kernels) =
+{ BK_NAME, BK(choose_attack), BK(choose_defense), BK(resolve_combat)
+};
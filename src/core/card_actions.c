@@ -5,8 +5,10 @@
 
 #include "card_actions.h"
 #include "game_constants.h"
+#include "zobrist.h"
 #include "../util/rnd.h"
 #include "../util/debug.h"
+#include "../util/profile.h"
 
 int has_champion_in_hand(Hand* hand)
 { for(uint8_t i = 0; i < hand->size; i++)
@@ -78,6 +80,7 @@ void play_champion(struct gamestate* gstate, PlayerID player, uint8_t card_idx,
 
   // Remove from hand
   Hand_remove(&gstate->hand[player], card_idx);
+  zobrist_move_card(gstate, player, ZOBRIST_HAND, ZOBRIST_COMBAT, card_idx);
 
   // Pay cost
   gstate->current_cash_balance[player] -= fullDeck[card_idx].cost;
@@ -101,8 +104,29 @@ void play_draw_card(struct gamestate* gstate, PlayerID player, uint8_t card_idx,
 
   // Move the draw card to discard
   Discard_add(&gstate->discard[player], card_idx);
+  zobrist_move_card(gstate, player, ZOBRIST_HAND, ZOBRIST_DISCARD, card_idx);
 }
 
+// Recall path of a draw/recall card: the chosen champions (exactly choose_num,
+// see doc/game_rules_doc.md) go back from discard to hand instead of drawing.
+void play_recall_card(struct gamestate* gstate, PlayerID player, uint8_t card_idx,
+                      const uint8_t* champions, uint8_t count, GameContext* ctx)
+{ // Remove draw/recall card from hand, pay cost, discard it
+  Hand_remove(&gstate->hand[player], card_idx);
+  gstate->current_cash_balance[player] -= fullDeck[card_idx].cost;
+  Discard_add(&gstate->discard[player], card_idx);
+  zobrist_move_card(gstate, player, ZOBRIST_HAND, ZOBRIST_DISCARD, card_idx);
+
+  // Recall the selected champions from discard to hand
+  for(uint8_t i = 0; i < count; i++)
+  { Discard_remove(&gstate->discard[player], champions[i]);
+    Hand_add(&gstate->hand[player], champions[i]);
+    CardBitset_remove(&gstate->reshuffled, champions[i]);
+    zobrist_move_card(gstate, player, ZOBRIST_DISCARD, ZOBRIST_HAND, champions[i]);
+  }
+
+  DEBUG_PRINT(" Played recall card %u, recalled %u champions\n", card_idx, count);
+}
 
 // AI/automated path: auto-selects the lowest-power champion to exchange.
 void play_cash_card_ai(struct gamestate* gstate, PlayerID player, uint8_t card_idx, GameContext* ctx)
@@ -119,6 +143,7 @@ void play_cash_card_ai(struct gamestate* gstate, PlayerID player, uint8_t card_i
   { // Remove champion from hand and place in discard
     Hand_remove(&gstate->hand[player], champion_to_exchange);
     Discard_add(&gstate->discard[player], champion_to_exchange);
+    zobrist_move_card(gstate, player, ZOBRIST_HAND, ZOBRIST_DISCARD, champion_to_exchange);
 
     // Collect cash
     uint8_t cash_received = fullDeck[card_idx].exchange_cash;
@@ -131,6 +156,7 @@ void play_cash_card_ai(struct gamestate* gstate, PlayerID player, uint8_t card_i
 
   // Move cash card to discard
   Discard_add(&gstate->discard[player], card_idx);
+  zobrist_move_card(gstate, player, ZOBRIST_HAND, ZOBRIST_DISCARD, card_idx);
 }
 
 // Interactive path: the caller (human player) supplies which champion to
@@ -145,6 +171,7 @@ void play_cash_card_interactive(struct gamestate* gstate, PlayerID player,
   // Remove chosen champion from hand and place in discard
   Hand_remove(&gstate->hand[player], champion_idx);
   Discard_add(&gstate->discard[player], champion_idx);
+  zobrist_move_card(gstate, player, ZOBRIST_HAND, ZOBRIST_DISCARD, champion_idx);
 
   // Collect cash
   uint8_t cash_received = fullDeck[card_idx].exchange_cash;
@@ -154,16 +181,33 @@ void play_cash_card_interactive(struct gamestate* gstate, PlayerID player,
 
   // Move cash card to discard
   Discard_add(&gstate->discard[player], card_idx);
+  zobrist_move_card(gstate, player, ZOBRIST_HAND, ZOBRIST_DISCARD, card_idx);
 }
 
 void draw_1_card(struct gamestate* gstate, PlayerID player, GameContext* ctx)
 { if(DeckStk_isEmpty(&gstate->deck[player]))
-  { shuffle_discard_and_form_deck(&gstate->discard[player], &gstate->deck[player], ctx);
+  { PROFILE_SCOPE(PROFILE_RESHUFFLE);
+    // The new deck is the discard pile, known to both players; cards in hand
+    // from earlier decks are no longer tracked
+    for(uint8_t i = 0; i < gstate->hand[player].size; i++)
+      CardBitset_remove(&gstate->reshuffled, gstate->hand[player].cards[i]);
+    for(uint8_t i = 0; i < gstate->discard[player].size; i++)
+    { CardBitset_add(&gstate->reshuffled, gstate->discard[player].cards[i]);
+      zobrist_move_card(gstate, player, ZOBRIST_DISCARD, ZOBRIST_DECK,
+                        gstate->discard[player].cards[i]);
+    }
+    shuffle_discard_and_form_deck(&gstate->discard[player], &gstate->deck[player], ctx);
     DEBUG_PRINT(" Reshuffled deck for player %u\n", player);
   }
 
-  uint8_t cardindex = DeckStk_pop(&gstate->deck[player]);
+  // A lazy deck is unordered: draw a uniformly random card instead of the top
+  uint8_t cardindex;
+  if(ctx->config->lazy_deck)
+    cardindex = DeckStk_take(&gstate->deck[player], RND_randn(gstate->deck[player].size, ctx));
+  else
+    cardindex = DeckStk_pop(&gstate->deck[player]);
   Hand_add(&gstate->hand[player], cardindex);
+  zobrist_move_card(gstate, player, ZOBRIST_DECK, ZOBRIST_HAND, cardindex);
 
   DEBUG_PRINT(" Drew card index %u from player %u deck\n", cardindex, player);
 }
@@ -173,8 +217,10 @@ void shuffle_discard_and_form_deck(Discard* discard, struct deck_stack* deck, Ga
 
   DEBUG_PRINT(" Discard size: %u\n", n);
 
-  // Shuffle the card indices directly in the discard array
-  RND_partial_shuffle(discard->cards, n, n, ctx);
+  // Shuffle the card indices directly in the discard array; a lazy deck
+  // samples at draw time instead, so its order does not matter
+  if(!ctx->config->lazy_deck)
+    RND_partial_shuffle(discard->cards, n, n, ctx);
 
   // Push to deck
   for(uint8_t i = 0; i < n; i++)
@@ -211,6 +257,8 @@ void discard_to_7_cards(struct gamestate* gstate, GameContext* ctx)
                 card_with_lowest_power);
     Discard_add(&gstate->discard[gstate->current_player],
                 card_with_lowest_power);
+    zobrist_move_card(gstate, gstate->current_player, ZOBRIST_HAND, ZOBRIST_DISCARD,
+                      card_with_lowest_power);
   }
 }
 
@@ -11,6 +11,8 @@
 void play_card(struct gamestate* gstate, PlayerID player, uint8_t card_idx, GameContext* ctx);
 void play_champion(struct gamestate* gstate, PlayerID player, uint8_t card_idx, GameContext* ctx);
 void play_draw_card(struct gamestate* gstate, PlayerID player, uint8_t card_idx, GameContext* ctx);
+void play_recall_card(struct gamestate* gstate, PlayerID player, uint8_t card_idx,
+                      const uint8_t* champions, uint8_t count, GameContext* ctx);
 void play_cash_card_ai(struct gamestate* gstate, PlayerID player, uint8_t card_idx, GameContext* ctx);
 void play_cash_card_interactive(struct gamestate* gstate, PlayerID player,
                                 uint8_t card_idx, uint8_t champion_idx, GameContext* ctx);
@@ -21,6 +23,11 @@ uint8_t select_champion_for_cash_exchange(Hand* hand);
 uint8_t collect_champions(const uint8_t* cards, uint8_t n, uint8_t* out, bool sort_desc);
 
 // Game action functions
+// With config->lazy_deck the deck is an unordered multiset: the reshuffle
+// only moves the discard into it and each draw takes a uniformly random card
+// (swap-remove), which gives the same draw distribution as shuffling. Deck
+// order then carries no information, so a determinization only has to choose
+// which cards are in the deck, never their order.
 void draw_1_card(struct gamestate* gstate, PlayerID player, GameContext* ctx);
 void shuffle_discard_and_form_deck(Discard* discard, struct deck_stack* deck, GameContext* ctx);
 void discard_to_7_cards(struct gamestate* gstate, GameContext* ctx);
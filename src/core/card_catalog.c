@@ -0,0 +1,977 @@
+// card_catalog.c
+// GENERATED by tools/gen_card_catalog.c from fullDeck -- do not edit
+
+#include "card_catalog.h"
+
+const float card_attack_mean[FULL_DECK_SIZE] =
+{ 2.5f, 3.5f, 3.5f, 4.5f, 4.5f, 4.5f, 5.5f, 5.5f,
+  5.5f, 6.5f, 6.5f, 6.5f, 6.5f, 7.5f, 7.5f, 7.5f,
+  7.5f, 8.5f, 8.5f, 8.5f, 8.5f, 9.5f, 9.5f, 9.5f,
+  10.5f, 10.5f, 10.5f, 11.5f, 11.5f, 12.5f, 12.5f, 13.5f,
+  14.5f, 15.5f, 2.5f, 3.5f, 3.5f, 4.5f, 4.5f, 4.5f,
+  5.5f, 5.5f, 5.5f, 6.5f, 6.5f, 6.5f, 6.5f, 7.5f,
+  7.5f, 7.5f, 7.5f, 8.5f, 8.5f, 8.5f, 8.5f, 9.5f,
+  9.5f, 9.5f, 10.5f, 10.5f, 10.5f, 11.5f, 11.5f, 12.5f,
+  12.5f, 13.5f, 14.5f, 15.5f, 2.5f, 3.5f, 3.5f, 4.5f,
+  4.5f, 4.5f, 5.5f, 5.5f, 5.5f, 6.5f, 6.5f, 6.5f,
+  6.5f, 7.5f, 7.5f, 7.5f, 7.5f, 8.5f, 8.5f, 8.5f,
+  8.5f, 9.5f, 9.5f, 9.5f, 10.5f, 10.5f, 10.5f, 11.5f,
+  11.5f, 12.5f, 12.5f, 13.5f, 14.5f, 15.5f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f
+};
+
+const float card_defense_mean[FULL_DECK_SIZE] =
+{ 2.5f, 3.5f, 2.5f, 4.5f, 3.5f, 2.5f, 4.5f, 3.5f,
+  2.5f, 6.5f, 2.5f, 4.5f, 3.5f, 3.5f, 6.5f, 2.5f,
+  4.5f, 4.5f, 3.5f, 6.5f, 2.5f, 4.5f, 3.5f, 6.5f,
+  10.5f, 6.5f, 4.5f, 10.5f, 6.5f, 10.5f, 6.5f, 10.5f,
+  10.5f, 10.5f, 2.5f, 3.5f, 2.5f, 4.5f, 3.5f, 2.5f,
+  4.5f, 3.5f, 2.5f, 6.5f, 2.5f, 4.5f, 3.5f, 3.5f,
+  6.5f, 2.5f, 4.5f, 4.5f, 3.5f, 6.5f, 2.5f, 4.5f,
+  3.5f, 6.5f, 10.5f, 6.5f, 4.5f, 10.5f, 6.5f, 10.5f,
+  6.5f, 10.5f, 10.5f, 10.5f, 2.5f, 3.5f, 2.5f, 4.5f,
+  3.5f, 2.5f, 4.5f, 3.5f, 2.5f, 6.5f, 2.5f, 4.5f,
+  3.5f, 3.5f, 6.5f, 2.5f, 4.5f, 4.5f, 3.5f, 6.5f,
+  2.5f, 4.5f, 3.5f, 6.5f, 10.5f, 6.5f, 4.5f, 10.5f,
+  6.5f, 10.5f, 6.5f, 10.5f, 10.5f, 10.5f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f
+};
+
+const float card_dice_var[FULL_DECK_SIZE] =
+{ 1.25f, 2.91666675f, 1.25f, 5.25f, 2.91666675f, 1.25f, 5.25f, 2.91666675f,
+  1.25f, 11.916667f, 1.25f, 5.25f, 2.91666675f, 2.91666675f, 11.916667f, 1.25f,
+  5.25f, 5.25f, 2.91666675f, 11.916667f, 1.25f, 5.25f, 2.91666675f, 11.916667f,
+  33.25f, 11.916667f, 5.25f, 33.25f, 11.916667f, 33.25f, 11.916667f, 33.25f,
+  33.25f, 33.25f, 1.25f, 2.91666675f, 1.25f, 5.25f, 2.91666675f, 1.25f,
+  5.25f, 2.91666675f, 1.25f, 11.916667f, 1.25f, 5.25f, 2.91666675f, 2.91666675f,
+  11.916667f, 1.25f, 5.25f, 5.25f, 2.91666675f, 11.916667f, 1.25f, 5.25f,
+  2.91666675f, 11.916667f, 33.25f, 11.916667f, 5.25f, 33.25f, 11.916667f, 33.25f,
+  11.916667f, 33.25f, 33.25f, 33.25f, 1.25f, 2.91666675f, 1.25f, 5.25f,
+  2.91666675f, 1.25f, 5.25f, 2.91666675f, 1.25f, 11.916667f, 1.25f, 5.25f,
+  2.91666675f, 2.91666675f, 11.916667f, 1.25f, 5.25f, 5.25f, 2.91666675f, 11.916667f,
+  1.25f, 5.25f, 2.91666675f, 11.916667f, 33.25f, 11.916667f, 5.25f, 33.25f,
+  11.916667f, 33.25f, 11.916667f, 33.25f, 33.25f, 33.25f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f
+};
+
+const float card_attack_per_cost[FULL_DECK_SIZE] =
+{ 10.0f, 14.0f, 14.0f, 4.5f, 4.5f, 4.5f, 5.5f, 5.5f,
+  5.5f, 6.5f, 6.5f, 6.5f, 6.5f, 7.5f, 7.5f, 7.5f,
+  7.5f, 4.25f, 4.25f, 4.25f, 4.25f, 4.75f, 4.75f, 4.75f,
+  5.25f, 5.25f, 5.25f, 3.83333325f, 3.83333325f, 4.16666651f, 4.16666651f, 4.5f,
+  4.83333349f, 5.16666651f, 10.0f, 14.0f, 14.0f, 4.5f, 4.5f, 4.5f,
+  5.5f, 5.5f, 5.5f, 6.5f, 6.5f, 6.5f, 6.5f, 7.5f,
+  7.5f, 7.5f, 7.5f, 4.25f, 4.25f, 4.25f, 4.25f, 4.75f,
+  4.75f, 4.75f, 5.25f, 5.25f, 5.25f, 3.83333325f, 3.83333325f, 4.16666651f,
+  4.16666651f, 4.5f, 4.83333349f, 5.16666651f, 10.0f, 14.0f, 14.0f, 4.5f,
+  4.5f, 4.5f, 5.5f, 5.5f, 5.5f, 6.5f, 6.5f, 6.5f,
+  6.5f, 7.5f, 7.5f, 7.5f, 7.5f, 4.25f, 4.25f, 4.25f,
+  4.25f, 4.75f, 4.75f, 4.75f, 5.25f, 5.25f, 5.25f, 3.83333325f,
+  3.83333325f, 4.16666651f, 4.16666651f, 4.5f, 4.83333349f, 5.16666651f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f
+};
+
+const float card_defense_per_cost[FULL_DECK_SIZE] =
+{ 10.0f, 14.0f, 10.0f, 4.5f, 3.5f, 2.5f, 4.5f, 3.5f,
+  2.5f, 6.5f, 2.5f, 4.5f, 3.5f, 3.5f, 6.5f, 2.5f,
+  4.5f, 2.25f, 1.75f, 3.25f, 1.25f, 2.25f, 1.75f, 3.25f,
+  5.25f, 3.25f, 2.25f, 3.5f, 2.16666675f, 3.5f, 2.16666675f, 3.5f,
+  3.5f, 3.5f, 10.0f, 14.0f, 10.0f, 4.5f, 3.5f, 2.5f,
+  4.5f, 3.5f, 2.5f, 6.5f, 2.5f, 4.5f, 3.5f, 3.5f,
+  6.5f, 2.5f, 4.5f, 2.25f, 1.75f, 3.25f, 1.25f, 2.25f,
+  1.75f, 3.25f, 5.25f, 3.25f, 2.25f, 3.5f, 2.16666675f, 3.5f,
+  2.16666675f, 3.5f, 3.5f, 3.5f, 10.0f, 14.0f, 10.0f, 4.5f,
+  3.5f, 2.5f, 4.5f, 3.5f, 2.5f, 6.5f, 2.5f, 4.5f,
+  3.5f, 3.5f, 6.5f, 2.5f, 4.5f, 2.25f, 1.75f, 3.25f,
+  1.25f, 2.25f, 1.75f, 3.25f, 5.25f, 3.25f, 2.25f, 3.5f,
+  2.16666675f, 3.5f, 2.16666675f, 3.5f, 3.5f, 3.5f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f,
+  0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f
+};
+
+const float card_power[FULL_DECK_SIZE] =
+{ 10.0f, 14.0f, 12.0f, 4.5f, 4.0f, 3.5f, 5.0f, 4.5f,
+  4.0f, 6.5f, 4.5f, 5.5f, 5.0f, 5.5f, 7.0f, 5.0f,
+  6.0f, 3.25f, 3.0f, 3.75f, 2.75f, 3.5f, 3.25f, 4.0f,
+  5.25f, 4.25f, 3.75f, 3.66666675f, 3.0f, 3.83333325f, 3.16666675f, 4.0f,
+  4.16666651f, 4.33333349f, 10.0f, 14.0f, 12.0f, 4.5f, 4.0f, 3.5f,
+  5.0f, 4.5f, 4.0f, 6.5f, 4.5f, 5.5f, 5.0f, 5.5f,
+  7.0f, 5.0f, 6.0f, 3.25f, 3.0f, 3.75f, 2.75f, 3.5f,
+  3.25f, 4.0f, 5.25f, 4.25f, 3.75f, 3.66666675f, 3.0f, 3.83333325f,
+  3.16666675f, 4.0f, 4.16666651f, 4.33333349f, 10.0f, 14.0f, 12.0f, 4.5f,
+  4.0f, 3.5f, 5.0f, 4.5f, 4.0f, 6.5f, 4.5f, 5.5f,
+  5.0f, 5.5f, 7.0f, 5.0f, 6.0f, 3.25f, 3.0f, 3.75f,
+  2.75f, 3.5f, 3.25f, 4.0f, 5.25f, 4.25f, 3.75f, 3.66666675f,
+  3.0f, 3.83333325f, 3.16666675f, 4.0f, 4.16666651f, 4.33333349f, 2.0f, 2.0f,
+  2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 3.0f,
+  3.0f, 3.0f, 3.0f, 3.0f, 3.0f, 2.5f, 2.5f, 2.5f
+};
+
+const float card_attack_pmf[FULL_DECK_SIZE][CARD_PMF_SIZE] =
+{ {0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f},
+  {0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f},
+  {0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f}
+};
+
+const float card_defense_pmf[FULL_DECK_SIZE][CARD_PMF_SIZE] =
+{ {0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.25f, 0.25f, 0.25f, 0.25f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.166666672f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.125f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0833333358f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0500000007f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+  {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f}
+};
+
+const uint8_t card_pair_synergy[2][CARD_CATALOG_CHAMPIONS][CARD_CATALOG_CHAMPIONS] =
+{ { // random
+    {10,5,5,10,5,5,5,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0},
+    {5,10,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0},
+    {5,5,10,5,5,5,5,5,10,5,5,5,5,10,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0},
+    {10,5,5,10,5,5,5,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0},
+    {5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,10,5,5,10,5,5,5,5,10,5,5,5,10,5,5,5,5,5,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0},
+    {5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,5,5,5,5,10,5,5,5,5,5,10,5,5,5,10,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7},
+    {5,10,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0},
+    {5,10,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0},
+    {5,5,10,5,5,5,5,5,10,5,5,5,5,10,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0},
+    {5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,10,5,5,10,5,5,5,5,10,5,5,5,10,5,5,5,5,5,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0},
+    {5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,5,5,5,5,10,5,5,5,5,5,10,5,5,5,10,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7},
+    {10,5,5,10,5,5,5,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0},
+    {10,5,5,10,5,5,5,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0},
+    {5,5,10,5,5,5,5,5,10,5,5,5,5,10,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0},
+    {5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,10,5,5,10,5,5,5,5,10,5,5,5,10,5,5,5,5,5,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0},
+    {5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,5,5,5,5,10,5,5,5,5,5,10,5,5,5,10,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7},
+    {5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,10,5,5,10,5,5,5,5,10,5,5,5,10,5,5,5,5,5,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0},
+    {5,5,10,5,5,5,5,5,10,5,5,5,5,10,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0},
+    {5,10,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0},
+    {5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,10,5,5,10,5,5,5,5,10,5,5,5,10,5,5,5,5,5,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0},
+    {5,5,10,5,5,5,5,5,10,5,5,5,5,10,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0},
+    {5,10,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0},
+    {10,5,5,10,5,5,5,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0},
+    {5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,5,5,5,5,10,5,5,5,5,5,10,5,5,5,10,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7},
+    {5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,10,5,5,10,5,5,5,5,10,5,5,5,10,5,5,5,5,5,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0},
+    {5,5,10,5,5,5,5,5,10,5,5,5,5,10,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0},
+    {5,10,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0},
+    {10,5,5,10,5,5,5,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0},
+    {5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,10,5,5,10,5,5,5,5,10,5,5,5,10,5,5,5,5,5,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0},
+    {5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,5,5,5,5,10,5,5,5,5,5,10,5,5,5,10,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7},
+    {5,5,10,5,5,5,5,5,10,5,5,5,5,10,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0},
+    {5,10,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0},
+    {10,5,5,10,5,5,5,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0},
+    {5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,5,5,5,5,10,5,5,5,5,5,10,5,5,5,10,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7},
+    {7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     10,5,5,10,5,5,5,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0},
+    {0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     5,10,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0},
+    {0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     5,5,10,5,5,5,5,5,10,5,5,5,5,10,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0},
+    {7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     10,5,5,10,5,5,5,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0},
+    {0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,10,5,5,10,5,5,5,5,10,5,5,5,10,5,5,5,5,5,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0},
+    {0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,5,5,5,5,10,5,5,5,5,5,10,5,5,5,10,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7},
+    {0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     5,10,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0},
+    {0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     5,10,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0},
+    {0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     5,5,10,5,5,5,5,5,10,5,5,5,5,10,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0},
+    {0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,10,5,5,10,5,5,5,5,10,5,5,5,10,5,5,5,5,5,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0},
+    {0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,5,5,5,5,10,5,5,5,5,5,10,5,5,5,10,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7},
+    {7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     10,5,5,10,5,5,5,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0},
+    {7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     10,5,5,10,5,5,5,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0},
+    {0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     5,5,10,5,5,5,5,5,10,5,5,5,5,10,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0},
+    {0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,10,5,5,10,5,5,5,5,10,5,5,5,10,5,5,5,5,5,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0},
+    {0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,5,5,5,5,10,5,5,5,5,5,10,5,5,5,10,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7},
+    {0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,10,5,5,10,5,5,5,5,10,5,5,5,10,5,5,5,5,5,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0},
+    {0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     5,5,10,5,5,5,5,5,10,5,5,5,5,10,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0},
+    {0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     5,10,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0},
+    {0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,10,5,5,10,5,5,5,5,10,5,5,5,10,5,5,5,5,5,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0},
+    {0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     5,5,10,5,5,5,5,5,10,5,5,5,5,10,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0},
+    {0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     5,10,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0},
+    {7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     10,5,5,10,5,5,5,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0},
+    {0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,5,5,5,5,10,5,5,5,5,5,10,5,5,5,10,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7},
+    {0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,10,5,5,10,5,5,5,5,10,5,5,5,10,5,5,5,5,5,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0},
+    {0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     5,5,10,5,5,5,5,5,10,5,5,5,5,10,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0},
+    {0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     5,10,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0},
+    {7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     10,5,5,10,5,5,5,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0},
+    {0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,10,5,5,10,5,5,5,5,10,5,5,5,10,5,5,5,5,5,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0},
+    {0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,5,5,5,5,10,5,5,5,5,5,10,5,5,5,10,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7},
+    {0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     5,5,10,5,5,5,5,5,10,5,5,5,5,10,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0},
+    {0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     5,10,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0},
+    {7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     10,5,5,10,5,5,5,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0},
+    {0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,5,5,5,5,10,5,5,5,5,5,10,5,5,5,10,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7},
+    {7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     10,5,5,10,5,5,5,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5},
+    {0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     5,10,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5},
+    {0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     5,5,10,5,5,5,5,5,10,5,5,5,5,10,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5},
+    {7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     10,5,5,10,5,5,5,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5},
+    {0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,10,5,5,10,5,5,5,5,10,5,5,5,10,5,5,5,5,5},
+    {0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,5,5,5,5,10,5,5,5,5,5,10,5,5,5,10},
+    {0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     5,10,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5},
+    {0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     5,10,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5},
+    {0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     5,5,10,5,5,5,5,5,10,5,5,5,5,10,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5},
+    {0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,10,5,5,10,5,5,5,5,10,5,5,5,10,5,5,5,5,5},
+    {0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,5,5,5,5,10,5,5,5,5,5,10,5,5,5,10},
+    {7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     10,5,5,10,5,5,5,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5},
+    {7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     10,5,5,10,5,5,5,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5},
+    {0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     5,5,10,5,5,5,5,5,10,5,5,5,5,10,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5},
+    {0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,10,5,5,10,5,5,5,5,10,5,5,5,10,5,5,5,5,5},
+    {0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,5,5,5,5,10,5,5,5,5,5,10,5,5,5,10},
+    {0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,10,5,5,10,5,5,5,5,10,5,5,5,10,5,5,5,5,5},
+    {0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     5,5,10,5,5,5,5,5,10,5,5,5,5,10,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5},
+    {0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     5,10,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5},
+    {0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,10,5,5,10,5,5,5,5,10,5,5,5,10,5,5,5,5,5},
+    {0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     5,5,10,5,5,5,5,5,10,5,5,5,5,10,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5},
+    {0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     5,10,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5},
+    {7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     10,5,5,10,5,5,5,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5},
+    {0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,5,5,5,5,10,5,5,5,5,5,10,5,5,5,10},
+    {0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,10,5,5,10,5,5,5,5,10,5,5,5,10,5,5,5,5,5},
+    {0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     5,5,10,5,5,5,5,5,10,5,5,5,5,10,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5},
+    {0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     5,10,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5},
+    {7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     10,5,5,10,5,5,5,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5},
+    {0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,10,5,5,10,5,5,5,5,10,5,5,5,10,5,5,5,5,5},
+    {0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,5,5,5,5,10,5,5,5,5,5,10,5,5,5,10},
+    {0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     5,5,10,5,5,5,5,5,10,5,5,5,5,10,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5},
+    {0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     5,10,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,5,10,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5},
+    {7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     10,5,5,10,5,5,5,5,5,5,5,10,10,5,5,5,5,5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5},
+    {0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     5,5,5,5,5,10,5,5,5,5,10,5,5,5,5,10,5,5,5,5,5,5,5,10,5,5,5,5,5,10,5,5,5,10}
+  },
+  { // prebuilt
+    {7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,
+     4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0},
+    {0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,
+     0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0},
+    {0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,
+     0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0},
+    {7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,
+     4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0},
+    {0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0,
+     0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0},
+    {0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4,
+     0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4},
+    {0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,
+     0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0},
+    {0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,
+     0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0},
+    {0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,
+     0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0},
+    {0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0,
+     0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0},
+    {0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4,
+     0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4},
+    {7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,
+     4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0},
+    {7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,
+     4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0},
+    {0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,
+     0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0},
+    {0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0,
+     0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0},
+    {0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4,
+     0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4},
+    {0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0,
+     0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0},
+    {0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,
+     0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0},
+    {0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,
+     0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0},
+    {0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0,
+     0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0},
+    {0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,
+     0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0},
+    {0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,
+     0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0},
+    {7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,
+     4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0},
+    {0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4,
+     0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4},
+    {0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0,
+     0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0},
+    {0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,
+     0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0},
+    {0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,
+     0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0},
+    {7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,
+     4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0},
+    {0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0,
+     0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0},
+    {0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4,
+     0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4},
+    {0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,
+     0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0},
+    {0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,
+     0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0},
+    {7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,
+     4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0},
+    {0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4,
+     0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4},
+    {4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0},
+    {0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0},
+    {0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0},
+    {4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0},
+    {0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0},
+    {0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4},
+    {0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0},
+    {0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0},
+    {0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0},
+    {0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0},
+    {0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4},
+    {4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0},
+    {4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0},
+    {0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0},
+    {0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0},
+    {0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4},
+    {0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0},
+    {0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0},
+    {0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0},
+    {0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0},
+    {0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0},
+    {0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0},
+    {4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0},
+    {0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4},
+    {0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0},
+    {0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0},
+    {0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0},
+    {4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0},
+    {0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0,
+     0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0},
+    {0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4},
+    {0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,
+     0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0},
+    {0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+     0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0},
+    {4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,
+     4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0},
+    {0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7,
+     0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4},
+    {4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,
+     4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0},
+    {0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,
+     0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0},
+    {0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,
+     0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0},
+    {4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,
+     4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0},
+    {0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0,
+     0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0},
+    {0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4,
+     0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7},
+    {0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,
+     0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0},
+    {0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,
+     0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0},
+    {0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,
+     0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0},
+    {0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0,
+     0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0},
+    {0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4,
+     0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7},
+    {4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,
+     4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0},
+    {4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,
+     4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0},
+    {0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,
+     0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0},
+    {0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0,
+     0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0},
+    {0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4,
+     0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7},
+    {0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0,
+     0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0},
+    {0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,
+     0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0},
+    {0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,
+     0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0},
+    {0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0,
+     0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0},
+    {0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,
+     0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0},
+    {0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,
+     0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0},
+    {4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,
+     4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0},
+    {0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4,
+     0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7},
+    {0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0,
+     0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0},
+    {0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,
+     0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0},
+    {0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,
+     0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0},
+    {4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,
+     4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0},
+    {0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0,
+     0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,4,0,0,4,0,0,0,0,4,0,0,0,4,0,0,0,0,0,
+     0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,7,0,0,7,0,0,0,0,7,0,0,0,7,0,0,0,0,0},
+    {0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4,
+     0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7},
+    {0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,
+     0,0,4,0,0,0,0,0,4,0,0,0,0,4,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,
+     0,0,7,0,0,0,0,0,7,0,0,0,0,7,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0},
+    {0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,
+     0,4,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,0,4,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,
+     0,7,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,0,7,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0},
+    {4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,
+     4,0,0,4,0,0,0,0,0,0,0,4,4,0,0,0,0,0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,
+     7,0,0,7,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0},
+    {0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4,
+     0,0,0,0,0,4,0,0,0,0,4,0,0,0,0,4,0,0,0,0,0,0,0,4,0,0,0,0,0,4,0,0,0,4,
+     0,0,0,0,0,7,0,0,0,0,7,0,0,0,0,7,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,7}
+  }
+};
@@ -0,0 +1,40 @@
+// card_catalog.h
+// Derived card statistics, one flat array per statistic indexed by fullDeck
+// index, for agents to read instead of recomputing them. card_catalog.c is
+// generated from fullDeck's base fields by tools/gen_card_catalog.c and
+// committed (make card_catalog regenerates it, make check_card_catalog fails
+// when it is stale); the generator also checks fullDeck's hand-coded float fields against what it
+// derives, and fails on any that disagree beyond their 2-decimal rounding.
+
+#ifndef CARD_CATALOG_H
+#define CARD_CATALOG_H
+
+#include <stdint.h>
+#include "game_constants.h"
+
+// Champions are fullDeck[0 .. CARD_CATALOG_CHAMPIONS - 1]
+#define CARD_CATALOG_CHAMPIONS 102
+
+// Totals 0 .. CARD_PMF_SIZE - 1 (the largest is a base 5 D20 attack, 25)
+#define CARD_PMF_SIZE 26
+
+// A champion with a Dn die: attack base + Dn, defense Dn. Other cards are 0.
+extern const float card_attack_mean[FULL_DECK_SIZE];    // base + (n + 1) / 2
+extern const float card_defense_mean[FULL_DECK_SIZE];   // (n + 1) / 2
+extern const float card_dice_var[FULL_DECK_SIZE];       // V[Dn] = (n^2 - 1) / 12
+
+// Per unit of cost, a free card counting as a cost of 1/4; power is the mean
+// of the two (a draw card's draw_num, a cash card's exchange_cash / 2)
+extern const float card_attack_per_cost[FULL_DECK_SIZE];
+extern const float card_defense_per_cost[FULL_DECK_SIZE];
+extern const float card_power[FULL_DECK_SIZE];
+
+// P(attack total = x) and P(defense total = x), by [card][x]
+extern const float card_attack_pmf[FULL_DECK_SIZE][CARD_PMF_SIZE];
+extern const float card_defense_pmf[FULL_DECK_SIZE][CARD_PMF_SIZE];
+
+// Combo bonus of a pair of champions played together, [0] under random deck
+// rules and [1] prebuilt deck rules (combo_bonus_lookup())
+extern const uint8_t card_pair_synergy[2][CARD_CATALOG_CHAMPIONS][CARD_CATALOG_CHAMPIONS];
+
+#endif // CARD_CATALOG_H
@@ -6,12 +6,15 @@
 #include "combat.h"
 #include "combo_bonus.h"
 #include "game_constants.h"
+#include "zobrist.h"
 #include "../util/rnd.h"
 #include "game_context.h"
 #include "../util/debug.h"
+#include "../util/profile.h"
 
 void resolve_combat(struct gamestate* gstate, GameContext* ctx)
-{ PlayerID attacker = gstate->current_player;
+{ PROFILE_SCOPE(PROFILE_RESOLVE_COMBAT);
+  PlayerID attacker = gstate->current_player;
   PlayerID defender = 1 - gstate->current_player;
 
   // Calculate attack and defense
@@ -28,21 +31,19 @@ void resolve_combat(struct gamestate* gstate, GameContext* ctx)
 int16_t calculate_total_attack(struct gamestate* gstate, PlayerID player, GameContext* ctx)
 { int16_t total = 0;
 
-  // Build CombatCard array for combo calculation
   uint8_t num_cards = gstate->combat_zone[player].size;
-  CombatCard combat_cards[3];
+
+  // Roll all dice in one batch (same draw order as one RND_dn() per card)
+  uint8_t sides[3] = {0}, rolls[3];
+  for(uint8_t i = 0; i < num_cards; i++)
+    sides[i] = fullDeck[gstate->combat_zone[player].cards[i]].defense_dice;
+  RND_dn_batch(sides, rolls, num_cards, ctx);
 
   for(uint8_t i = 0; i < num_cards; i++)
   { uint8_t card_idx = gstate->combat_zone[player].cards[i];
 
     // Add base attack + dice roll
-    total += fullDeck[card_idx].attack_base +
-             RND_dn(fullDeck[card_idx].defense_dice, ctx);
-
-    // Store for combo calculation
-    combat_cards[i].species = fullDeck[card_idx].species;
-    combat_cards[i].color = fullDeck[card_idx].color;
-    combat_cards[i].order = fullDeck[card_idx].order;
+    total += fullDeck[card_idx].attack_base + rolls[i];
 
     DEBUG_PRINT(" Attack card %u: D%u+%u, cost %u\n",
                 card_idx,
@@ -52,8 +53,7 @@ int16_t calculate_total_attack(struct gamestate* gstate, PlayerID player, GameCo
   }
 
   // Add combo bonus (assuming DECK_RANDOM for now)
-
-  int bonus = calculate_combo_bonus(combat_cards, num_cards, DECK_RANDOM);
+  int bonus = combo_bonus_lookup(gstate->combat_zone[player].cards, num_cards, DECK_RANDOM);
   total += bonus;
 
   DEBUG_ONLY(if(bonus > 0) printf(" Combo bonus: +%d\n", bonus));
@@ -67,29 +67,25 @@ int16_t calculate_total_attack(struct gamestate* gstate, PlayerID player, GameCo
 int16_t calculate_total_defense(struct gamestate* gstate, PlayerID player, GameContext* ctx)
 { int16_t total = 0;
 
-  // Build CombatCard array for combo calculation
   uint8_t num_cards = gstate->combat_zone[player].size;
-  CombatCard combat_cards[3];
 
+  uint8_t sides[3] = {0}, rolls[3];
   for(uint8_t i = 0; i < num_cards; i++)
-  { uint8_t card_idx = gstate->combat_zone[player].cards[i];
+    sides[i] = fullDeck[gstate->combat_zone[player].cards[i]].defense_dice;
+  RND_dn_batch(sides, rolls, num_cards, ctx);
 
-    // Add dice roll only (no base for defense)
-    total += RND_dn(fullDeck[card_idx].defense_dice, ctx);
-
-    // Store for combo calculation
-    combat_cards[i].species = fullDeck[card_idx].species;
-    combat_cards[i].color = fullDeck[card_idx].color;
-    combat_cards[i].order = fullDeck[card_idx].order;
+  for(uint8_t i = 0; i < num_cards; i++)
+  { // Add dice roll only (no base for defense)
+    total += rolls[i];
 
     DEBUG_PRINT(" Defense card %u: D%u, cost %u\n",
-                card_idx,
-                fullDeck[card_idx].defense_dice,
-                fullDeck[card_idx].cost);
+                gstate->combat_zone[player].cards[i],
+                sides[i],
+                fullDeck[gstate->combat_zone[player].cards[i]].cost);
   }
 
   // Add combo bonus (assuming DECK_RANDOM for now)
-  int bonus = calculate_combo_bonus(combat_cards, num_cards, DECK_RANDOM);
+  int bonus = combo_bonus_lookup(gstate->combat_zone[player].cards, num_cards, DECK_RANDOM);
   total += bonus;
 
   DEBUG_ONLY(if(bonus > 0) printf(" Combo bonus: +%d\n", bonus));
@@ -196,6 +192,7 @@ void clear_combat_zones(struct gamestate* gstate, GameContext* ctx)
   for(uint8_t i = 0; i < gstate->combat_zone[attacker].size; i++)
   { uint8_t card_idx = gstate->combat_zone[attacker].cards[i];
     Discard_add(&gstate->discard[attacker], card_idx);
+    zobrist_move_card(gstate, attacker, ZOBRIST_COMBAT, ZOBRIST_DISCARD, card_idx);
   }
   CombatZone_clear(&gstate->combat_zone[attacker]);
 
@@ -203,6 +200,7 @@ void clear_combat_zones(struct gamestate* gstate, GameContext* ctx)
   for(uint8_t i = 0; i < gstate->combat_zone[defender].size; i++)
   { uint8_t card_idx = gstate->combat_zone[defender].cards[i];
     Discard_add(&gstate->discard[defender], card_idx);
+    zobrist_move_card(gstate, defender, ZOBRIST_COMBAT, ZOBRIST_DISCARD, card_idx);
   }
   CombatZone_clear(&gstate->combat_zone[defender]);
 }
@@ -0,0 +1,237 @@
+// combat_analysis.c
+// Exact probability distribution of combat outcomes
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "combat_analysis.h"
+#include "combo_bonus.h"
+#include "game_constants.h"
+
+#define COMBAT_DIE_TYPES 5
+#define COMBAT_MAX_DICE 3
+#define MAX_DICE_SUM (COMBAT_MAX_DICE * 20)
+#define NUM_DICE_SETS 56     // multisets of 0-3 dice over 5 die types
+#define DICE_SET_KEYS 1024   // per-type counts (0-3) packed 2 bits each
+
+static const uint8_t DIE_SIDES[COMBAT_DIE_TYPES] = {4, 6, 8, 12, 20};
+
+typedef struct
+{ uint8_t min;
+  uint8_t max;
+  double pmf[MAX_DICE_SUM + 1];  // indexed by the dice sum itself
+} DiceSumPmf;
+
+static int8_t dice_set_of_key[DICE_SET_KEYS];
+static DiceSumPmf dice_sums[NUM_DICE_SETS];
+static DiceDiffTable diff_tables[NUM_DICE_SETS][NUM_DICE_SETS];
+static double* table_pool = NULL;
+
+static int die_type_of_sides(uint8_t sides)
+{ for(int t = 0; t < COMBAT_DIE_TYPES; t++)
+  { if(DIE_SIDES[t] == sides) return t;
+  }
+  return -1;
+}
+
+// Convolve a dice-sum PMF with one more fair die
+static void add_die(DiceSumPmf* sum, uint8_t sides)
+{ double next[MAX_DICE_SUM + 1] = {0};
+
+  for(int s = sum->min; s <= sum->max; s++)
+  { double p = sum->pmf[s] / sides;
+    for(int face = 1; face <= sides; face++)
+      next[s + face] += p;
+  }
+
+  memcpy(sum->pmf, next, sizeof(next));
+  sum->min += 1;
+  sum->max += sides;
+}
+
+// Enumerate every dice multiset (types non-decreasing) and its sum PMF
+static int enumerate_dice_sets(int first_type, int num_dice, uint16_t key,
+                               const DiceSumPmf* sum, int next_id)
+{ dice_set_of_key[key] = (int8_t)next_id;
+  dice_sums[next_id] = *sum;
+  next_id++;
+
+  if(num_dice == COMBAT_MAX_DICE) return next_id;
+
+  for(int t = first_type; t < COMBAT_DIE_TYPES; t++)
+  { DiceSumPmf more = *sum;
+    add_die(&more, DIE_SIDES[t]);
+    next_id = enumerate_dice_sets(t, num_dice + 1, key + (1 << (2 * t)),
+                                  &more, next_id);
+  }
+  return next_id;
+}
+
+bool combat_analysis_init(void)
+{ if(table_pool != NULL) return true;
+
+  memset(dice_set_of_key, -1, sizeof(dice_set_of_key));
+  DiceSumPmf empty = {0, 0, {1.0}};
+  enumerate_dice_sets(0, 0, 0, &empty, 0);
+
+  // One pool for all tables: 4 arrays of (len + 1) doubles each
+  size_t total = 0;
+  for(int a = 0; a < NUM_DICE_SETS; a++)
+    for(int d = 0; d < NUM_DICE_SETS; d++)
+      total += 4 * (size_t)(dice_sums[a].max - dice_sums[a].min +
+                            dice_sums[d].max - dice_sums[d].min + 2);
+
+  table_pool = (double*)calloc(total, sizeof(double));
+  if(table_pool == NULL)
+  { fprintf(stderr, "Error: cannot allocate combat analysis tables\n");
+    return false;
+  }
+
+  double* next = table_pool;
+  for(int a = 0; a < NUM_DICE_SETS; a++)
+    for(int d = 0; d < NUM_DICE_SETS; d++)
+    { const DiceSumPmf* att = &dice_sums[a];
+      const DiceSumPmf* def = &dice_sums[d];
+      DiceDiffTable* t = &diff_tables[a][d];
+      int len = att->max - att->min + def->max - def->min + 1;
+
+      t->min = att->min - def->max;
+      t->max = att->max - def->min;
+      t->pmf = next;
+      t->tail_p = next + len + 1;
+      t->tail_m1 = next + 2 * (len + 1);
+      t->tail_m2 = next + 3 * (len + 1);
+      next += 4 * (len + 1);
+
+      // PMF of X = attack dice sum - defense dice sum
+      for(int sa = att->min; sa <= att->max; sa++)
+        for(int sd = def->min; sd <= def->max; sd++)
+          t->pmf[sa - sd - t->min] += att->pmf[sa] * def->pmf[sd];
+
+      // Tail sums from the top down (entry len stays 0: X >= max+1)
+      for(int i = len - 1; i >= 0; i--)
+      { double x = t->min + i;
+        t->tail_p[i] = t->tail_p[i + 1] + t->pmf[i];
+        t->tail_m1[i] = t->tail_m1[i + 1] + x * t->pmf[i];
+        t->tail_m2[i] = t->tail_m2[i + 1] + x * x * t->pmf[i];
+      }
+    }
+
+  return true;
+} // combat_analysis_init
+
+void combat_analysis_free(void)
+{ free(table_pool);
+  table_pool = NULL;
+}
+
+// Dice-set key and deterministic part of one side; false on an invalid zone
+static bool describe_side(const uint8_t* cards, uint8_t n, bool attacking,
+                          uint16_t* key, int16_t* constant)
+{ if(n > COMBAT_MAX_DICE) return false;
+
+  *key = 0;
+  *constant = 0;
+  for(uint8_t i = 0; i < n; i++)
+  { const struct card* c = &fullDeck[cards[i]];
+    int t = die_type_of_sides(c->defense_dice);
+    if(c->card_type != CHAMPION_CARD || t < 0) return false;
+
+    *key += 1 << (2 * t);
+    if(attacking) *constant += c->attack_base;
+  }
+  return true;
+}
+
+bool combat_outcome(const uint8_t* attackers, uint8_t num_attackers,
+                    const uint8_t* defenders, uint8_t num_defenders,
+                    DeckType deck_type, CombatOutcome* out)
+{ uint16_t key_a, key_d;
+  int16_t base_a, base_d;
+
+  if(table_pool == NULL ||
+     !describe_side(attackers, num_attackers, true, &key_a, &base_a) ||
+     !describe_side(defenders, num_defenders, false, &key_d, &base_d))
+    return false;
+
+  out->table = &diff_tables[dice_set_of_key[key_a]][dice_set_of_key[key_d]];
+  out->shift = base_a - base_d
+               + combo_bonus_lookup(attackers, num_attackers, deck_type)
+               - combo_bonus_lookup(defenders, num_defenders, deck_type);
+  return true;
+} // combat_outcome
+
+bool combat_outcome_from_state(const struct gamestate* gstate, CombatOutcome* out)
+{ PlayerID attacker = gstate->current_player;
+  PlayerID defender = 1 - gstate->current_player;
+
+  // Same rule set as calculate_total_attack()/calculate_total_defense()
+  return combat_outcome(gstate->combat_zone[attacker].cards,
+                        gstate->combat_zone[attacker].size,
+                        gstate->combat_zone[defender].cards,
+                        gstate->combat_zone[defender].size,
+                        DECK_RANDOM, out);
+}
+
+// Tail sum at k, clamped to the support: all mass below min, none above max
+static double tail_at(const DiceDiffTable* t, const double* tail, int k)
+{ if(k > t->max) return 0.0;
+  if(k < t->min) k = t->min;
+  return tail[k - t->min];
+}
+
+// E[(X + s)^+] and E[((X + s)^+)^2]: only outcomes with X >= 1 - s count
+static double positive_part_m1(const DiceDiffTable* t, int s)
+{ int k = 1 - s;
+  return tail_at(t, t->tail_m1, k) + s * tail_at(t, t->tail_p, k);
+}
+
+static double positive_part_m2(const DiceDiffTable* t, int s)
+{ int k = 1 - s;
+  return tail_at(t, t->tail_m2, k) + 2.0 * s * tail_at(t, t->tail_m1, k)
+         + (double)s * s * tail_at(t, t->tail_p, k);
+}
+
+// P(total_attack - total_defense == diff)
+double combat_prob_diff(const CombatOutcome* co, int16_t diff)
+{ int x = diff - co->shift;
+  if(x < co->table->min || x > co->table->max) return 0.0;
+  return co->table->pmf[x - co->table->min];
+}
+
+// Damage is max(total_attack - total_defense, 0), before the energy cap
+double combat_expected_damage(const CombatOutcome* co)
+{ return positive_part_m1(co->table, co->shift);
+}
+
+double combat_damage_variance(const CombatOutcome* co)
+{ double m1 = positive_part_m1(co->table, co->shift);
+  return positive_part_m2(co->table, co->shift) - m1 * m1;
+}
+
+// P(defender energy reaches 0)
+double combat_kill_probability(const CombatOutcome* co, uint8_t defender_energy)
+{ if(defender_energy == 0) return 1.0;
+  return tail_at(co->table, co->table->tail_p, defender_energy - co->shift);
+}
+
+// E[min(damage, energy)]: damage beyond the defender's energy is wasted
+double combat_expected_energy_loss(const CombatOutcome* co, uint8_t defender_energy)
+{ return positive_part_m1(co->table, co->shift)
+         - positive_part_m1(co->table, co->shift - defender_energy);
+}
+
+// pmf[j] = P(energy loss == j) for j in [0, defender_energy] (caller sizes
+// the array defender_energy + 1)
+void combat_energy_loss_pmf(const CombatOutcome* co, uint8_t defender_energy,
+                            double pmf[])
+{ if(defender_energy == 0)
+  { pmf[0] = 1.0;
+    return;
+  }
+
+  pmf[0] = 1.0 - tail_at(co->table, co->table->tail_p, 1 - co->shift);
+  for(int j = 1; j < defender_energy; j++)
+    pmf[j] = combat_prob_diff(co, (int16_t)j);
+  pmf[defender_energy] = combat_kill_probability(co, defender_energy);
+}
@@ -0,0 +1,48 @@
+// combat_analysis.h
+// Exact probability distribution of combat outcomes (no dice sampling)
+
+#ifndef COMBAT_ANALYSIS_H
+#define COMBAT_ANALYSIS_H
+
+#include "game_types.h"
+
+// total_attack - total_defense = X + shift, where X is the difference of the
+// two sides' dice sums and shift collects every deterministic term (attack
+// bases and both combo bonuses). The PMF of X only depends on the multiset of
+// die sizes on each side -- 56 multisets of 0-3 dice from {D4, D6, D8, D12, D20},
+// so 56 x 56 tables cover every possible combat. Each table stores tail sums
+// of P, E[X] and E[X^2], which makes every query below O(1).
+typedef struct
+{ int16_t min;          // smallest possible X
+  int16_t max;          // largest possible X
+  double* pmf;          // pmf[x - min] = P(X = x)
+  double* tail_p;       // tail_p[k - min]  = P(X >= k),       k in [min, max+1]
+  double* tail_m1;      // tail_m1[k - min] = E[X ; X >= k]
+  double* tail_m2;      // tail_m2[k - min] = E[X^2 ; X >= k]
+} DiceDiffTable;
+
+typedef struct
+{ const DiceDiffTable* table;
+  int16_t shift;
+} CombatOutcome;
+
+// Build/free the cached tables (call once at startup, after combo_bonus_init())
+bool combat_analysis_init(void);
+void combat_analysis_free(void);
+
+// Describe a combat from the card indices in each zone (any order)
+bool combat_outcome(const uint8_t* attackers, uint8_t num_attackers,
+                    const uint8_t* defenders, uint8_t num_defenders,
+                    DeckType deck_type, CombatOutcome* out);
+bool combat_outcome_from_state(const struct gamestate* gstate, CombatOutcome* out);
+
+// Queries
+double combat_prob_diff(const CombatOutcome* co, int16_t diff);
+double combat_expected_damage(const CombatOutcome* co);
+double combat_damage_variance(const CombatOutcome* co);
+double combat_kill_probability(const CombatOutcome* co, uint8_t defender_energy);
+double combat_expected_energy_loss(const CombatOutcome* co, uint8_t defender_energy);
+void combat_energy_loss_pmf(const CombatOutcome* co, uint8_t defender_energy,
+                            double pmf[]);
+
+#endif // COMBAT_ANALYSIS_H
@@ -4,6 +4,16 @@
 #include "combo_bonus.h"
 #include "game_constants.h"
 #include <stddef.h>
+#include <stdio.h>
+
+// Lookup tables: [rules][...] with rules 0 = DECK_RANDOM, 1 = prebuilt decks.
+// Only the first num_combo_classes entries of each dimension are used, so the
+// live part of the triple table stays small (15 champion profiles + 1 for
+// non-champions = 16^3 bytes per rule set in the standard deck).
+static uint8_t combo_class_of_card[FULL_DECK_SIZE];
+static uint8_t num_combo_classes;
+static uint8_t combo_pair_table[2][COMBO_MAX_CLASSES][COMBO_MAX_CLASSES];
+static uint8_t combo_triple_table[2][COMBO_MAX_CLASSES][COMBO_MAX_CLASSES][COMBO_MAX_CLASSES];
 
 int calculate_combo_bonus(CombatCard *cards, int num_cards, DeckType deck_type)
 { if(num_cards < 2 || num_cards > 3) return 0;
@@ -14,6 +24,71 @@ int calculate_combo_bonus(CombatCard *cards, int num_cards, DeckType deck_type)
     return calc_prebuilt_bonus(cards, num_cards);
 }
 
+bool combo_bonus_init(void)
+{ CombatCard classes[COMBO_MAX_CLASSES];
+  num_combo_classes = 0;
+
+  // Assign each card the index of its (species, color, order) profile
+  for(int i = 0; i < FULL_DECK_SIZE; i++)
+  { CombatCard c = { fullDeck[i].species, fullDeck[i].color, fullDeck[i].order };
+    int k;
+    for(k = 0; k < num_combo_classes; k++)
+    { if(classes[k].species == c.species && classes[k].color == c.color &&
+         classes[k].order == c.order)
+        break;
+    }
+    if(k == num_combo_classes)
+    { if(num_combo_classes == COMBO_MAX_CLASSES)
+      { fprintf(stderr, "Error: more than %d combo profiles in fullDeck\n",
+                COMBO_MAX_CLASSES);
+        num_combo_classes = 0;
+        return false;
+      }
+      classes[num_combo_classes++] = c;
+    }
+    combo_class_of_card[i] = (uint8_t)k;
+  }
+
+  // Evaluate the reference calculators once per profile pair/triple
+  for(int rules = 0; rules < 2; rules++)
+  { DeckType deck_type = (rules == 0) ? DECK_RANDOM : DECK_MONOCHROME;
+    for(int a = 0; a < num_combo_classes; a++)
+      for(int b = 0; b < num_combo_classes; b++)
+      { CombatCard cards[3] = { classes[a], classes[b] };
+        combo_pair_table[rules][a][b] =
+          (uint8_t)calculate_combo_bonus(cards, 2, deck_type);
+
+        for(int c = 0; c < num_combo_classes; c++)
+        { cards[2] = classes[c];
+          combo_triple_table[rules][a][b][c] =
+            (uint8_t)calculate_combo_bonus(cards, 3, deck_type);
+        }
+      }
+  }
+  return true;
+} // combo_bonus_init
+
+int combo_bonus_lookup(const uint8_t *card_indices, int num_cards, DeckType deck_type)
+{ int rules = (deck_type == DECK_RANDOM) ? 0 : 1;
+
+  if(num_cards == 2)
+    return combo_pair_table[rules][combo_class_of_card[card_indices[0]]]
+           [combo_class_of_card[card_indices[1]]];
+  if(num_cards == 3)
+    return combo_triple_table[rules][combo_class_of_card[card_indices[0]]]
+           [combo_class_of_card[card_indices[1]]]
+           [combo_class_of_card[card_indices[2]]];
+  return 0;
+} // combo_bonus_lookup
+
+uint8_t combo_class_count(void)
+{ return num_combo_classes;
+}
+
+uint8_t combo_class_of(uint8_t card_index)
+{ return combo_class_of_card[card_index];
+}
+
 int calc_random_bonus(CombatCard *cards, int num_cards)
 { int species_counts[SPECIES_COUNT] = {0};
   int order_counts[ORDER_COUNT] = {0};
@@ -16,6 +16,21 @@ typedef struct
 // Main calculation function
 int calculate_combo_bonus(CombatCard *cards, int num_cards, DeckType deck_type);
 
+// Table-driven lookup by fullDeck card index (the combat hot path).
+// Every card maps to one of a few distinct (species, color, order) profiles;
+// bonuses for every profile pair/triple are precomputed from the functions
+// above by combo_bonus_init(), which must run once at startup before any
+// combat (main() does it; tests call it themselves). It fails, and the caller
+// must abort, when fullDeck has more than COMBO_MAX_CLASSES profiles.
+#define COMBO_MAX_CLASSES 24
+
+bool combo_bonus_init(void);
+int combo_bonus_lookup(const uint8_t *card_indices, int num_cards, DeckType deck_type);
+// The profile of a card and the number of profiles, for callers that keep
+// their own copy of the tables (the batch simulator's gathers)
+uint8_t combo_class_count(void);
+uint8_t combo_class_of(uint8_t card_index);
+
 // Mode-specific calculators
 int calc_random_bonus(CombatCard *cards, int num_cards);
 int calc_prebuilt_bonus(CombatCard *cards, int num_cards);
@@ -7,7 +7,9 @@
 // Constants
 #define FULL_DECK_SIZE 120
 #define MAX_NUMBER_OF_TURNS 500
-#define MAX_NUMBER_OF_SIM 1000
+#define DEFAULT_NUMBER_OF_SIM 1000
+#define MAX_SIM_THREADS 256
+#define MAX_AI_SEARCH_THREADS 64
 #define DEBUG_NUMBER_OF_SIM 1
 #define AVERAGE_POWER_FOR_MULLIGAN 4.98
 #define INITIAL_CASH_DEFAULT 30
@@ -2,7 +2,8 @@
 // Game context implementation
 
 #include "game_context.h"
-#include "../util/mtwister.h"
+#include "../util/rnd.h"
+#include "../util/arena.h"
 #include <stdlib.h>
 #include <stdio.h>
 
@@ -12,16 +13,50 @@ GameContext* create_game_context(config_t* cfg)
         return NULL;
     }
     
-  GameContext* ctx = (GameContext*)malloc(sizeof(GameContext));
+  GameContext* ctx = (GameContext*)calloc(1, sizeof(GameContext));
   if(ctx == NULL) return NULL;
 
-  ctx->rng = seedRand(cfg->prng_seed);
+  if(!RND_init(&ctx->rng, cfg->prng_backend, cfg->prng_seed))
+  { free(ctx);
+    return NULL;
+  }
   ctx->config = cfg;
+  ctx->arena = NULL;
+  ctx->agent_ctx[PLAYER_A] = NULL;
+  ctx->agent_ctx[PLAYER_B] = NULL;
+  ctx->game_ctx = NULL;
+  ctx->game = NULL;
+  ctx->action_trace = NULL;
+  ctx->match_log = NULL;
 
   return ctx;
 } // create_game_context
 
+GameContext* create_game_context_for_stream(config_t* cfg, uint32_t stream_id)
+{ GameContext* ctx = create_game_context(cfg);
+  if(ctx == NULL) return NULL;
+
+  RND_split(&ctx->rng, stream_id);
+
+  return ctx;
+} // create_game_context_for_stream
+
 void destroy_game_context(GameContext* ctx)
 { if(ctx != NULL)
+  { RND_release(&ctx->rng);
+    arena_destroy(ctx->arena);
     free(ctx);
+  }
 } // destroy_game_context
+
+bool init_worker_context(GameContext* ctx, const GameContext* parent, uint32_t seed)
+{ *ctx = (GameContext){0};
+  ctx->config = parent->config;
+  return RND_init(&ctx->rng, parent->rng.backend, seed);
+} // init_worker_context
+
+void release_worker_context(GameContext* ctx)
+{ RND_release(&ctx->rng);
+  arena_destroy(ctx->arena);
+  ctx->arena = NULL;
+} // release_worker_context
@@ -1,20 +1,45 @@
 #ifndef GAME_CONTEXT_H
 #define GAME_CONTEXT_H
 
-#include "../util/mtwister.h"
+#include "../util/rnd.h"
 #include "game_types.h"
 
 // Forward declaration
 //typedef struct config config_t;
 
-typedef struct
-{ MTRand rng;
+typedef struct GameContext
+{ RndState rng;     // selectable backend, see RndBackend in rnd.h
   config_t* config; // For runtime settings (numsim, modes, etc.)
+  struct Arena* arena; // search agents' scratch memory, created on first use
+  // Contexts handed to each seat's strategy (NULL = this one). Keeps the
+  // agents' own random draws (playouts, random choices) off this context's
+  // stream, which then only feeds chance events: deal, reshuffles, dice.
+  struct GameContext* agent_ctx[2];
+  // Set on an agent's context while its game is played: the game's context
+  // and state. Actions the agent applies to that state take their chance
+  // events (reshuffles) from the game's stream, so the game can be replayed
+  // from its actions alone; searches on copies keep the agent's stream.
+  struct GameContext* game_ctx;
+  const struct gamestate* game;
+  // Actions of the game played on this context are recorded to or replayed
+  // from here (NULL = neither), see actions/action_trace.h
+  struct ActionTrace* action_trace;
+  // Where stda.auto games are logged (NULL = not logged), see rating/match_log.h
+  struct MatchLogBuffer* match_log;
   // Future: network_context, ui_context, etc.
 } GameContext;
 
 // Context management functions
 GameContext* create_game_context(config_t* cfg);
+// Context seeded for an independent RNG stream (one per simulation worker);
+// stream 0 is identical to create_game_context()
+GameContext* create_game_context_for_stream(config_t* cfg, uint32_t stream_id);
 void destroy_game_context(GameContext* ctx);
 
+// A search worker's context in the caller's storage: every field cleared, then
+// the config and PRNG backend of `parent` with a stream of its own from `seed`
+bool init_worker_context(GameContext* ctx, const GameContext* parent, uint32_t seed);
+// Frees what a worker context holds (PRNG state, arena)
+void release_worker_context(GameContext* ctx);
+
 #endif // GAME_CONTEXT_H
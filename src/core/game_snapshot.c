@@ -0,0 +1,358 @@
+// game_snapshot.c
+// Gamestate snapshot encoding and snapshot files (see game_snapshot.h)
+
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "game_snapshot.h"
+#include "game_constants.h"
+#include "zobrist.h"
+#include "../structures/deckstack.h"
+
+#define SNAPSHOT_DECK_BYTES MAX_DECK_STACK_SIZE
+#define SNAPSHOT_HAND_BYTES 12
+#define SNAPSHOT_DISCARD_BYTES 40
+#define SNAPSHOT_COMBAT_BYTES 3
+#define SNAPSHOT_PLAYER_BYTES (4 + SNAPSHOT_DECK_BYTES + SNAPSHOT_HAND_BYTES + \
+                               SNAPSHOT_DISCARD_BYTES + SNAPSHOT_COMBAT_BYTES)
+#define SNAPSHOT_PLAYERS_AT 18
+#define SNAPSHOT_RNG_AT (SNAPSHOT_PLAYERS_AT + 2 * SNAPSHOT_PLAYER_BYTES)
+
+_Static_assert(SNAPSHOT_RNG_AT == 216, "snapshot player zones end at byte 216");
+_Static_assert(SNAPSHOT_RNG_AT + 40 == GAMESTATE_SNAPSHOT_BYTES, "snapshot PRNG part fills the record");
+_Static_assert(GAMESTATE_SNAPSHOT_BYTES + 4 + 4 * STATE_VECTOR_LENGTH <= GAMESTATE_SNAPSHOT_MT_BYTES,
+               "MT19937 state fits its extension");
+
+static void put16(uint8_t* p, uint16_t v)
+{ p[0] = (uint8_t)v;
+  p[1] = (uint8_t)(v >> 8);
+}
+
+static void put32(uint8_t* p, uint32_t v)
+{ for(int i = 0; i < 4; i++)
+    p[i] = (uint8_t)(v >> 8 * i);
+}
+
+static void put64(uint8_t* p, uint64_t v)
+{ for(int i = 0; i < 8; i++)
+    p[i] = (uint8_t)(v >> 8 * i);
+}
+
+static uint16_t get16(const uint8_t* p)
+{ return (uint16_t)(p[0] | p[1] << 8);
+}
+
+static uint32_t get32(const uint8_t* p)
+{ uint32_t v = 0;
+  for(int i = 3; i >= 0; i--)
+    v = v << 8 | p[i];
+  return v;
+}
+
+static uint64_t get64(const uint8_t* p)
+{ uint64_t v = 0;
+  for(int i = 7; i >= 0; i--)
+    v = v << 8 | p[i];
+  return v;
+}
+
+size_t gamestate_snapshot_size(RndBackend backend)
+{ return backend == RND_BACKEND_MT19937 ? GAMESTATE_SNAPSHOT_MT_BYTES : GAMESTATE_SNAPSHOT_BYTES;
+}
+
+// A zone is its size, then `room` card bytes (unused ones 0)
+static uint8_t* put_zone(uint8_t* p, const uint8_t* cards, uint8_t size, uint8_t room)
+{ *p++ = size;
+  memcpy(p, cards, size);
+  memset(p + size, 0, room - size);
+  return p + room;
+}
+
+size_t gamestate_serialize(const struct gamestate* gstate, const RndState* rng, uint8_t* out)
+{ RndBackend backend = rng != NULL ? rng->backend : RND_BACKEND_COUNT;
+  size_t size = gamestate_snapshot_size(backend);
+  memset(out, 0, size);
+
+  put16(out, GAMESTATE_SNAPSHOT_VERSION);
+  out[2] = (uint8_t)backend;
+  put16(out + 4, gstate->current_cash_balance[PLAYER_A]);
+  put16(out + 6, gstate->current_cash_balance[PLAYER_B]);
+  put16(out + 8, gstate->turn);
+  out[10] = gstate->current_player;
+  out[11] = gstate->player_to_move;
+  out[12] = gstate->game_state;
+  out[13] = gstate->turn_phase;
+  out[14] = gstate->current_energy[PLAYER_A];
+  out[15] = gstate->current_energy[PLAYER_B];
+  out[16] = gstate->someone_has_zero_energy;
+
+  uint8_t* p = out + SNAPSHOT_PLAYERS_AT;
+  for(PlayerID player = PLAYER_A; player <= PLAYER_B; player++)
+  { p = put_zone(p, gstate->deck[player].card_indices, gstate->deck[player].size, SNAPSHOT_DECK_BYTES);
+    p = put_zone(p, gstate->hand[player].cards, gstate->hand[player].size, SNAPSHOT_HAND_BYTES);
+    p = put_zone(p, gstate->discard[player].cards, gstate->discard[player].size, SNAPSHOT_DISCARD_BYTES);
+    p = put_zone(p, gstate->combat_zone[player].cards, gstate->combat_zone[player].size,
+                 SNAPSHOT_COMBAT_BYTES);
+  }
+
+  if(rng != NULL)
+  { put32(out + SNAPSHOT_RNG_AT, rng->seed);
+    for(int i = 0; i < 4; i++)
+      put64(out + SNAPSHOT_RNG_AT + 8 + 8 * i, rng->xo.s[i]);
+    if(backend == RND_BACKEND_MT19937)
+    { put32(out + GAMESTATE_SNAPSHOT_BYTES, (uint32_t)rng->mt->index);
+      for(int i = 0; i < STATE_VECTOR_LENGTH; i++)
+        put32(out + GAMESTATE_SNAPSHOT_BYTES + 4 + 4 * i, rng->mt->mt[i]);
+    }
+  }
+  return size;
+} // gamestate_serialize
+
+// Sizes within the zone and card indices within the full deck
+static bool zone_ok(const uint8_t* p, uint8_t room, uint8_t* total)
+{ if(p[0] > room) return false;
+  for(uint8_t i = 0; i < p[0]; i++)
+    if(p[1 + i] >= FULL_DECK_SIZE) return false;
+  *total += p[0];
+  return true;
+}
+
+static bool snapshot_ok(const uint8_t* in, size_t size)
+{ if(size < GAMESTATE_SNAPSHOT_BYTES || get16(in) != GAMESTATE_SNAPSHOT_VERSION ||
+     in[2] > RND_BACKEND_COUNT || size < gamestate_snapshot_size((RndBackend)in[2]))
+    return false;
+  if(in[10] > PLAYER_B || in[11] > PLAYER_B || in[12] > ACTIVE || in[13] > DEFENSE || in[16] > 1)
+    return false;
+
+  const uint8_t* p = in + SNAPSHOT_PLAYERS_AT;
+  for(int player = 0; player < 2; player++)
+  { // A player owns MAX_DECK_STACK_SIZE cards at most, wherever they are
+    uint8_t total = 0;
+    bool ok = zone_ok(p, SNAPSHOT_DECK_BYTES, &total);
+    p += 1 + SNAPSHOT_DECK_BYTES;
+    ok = ok && zone_ok(p, SNAPSHOT_HAND_BYTES, &total);
+    p += 1 + SNAPSHOT_HAND_BYTES;
+    ok = ok && zone_ok(p, SNAPSHOT_DISCARD_BYTES, &total);
+    p += 1 + SNAPSHOT_DISCARD_BYTES;
+    ok = ok && zone_ok(p, SNAPSHOT_COMBAT_BYTES, &total);
+    p += 1 + SNAPSHOT_COMBAT_BYTES;
+    if(!ok || total > MAX_DECK_STACK_SIZE) return false;
+  }
+
+  if(in[2] == RND_BACKEND_MT19937 && get32(in + GAMESTATE_SNAPSHOT_BYTES) > STATE_VECTOR_LENGTH)
+    return false;
+  return true;
+} // snapshot_ok
+
+static bool load_rng(const uint8_t* in, RndBackend backend, RndState* rng)
+{ uint32_t seed = get32(in + SNAPSHOT_RNG_AT);
+  if(rng->backend != backend || (backend == RND_BACKEND_MT19937 && rng->mt == NULL))
+  { RND_release(rng);
+    if(!RND_init(rng, backend, seed)) return false;
+  }
+  rng->seed = seed;
+  for(int i = 0; i < 4; i++)
+    rng->xo.s[i] = get64(in + SNAPSHOT_RNG_AT + 8 + 8 * i);
+  if(backend == RND_BACKEND_MT19937)
+  { rng->mt->index = (int32_t)get32(in + GAMESTATE_SNAPSHOT_BYTES);
+    for(int i = 0; i < STATE_VECTOR_LENGTH; i++)
+      rng->mt->mt[i] = get32(in + GAMESTATE_SNAPSHOT_BYTES + 4 + 4 * i);
+  }
+  return true;
+} // load_rng
+
+bool gamestate_deserialize(const uint8_t* in, size_t size, struct gamestate* gstate, RndState* rng)
+{ if(!snapshot_ok(in, size)) return false;
+
+  memset(gstate, 0, sizeof(struct gamestate));
+  gstate->current_cash_balance[PLAYER_A] = get16(in + 4);
+  gstate->current_cash_balance[PLAYER_B] = get16(in + 6);
+  gstate->turn = get16(in + 8);
+  gstate->current_player = in[10];
+  gstate->player_to_move = in[11];
+  gstate->game_state = in[12];
+  gstate->turn_phase = in[13];
+  gstate->current_energy[PLAYER_A] = in[14];
+  gstate->current_energy[PLAYER_B] = in[15];
+  gstate->someone_has_zero_energy = in[16];
+
+  // Through the collections, so that their bitsets are rebuilt too
+  const uint8_t* p = in + SNAPSHOT_PLAYERS_AT;
+  for(PlayerID player = PLAYER_A; player <= PLAYER_B; player++)
+  { DeckStk_emptyOut(&gstate->deck[player]);
+    for(uint8_t i = 0; i < p[0]; i++)
+      DeckStk_push(&gstate->deck[player], p[1 + i]);
+    p += 1 + SNAPSHOT_DECK_BYTES;
+    Hand_init(&gstate->hand[player]);
+    for(uint8_t i = 0; i < p[0]; i++)
+      Hand_add(&gstate->hand[player], p[1 + i]);
+    p += 1 + SNAPSHOT_HAND_BYTES;
+    Discard_init(&gstate->discard[player]);
+    for(uint8_t i = 0; i < p[0]; i++)
+      Discard_add(&gstate->discard[player], p[1 + i]);
+    p += 1 + SNAPSHOT_DISCARD_BYTES;
+    CombatZone_init(&gstate->combat_zone[player]);
+    for(uint8_t i = 0; i < p[0]; i++)
+      CombatZone_add(&gstate->combat_zone[player], p[1 + i]);
+    p += 1 + SNAPSHOT_COMBAT_BYTES;
+  }
+  zobrist_refresh(gstate);
+
+  RndBackend backend = (RndBackend)in[2];
+  if(rng != NULL && backend != RND_BACKEND_COUNT)
+    return load_rng(in, backend, rng);
+  return true;
+} // gamestate_deserialize
+
+#define GAME_SNAPSHOT_STDIO_BUFFER (1u << 20)
+
+static bool write_header(GameSnapshotWriter* writer, uint64_t index_offset)
+{ GameSnapshotFileHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, GAME_SNAPSHOT_FILE_MAGIC, sizeof(header.magic));
+  header.version = GAME_SNAPSHOT_FILE_VERSION;
+  header.header_size = sizeof(GameSnapshotFileHeader);
+  header.record_size = (uint32_t)writer->record_size;
+  header.index_entry_size = sizeof(GameSnapshotIndex);
+  header.rng_backend = writer->rng_backend;
+  header.num_snapshots = writer->num_snapshots;
+  header.index_offset = index_offset;
+  return fwrite(&header, sizeof(header), 1, writer->file) == 1;
+} // write_header
+
+GameSnapshotWriter* game_snapshot_file_create(const char* path, RndBackend rng_backend)
+{ if(rng_backend > RND_BACKEND_COUNT) return NULL;
+
+  GameSnapshotWriter* writer = (GameSnapshotWriter*)calloc(1, sizeof(GameSnapshotWriter));
+  if(writer == NULL) return NULL;
+  writer->file = fopen(path, "wb");
+  if(writer->file == NULL)
+  { perror("Failed to create snapshot file");
+    free(writer);
+    return NULL;
+  }
+  setvbuf(writer->file, NULL, _IOFBF, GAME_SNAPSHOT_STDIO_BUFFER);
+  writer->rng_backend = rng_backend;
+  writer->record_size = gamestate_snapshot_size(rng_backend);
+  writer->failed = !write_header(writer, 0);
+  return writer;
+} // game_snapshot_file_create
+
+bool game_snapshot_file_add(GameSnapshotWriter* writer, const struct gamestate* gstate,
+                            const RndState* rng, uint64_t tag)
+{ RndBackend backend = rng != NULL ? rng->backend : RND_BACKEND_COUNT;
+  if(backend != writer->rng_backend) return false;
+
+  // The index stays in memory until the file is closed, grown by doubling
+  if(writer->num_snapshots == writer->capacity)
+  { uint64_t capacity = writer->capacity ? 2 * writer->capacity : 4096;
+    GameSnapshotIndex* index = (GameSnapshotIndex*)realloc(writer->index,
+                                                           capacity * sizeof(GameSnapshotIndex));
+    if(index == NULL)
+    { writer->failed = true;
+      return false;
+    }
+    writer->index = index;
+    writer->capacity = capacity;
+  }
+
+  uint8_t record[GAMESTATE_SNAPSHOT_MT_BYTES];
+  size_t size = gamestate_serialize(gstate, rng, record);
+  if(fwrite(record, 1, size, writer->file) != size)
+  { writer->failed = true;
+    return false;
+  }
+
+  GameSnapshotIndex* entry = &writer->index[writer->num_snapshots++];
+  memset(entry, 0, sizeof(GameSnapshotIndex));
+  entry->key = gamestate_key(gstate);
+  entry->tag = tag;
+  entry->turn = gstate->turn;
+  entry->player_to_move = gstate->player_to_move;
+  entry->turn_phase = gstate->turn_phase;
+  entry->game_state = gstate->game_state;
+  return true;
+} // game_snapshot_file_add
+
+bool game_snapshot_file_close(GameSnapshotWriter* writer)
+{ if(writer == NULL) return false;
+
+  uint64_t index_offset = sizeof(GameSnapshotFileHeader) + writer->num_snapshots * writer->record_size;
+  bool ok = !writer->failed &&
+            fwrite(writer->index, sizeof(GameSnapshotIndex), writer->num_snapshots, writer->file) ==
+            writer->num_snapshots &&
+            fseek(writer->file, 0, SEEK_SET) == 0 && write_header(writer, index_offset);
+  ok &= fclose(writer->file) == 0;
+  free(writer->index);
+  free(writer);
+  return ok;
+} // game_snapshot_file_close
+
+bool game_snapshot_file_open(const char* path, GameSnapshotReader* reader)
+{ memset(reader, 0, sizeof(GameSnapshotReader));
+
+  int fd = open(path, O_RDONLY);
+  if(fd < 0)
+  { perror("Failed to open snapshot file");
+    return false;
+  }
+  struct stat st;
+  if(fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(GameSnapshotFileHeader))
+  { fprintf(stderr, "Error: %s is not a snapshot file\n", path);
+    close(fd);
+    return false;
+  }
+  void* map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);  // the mapping keeps the file
+  if(map == MAP_FAILED)
+  { perror("Failed to map snapshot file");
+    return false;
+  }
+  reader->data = (const uint8_t*)map;
+  reader->size = (size_t)st.st_size;
+  reader->header = (const GameSnapshotFileHeader*)map;
+
+  // The records and index must fill the file exactly: a file whose writer
+  // did not close it has index_offset 0
+  const GameSnapshotFileHeader* h = reader->header;
+  bool ok = memcmp(h->magic, GAME_SNAPSHOT_FILE_MAGIC, sizeof(h->magic)) == 0 &&
+            h->version == GAME_SNAPSHOT_FILE_VERSION &&
+            h->header_size == sizeof(GameSnapshotFileHeader) &&
+            h->index_entry_size == sizeof(GameSnapshotIndex) &&
+            h->rng_backend <= RND_BACKEND_COUNT &&
+            h->record_size == gamestate_snapshot_size((RndBackend)h->rng_backend) &&
+            h->num_snapshots <= (reader->size - h->header_size) / h->record_size &&
+            h->index_offset == h->header_size + h->num_snapshots * h->record_size &&
+            reader->size == h->index_offset + h->num_snapshots * sizeof(GameSnapshotIndex);
+  if(!ok)
+  { fprintf(stderr, "Error: %s is not a complete version %d snapshot file\n", path,
+            GAME_SNAPSHOT_FILE_VERSION);
+    game_snapshot_reader_close(reader);
+    return false;
+  }
+  reader->records = reader->data + h->header_size;
+  reader->index = (const GameSnapshotIndex*)(reader->data + h->index_offset);
+  reader->num_snapshots = h->num_snapshots;
+  return true;
+} // game_snapshot_file_open
+
+void game_snapshot_reader_close(GameSnapshotReader* reader)
+{ if(reader->data != NULL)
+    munmap((void*)reader->data, reader->size);
+  memset(reader, 0, sizeof(GameSnapshotReader));
+}
+
+const uint8_t* game_snapshot_record(const GameSnapshotReader* reader, uint64_t k)
+{ if(k >= reader->num_snapshots) return NULL;
+  return reader->records + k * reader->header->record_size;
+}
+
+bool game_snapshot_load(const GameSnapshotReader* reader, uint64_t k,
+                        struct gamestate* gstate, RndState* rng)
+{ const uint8_t* record = game_snapshot_record(reader, k);
+  return record != NULL && gamestate_deserialize(record, reader->header->record_size, gstate, rng);
+}
@@ -0,0 +1,126 @@
+// game_snapshot.h
+// Binary snapshots of a position: struct gamestate and, optionally, the state
+// of the PRNG that plays its chance events, in a versioned fixed-width
+// encoding; and snapshot files, bulk containers of such records with an
+// index, read back through a memory map so that position k is found without
+// parsing the ones before it.
+
+#ifndef GAME_SNAPSHOT_H
+#define GAME_SNAPSHOT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "game_types.h"
+#include "../util/rnd.h"
+
+#define GAMESTATE_SNAPSHOT_VERSION 1
+
+// Record layout, little-endian, the same whatever the build's FEATURES (card
+// bitsets and the Zobrist key are derived, and rebuilt on load; the
+// gstate->reshuffled card set is not recorded, so a loaded position's decks
+// count as never reshuffled when searches determinize it):
+//     0  u16 version         2  u8 rng backend (RND_BACKEND_COUNT: none)  3  u8 0
+//     4  u16 cash[2]         8  u16 turn
+//    10  u8 current_player, player_to_move, game_state, turn_phase
+//    14  u8 energy[2]       16  u8 someone_has_zero_energy               17  u8 0
+//    18  player A, 117 player B, 99 bytes each: deck size, deck[40], hand size,
+//        hand[12], discard size, discard[40], combat zone size, combat zone[3]
+//   216  u32 rng seed      220  u32 0      224  u64 xoshiro256** s[4]
+//   256  MT19937 backend only: i32 index, u32 mt[624], zero padding
+#define GAMESTATE_SNAPSHOT_BYTES 256
+#define GAMESTATE_SNAPSHOT_MT_BYTES (GAMESTATE_SNAPSHOT_BYTES + 2560)
+
+// Record size for positions saved with a PRNG of this backend
+// (RND_BACKEND_COUNT: positions saved without one)
+size_t gamestate_snapshot_size(RndBackend backend);
+
+// Encode gstate, and rng if not NULL, into out (gamestate_snapshot_size()
+// bytes for rng's backend); returns the number of bytes written
+size_t gamestate_serialize(const struct gamestate* gstate, const RndState* rng, uint8_t* out);
+
+// Decode a record of `size` bytes into gstate. If rng is not NULL and the
+// record has a PRNG state, rng (initialized, or zeroed) takes it over,
+// switching backend if need be; a record without one leaves rng alone.
+// Returns false, with gstate undefined, on a record of another version or
+// with fields out of range.
+bool gamestate_deserialize(const uint8_t* in, size_t size, struct gamestate* gstate, RndState* rng);
+
+// Snapshot files
+//   GameSnapshotFileHeader
+//   records: num_snapshots x record_size bytes (record k at header_size + k * record_size)
+//   index:   GameSnapshotIndex[num_snapshots], at index_offset
+// All the records of a file have the same size: the file is written with one
+// PRNG backend, or none.
+#define GAME_SNAPSHOT_FILE_MAGIC "ORSNAP\r\n"   // 8 bytes, no terminator
+#define GAME_SNAPSHOT_FILE_VERSION 1
+
+typedef struct
+{ char magic[8];
+  uint32_t version;
+  uint32_t header_size;
+  uint32_t record_size;
+  uint32_t index_entry_size;  // sizeof(GameSnapshotIndex)
+  uint32_t rng_backend;       // RndBackend, RND_BACKEND_COUNT without PRNG state
+  uint32_t reserved;
+  uint64_t num_snapshots;
+  uint64_t index_offset;      // 0 until the file is closed
+} GameSnapshotFileHeader;
+
+// What a benchmark selects positions by, without decoding them
+typedef struct
+{ uint64_t key;               // gamestate_key() (core/zobrist.h)
+  uint64_t tag;               // the writer's, e.g. the game the position comes from
+  uint16_t turn;
+  uint8_t player_to_move;
+  uint8_t turn_phase;
+  uint8_t game_state;
+  uint8_t reserved[3];
+} GameSnapshotIndex;
+
+_Static_assert(sizeof(GameSnapshotFileHeader) == 48, "snapshot file header is 48 bytes");
+_Static_assert(sizeof(GameSnapshotIndex) == 24, "snapshot index entries are 24 bytes");
+
+typedef struct
+{ FILE* file;
+  RndBackend rng_backend;
+  size_t record_size;
+  GameSnapshotIndex* index;
+  uint64_t num_snapshots;
+  uint64_t capacity;
+  bool failed;                // a write failed; game_snapshot_file_close() reports it
+} GameSnapshotWriter;
+
+// Create (truncate) path for positions saved with PRNGs of rng_backend
+// (RND_BACKEND_COUNT: without PRNG state). NULL on failure.
+GameSnapshotWriter* game_snapshot_file_create(const char* path, RndBackend rng_backend);
+// Append a position; rng must be of the file's backend (NULL for a file
+// without PRNG state). Needs zobrist_init() for the index key.
+bool game_snapshot_file_add(GameSnapshotWriter* writer, const struct gamestate* gstate,
+                            const RndState* rng, uint64_t tag);
+// Write the index and the final header, and close; false if any write failed
+bool game_snapshot_file_close(GameSnapshotWriter* writer);
+
+typedef struct
+{ const GameSnapshotFileHeader* header;
+  const uint8_t* data;
+  size_t size;
+  const uint8_t* records;
+  const GameSnapshotIndex* index;
+  uint64_t num_snapshots;
+} GameSnapshotReader;
+
+// Map path read-only; prints the reason to stderr and returns false if it is
+// not a closed snapshot file of this version
+bool game_snapshot_file_open(const char* path, GameSnapshotReader* reader);
+void game_snapshot_reader_close(GameSnapshotReader* reader);
+
+// Record k in place (header->record_size bytes), NULL if out of range
+const uint8_t* game_snapshot_record(const GameSnapshotReader* reader, uint64_t k);
+// Decode position k into gstate (and rng, see gamestate_deserialize)
+bool game_snapshot_load(const GameSnapshotReader* reader, uint64_t k,
+                        struct gamestate* gstate, RndState* rng);
+
+#endif // GAME_SNAPSHOT_H
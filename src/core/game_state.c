@@ -5,6 +5,7 @@
 
 #include "game_state.h"
 #include "game_constants.h"
+#include "zobrist.h"
 #include "../util/rnd.h"
 #include "../structures/deckstack.h"
 #include "game_context.h"
@@ -18,10 +19,11 @@ void setup_game(uint16_t initial_cash, struct gamestate* gstate, GameContext* ct
   gstate->current_energy[PLAYER_B] = INITIAL_ENERGY_DEFAULT;
   gstate->someone_has_zero_energy = false;
   gstate->game_state = ACTIVE;
+  CardBitset_clear(&gstate->reshuffled);
 
   // Initialize decks
-  gstate->deck[PLAYER_A].top = -1;
-  gstate->deck[PLAYER_B].top = -1;
+  DeckStk_emptyOut(&gstate->deck[PLAYER_A]);
+  DeckStk_emptyOut(&gstate->deck[PLAYER_B]);
 
   // Randomly distribute cards
   uint8_t rndCardIndex[FULL_DECK_SIZE];
@@ -52,6 +54,7 @@ void setup_game(uint16_t initial_cash, struct gamestate* gstate, GameContext* ct
     Hand_add(&gstate->hand[PLAYER_B], cardindex);
   }
 
+  zobrist_refresh(gstate);
 } // setup_game
 
 void collect_1_luna(struct gamestate* gstate)
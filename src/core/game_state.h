@@ -4,6 +4,8 @@
 #ifndef GAME_STATE_H
 #define GAME_STATE_H
 
+#include <string.h>
+
 #include "game_types.h"
 #include "../ai_strat/ai_strategy.h"
 
@@ -12,4 +14,13 @@ void setup_game(uint16_t initial_cash, struct gamestate* gstate, GameContext* ct
 void collect_1_luna(struct gamestate* gstate);
 void change_current_player(struct gamestate* gstate);
 
+// Copy a complete game state (e.g. a search node or playout start). struct
+// gamestate is pointer-free and cache-line sized, so this is a single
+// fixed-size memcpy the compiler turns into a handful of vector moves; the
+// copy shares nothing with the source. dst and src must not overlap.
+static inline void clone_gamestate(struct gamestate* restrict dst,
+                                   const struct gamestate* restrict src)
+{ memcpy(dst, src, sizeof(struct gamestate));
+}
+
 #endif // GAME_STATE_H
@@ -8,6 +8,7 @@
 #include <stdbool.h>
 #include "../structures/deckstack.h"
 #include "../structures/card_collection.h"
+#include "../util/rnd.h"
 
 // Player identification
 typedef enum
@@ -113,9 +114,27 @@ struct card
 }; // card
 
 // Game state structure
+// Packed for search: enums are stored in single bytes, and the struct is
+// aligned to, and sized in, whole cache lines. The reshuffled card set comes
+// first, then the scalars, then the piles, with no interior padding unless
+// the piles carry GAMESTATE_CARD_BITSETS sets. Size: 256 bytes (the
+// GAMESTATE_ZOBRIST key fits in the tail padding), 448 with
+// GAMESTATE_CARD_BITSETS, with or without the key. It holds no pointers, so
+// clone_gamestate() is one fixed-size memcpy.
+#define GAMESTATE_ALIGNMENT 64
+
 struct gamestate
-{ PlayerID current_player;
+{ // Cards a player's last reshuffle put into its deck (its discard pile, seen
+  // by both players), while they stay in that deck or hand. Game play ignores
+  // it; determinizations keep these cards where they can be
+  // (randomize_hidden_information() in ai_strat_lib_search.h).
+  _Alignas(GAMESTATE_ALIGNMENT) CardBitset reshuffled;
   uint16_t current_cash_balance[2];
+  uint16_t turn;
+  uint8_t current_player;      // PlayerID
+  uint8_t player_to_move;      // PlayerID
+  uint8_t game_state;          // GameStateEnum
+  uint8_t turn_phase;          // TurnPhase
   uint8_t current_energy[2];
   bool someone_has_zero_energy;
 
@@ -123,13 +142,14 @@ struct gamestate
   Hand hand[2];
   Discard discard[2];
   CombatZone combat_zone[2];
-
-  uint16_t turn;
-  GameStateEnum game_state;
-  TurnPhase turn_phase;
-  PlayerID player_to_move;
+#ifdef GAMESTATE_ZOBRIST
+  uint64_t zobrist;            // card part of the Zobrist key (core/zobrist.h)
+#endif
 }; // gamestate
 
+_Static_assert(sizeof(struct gamestate) % GAMESTATE_ALIGNMENT == 0,
+               "struct gamestate must be a whole number of cache lines");
+
 /* Game mode enumeration */
 typedef enum
 { MODE_NONE = 0,
@@ -153,6 +173,12 @@ typedef enum
   LANG_ES       /* Spanish */
 } ui_language_t;
 
+/* How search agents split one decision over several threads */
+typedef enum
+{ AI_PARALLEL_ROOT = 0,  /* independent trees, root statistics merged (default) */
+  AI_PARALLEL_TREE       /* one shared tree, atomic statistics and virtual loss */
+} ai_parallel_t;
+
 /* Player Type: interactive or AI */
 typedef enum
 { INTERACTIVE_PLAYER = 0,
@@ -163,24 +189,48 @@ typedef enum
 typedef struct
 { game_mode_t mode;
   bool verbose;
-  int numsim;
+  uint64_t numsim;
+  int num_threads;      /* stda.auto worker threads (1 = serial) */
   char* input_file;
   char* output_file;
   char* ai_agent;
   ui_language_t language;
   uint32_t prng_seed;
   bool use_random_seed;
+  RndBackend prng_backend;
+  int ai_players[2];    /* stda.auto agent per seat (AIStrategyType, 0 = random) */
+  uint32_t ai_budget;   /* playouts/iterations per AI decision (0 = agent default) */
+  uint32_t ai_time_ms;  /* wall-clock limit per AI decision (0 = none) */
+  int ai_threads;       /* search threads per AI decision (1 = serial) */
+  ai_parallel_t ai_parallel; /* parallel search mode when ai_threads > 1 */
+  char* tournament;     /* stda.auto round-robin agent list (NULL = single match) */
+  bool paired;          /* stda.auto: play every deal twice, seats swapped */
+  char* sprt;           /* stda.auto SPRT spec "ELO0,ELO1[,ALPHA[,BETA]]" (NULL = off) */
+  char* match_log;      /* stda.auto: binary match log to write (NULL = none) */
+  char* match_log_read; /* stda.auto: match log to report on instead of playing */
+  bool match_log_actions; /* stda.auto: also log every game's actions */
+  bool replayable;      /* stda.auto: seed every game from (seed, game index) */
+  char* replay;         /* stda.auto: "JOB:GAME" to rebuild instead of playing (NULL = none) */
+  bool profile;         /* stda.auto: per-phase timing report (needs ORACLE_PROFILE) */
+  bool lazy_deck;       /* decks unordered: draws sample, reshuffles don't shuffle */
+  bool batch;           /* stda.auto: random games in the lockstep batch simulator */
   void* player_config;  /* PlayerConfig* - forward declaration avoidance */
 } config_t;
 
 #include "game_constants.h"
+#include "stats_constants.h"
 
-// Game statistics structure
+// Game statistics structure: streaming accumulators, so the size does not
+// depend on the number of games played (all-zero is a valid empty state)
 struct gamestats
-{ uint16_t cumul_player_wins[2];
-  uint16_t cumul_number_of_draws;
-  uint16_t game_end_turn_number[MAX_NUMBER_OF_SIM];  // look into dynamically allocating space for this as we don't need 1000 entries for interactive modes (we just need one)
-  uint16_t simnum;
+{ uint64_t cumul_player_wins[2];
+  uint64_t cumul_number_of_draws;
+  uint64_t simnum;           // number of games recorded
+  double turn_mean;          // Welford running mean of the game end turn
+  double turn_m2;            // Welford running sum of squared deviations
+  uint16_t turn_min;
+  uint16_t turn_max;
+  uint64_t turn_histogram[HISTOGRAM_TOTAL_BINS];
 }; // gamestats
 
 #endif // GAME_TYPES_H
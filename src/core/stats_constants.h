@@ -7,7 +7,7 @@
 
 #include <stdint.h>
 
-/* Histogram parameters for game turn distribution */
+/* Histogram parameters for the game turn distribution (struct gamestats) */
 #define HISTOGRAM_NUM_BINS 27
 #define HISTOGRAM_BIN_WIDTH 4
 #define HISTOGRAM_MIN_VALUE 20
@@ -7,11 +7,15 @@
 #include "combat.h"
 #include "game_context.h"
 #include "../util/debug.h"
+#include "../util/profile.h"
 #include "game_state.h"
+#include "../actions/action_trace.h"
 
 void play_turn(struct gamestats* gstats, struct gamestate* gstate,
                StrategySet* player_strategies, GameContext* ctx)
-{ begin_of_turn(gstate, ctx);
+{ PROFILE_TURN_BEGIN();
+  PROFILE_SCOPE(PROFILE_TURN);
+  begin_of_turn(gstate, ctx);
 
   attack_phase(gstate, player_strategies, ctx);  // need to pass cfg pointer to provide game mode information
 
@@ -29,7 +33,8 @@ void play_turn(struct gamestats* gstats, struct gamestate* gstate,
 
 // TODO: add a 'UICallbacks* uicb' parameter to this function that will have a function pointer to a function in the UI code that can be called to display the card drawn
 void begin_of_turn(struct gamestate* gstate, GameContext* ctx)
-{ gstate->turn++;  // TODO: may eventually need to look into whethere or not this line of code should be moved to the bottom of the end_of_turn() function
+{ PROFILE_SCOPE(PROFILE_BEGIN_OF_TURN);
+  gstate->turn++;  // TODO: may eventually need to look into whethere or not this line of code should be moved to the bottom of the end_of_turn() function
   gstate->turn_phase = ATTACK;  // TODO: may eventually need to look into whethere or not this line of code should be moved to become the very last instruction in the end_of_turn() function. this is likely to matter only when come the time to implement the MCTS AI engines, due to the nature of the strategy sets that may be required to allow the MCTS to recursively traverse the tree
   gstate->player_to_move = gstate->current_player; // TODO: look into whether the change discussed above for the turn_phase should extend to the player_to_move as well
 
@@ -43,25 +48,36 @@ void begin_of_turn(struct gamestate* gstate, GameContext* ctx)
 } // begin_of_turn
 
 void attack_phase(struct gamestate* gstate, StrategySet* strategies, GameContext* ctx)
-{ PlayerID attacker = gstate->current_player;
+{ PROFILE_SCOPE(PROFILE_ATTACK_PHASE);
+  PlayerID attacker = gstate->current_player;
 
+  if(ctx->action_trace)
+    action_trace_begin_phase(ctx->action_trace, gstate);
   // Call strategy function to make attack decision
-  strategies->attack_strategy[attacker](gstate, ctx);
+  { PROFILE_STRATEGY_SCOPE(PROFILE_ATTACK_STRATEGY_A + attacker);
+    strategies->attack_strategy[attacker](gstate, ctx->agent_ctx[attacker] ? ctx->agent_ctx[attacker] : ctx);
+  }
 
   gstate->turn_phase = DEFENSE;  // TODO: may eventually need to look into whether or not this line of code should be moved inside the attack_strategy function (as the last line of code), when we implement the Monte-Carlo Tree Search AI engines (because of their tree recursive traversal search structure) also see comment at the beginning of the begin_of_turn() function about the timing of when we switch the turn phase back to attack
   gstate->player_to_move = 1 - gstate->current_player; // TODO: look into whether the change discussed above for the turn_phase should extend to the player_to_move as well
 }
 
 void defense_phase(struct gamestate* gstate, StrategySet* strategies, GameContext* ctx)
-{ PlayerID defender = 1 - gstate->current_player;
+{ PROFILE_SCOPE(PROFILE_DEFENSE_PHASE);
+  PlayerID defender = 1 - gstate->current_player;
 
   // Only defend if there's combat
   if(gstate->combat_zone[gstate->current_player].size > 0)  // this check is likely not necessary since it is already done prior to calling the defense_phase function
-    strategies->defense_strategy[defender](gstate, ctx);
+  { if(ctx->action_trace)
+      action_trace_begin_phase(ctx->action_trace, gstate);
+    PROFILE_STRATEGY_SCOPE(PROFILE_DEFENSE_STRATEGY_A + defender);
+    strategies->defense_strategy[defender](gstate, ctx->agent_ctx[defender] ? ctx->agent_ctx[defender] : ctx);
+  }
 }
 
 void end_of_turn(struct gamestate* gstate, GameContext* ctx)
-{ collect_1_luna(gstate);
+{ PROFILE_SCOPE(PROFILE_END_OF_TURN);
+  collect_1_luna(gstate);
   discard_to_7_cards(gstate, ctx); // need to pass cfg pointer to provide game mode information
   change_current_player(gstate);
 
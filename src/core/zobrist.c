@@ -0,0 +1,51 @@
+// zobrist.c
+// Zobrist key tables and from-scratch key computation (see zobrist.h)
+#include "zobrist.h"
+#include "../util/xoshiro.h"
+
+#define ZOBRIST_SEED 0x0AC1E5C4A3D5EEDULL
+
+uint64_t zobrist_card_keys[2][ZOBRIST_PILE_COUNT][FULL_DECK_SIZE];
+
+void zobrist_init(void)
+{ uint64_t state = ZOBRIST_SEED;
+  for(int p = 0; p < 2; p++)
+    for(int pile = 0; pile < ZOBRIST_PILE_COUNT; pile++)
+      for(int c = 0; c < FULL_DECK_SIZE; c++)
+        zobrist_card_keys[p][pile][c] = mix64(state += 0x9E3779B97F4A7C15ULL);
+}
+
+static uint64_t hash_pile(PlayerID player, ZobristPile pile, const uint8_t* cards, uint8_t n)
+{ uint64_t key = 0;
+  for(uint8_t i = 0; i < n; i++)
+    key ^= zobrist_card_keys[player][pile][cards[i]];
+  return key;
+}
+
+uint64_t zobrist_cards(const struct gamestate* gstate)
+{ uint64_t key = 0;
+  for(PlayerID p = PLAYER_A; p <= PLAYER_B; p++)
+  { key ^= hash_pile(p, ZOBRIST_DECK, gstate->deck[p].card_indices, gstate->deck[p].size);
+    key ^= hash_pile(p, ZOBRIST_HAND, gstate->hand[p].cards, gstate->hand[p].size);
+    key ^= hash_pile(p, ZOBRIST_DISCARD, gstate->discard[p].cards, gstate->discard[p].size);
+    key ^= hash_pile(p, ZOBRIST_COMBAT, gstate->combat_zone[p].cards, gstate->combat_zone[p].size);
+  }
+  return key;
+}
+
+uint64_t zobrist_scalars(const struct gamestate* gstate)
+{ uint64_t amounts = (uint64_t)gstate->current_cash_balance[PLAYER_A] |
+                     (uint64_t)gstate->current_cash_balance[PLAYER_B] << 16 |
+                     (uint64_t)gstate->turn << 32 |
+                     (uint64_t)gstate->current_energy[PLAYER_A] << 48 |
+                     (uint64_t)gstate->current_energy[PLAYER_B] << 56;
+  uint64_t flags = (uint64_t)gstate->current_player |
+                   (uint64_t)gstate->player_to_move << 8 |
+                   (uint64_t)gstate->game_state << 16 |
+                   (uint64_t)gstate->turn_phase << 24;
+  return mix64(amounts ^ mix64(flags + ZOBRIST_SEED));
+}
+
+uint64_t zobrist_compute(const struct gamestate* gstate)
+{ return zobrist_cards(gstate) ^ zobrist_scalars(gstate);
+}
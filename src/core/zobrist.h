@@ -0,0 +1,76 @@
+// zobrist.h
+// 64-bit Zobrist keys of struct gamestate, for transposition tables
+
+#ifndef ZOBRIST_H
+#define ZOBRIST_H
+
+#include <stdint.h>
+
+#include "game_types.h"
+#include "game_constants.h"
+
+// A key covers which cards each player has in each pile, plus the scalar
+// header (cash, energy, turn, players, phase, game state). Piles are hashed
+// as sets: states that differ only in hand or combat zone order, or in deck
+// order (hidden information, resampled by determinization), share a key.
+//
+// With -DGAMESTATE_ZOBRIST (make FEATURES=-DGAMESTATE_ZOBRIST) the card part
+// is kept up to date in gstate->zobrist by every card move in the engine, and
+// gamestate_key() only folds in the 13-byte scalar header. Without it the
+// hooks below are empty and gamestate_key() hashes the whole state.
+
+typedef enum
+{ ZOBRIST_DECK = 0,
+  ZOBRIST_HAND,
+  ZOBRIST_DISCARD,
+  ZOBRIST_COMBAT,
+  ZOBRIST_PILE_COUNT
+} ZobristPile;
+
+extern uint64_t zobrist_card_keys[2][ZOBRIST_PILE_COUNT][FULL_DECK_SIZE];
+
+// Fills the key tables (fixed seed, so keys are the same in every run).
+// Must run once at startup, like combo_bonus_init().
+void zobrist_init(void);
+
+// Full key, computed from scratch
+uint64_t zobrist_compute(const struct gamestate* gstate);
+
+// The two halves of the key: card locations, and the scalar header
+uint64_t zobrist_cards(const struct gamestate* gstate);
+uint64_t zobrist_scalars(const struct gamestate* gstate);
+
+#ifdef GAMESTATE_ZOBRIST
+
+static inline void zobrist_move_card(struct gamestate* gstate, PlayerID player,
+                                     ZobristPile from, ZobristPile to, uint8_t card)
+{ gstate->zobrist ^= zobrist_card_keys[player][from][card] ^ zobrist_card_keys[player][to][card];
+}
+
+// Recompute the card part after a bulk rewrite (new game, determinization)
+static inline void zobrist_refresh(struct gamestate* gstate)
+{ gstate->zobrist = zobrist_cards(gstate);
+}
+
+static inline uint64_t gamestate_key(const struct gamestate* gstate)
+{ return gstate->zobrist ^ zobrist_scalars(gstate);
+}
+
+#else
+
+static inline void zobrist_move_card(struct gamestate* gstate, PlayerID player,
+                                     ZobristPile from, ZobristPile to, uint8_t card)
+{ (void)gstate; (void)player; (void)from; (void)to; (void)card;
+}
+
+static inline void zobrist_refresh(struct gamestate* gstate)
+{ (void)gstate;
+}
+
+static inline uint64_t gamestate_key(const struct gamestate* gstate)
+{ return zobrist_compute(gstate);
+}
+
+#endif // GAMESTATE_ZOBRIST
+
+#endif // ZOBRIST_H
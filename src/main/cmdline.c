@@ -7,9 +7,12 @@
 #include <string.h>
 #include <getopt.h>
 #include <ctype.h>
+#include <errno.h>
 #include "main.h"
 #include "../util/prng_seed.h"
 #include "../ui/shared/player_config.h"
+#include "../rating/sprt.h"
+#include "../roles/stda/stda_replay.h"
 
 /* Parse language code from string */
 static ui_language_t parse_language(const char* lang_str)
@@ -46,6 +49,26 @@ static const char* get_language_name(ui_language_t lang)
   }
 }
 
+/* Parse "A[,B]" agent shorthands for players A and B (B defaults to random) */
+static bool parse_ai_players_arg(const char* arg, int ai_players[2])
+{ char buf[32];
+  snprintf(buf, sizeof(buf), "%s", arg);
+
+  char* comma = strchr(buf, ',');
+  if(comma) *comma = '\0';
+  const char* names[2] = { buf, comma ? comma + 1 : "rand" };
+
+  for(int p = 0; p < 2; p++)
+  { AIStrategyType type = parse_ai_strategy_shorthand(names[p]);
+    if(type == AI_STRATEGY_COUNT)
+    { fprintf(stderr, "Error: unknown AI agent '%s'\n\n", names[p]);
+      return false;
+    }
+    ai_players[p] = type;
+  }
+  return true;
+}
+
 /* Print usage information */
 void print_usage(const char* prog)
 { printf("Usage: %s [OPTIONS]\n\n", prog);
@@ -54,12 +77,57 @@ void print_usage(const char* prog)
   printf("  -v,  -vb, --verbose           Enable verbose output\n");
   printf("  -V,  -vr, --version           Show version information\n");
   printf("  -n,  -ns, --numsim=N          Set number of simulations to N\n");
+  printf("  -j,  -nt, --threads=N         Run stda.auto simulations on N threads\n");
+  printf("                                [default: 1]; results are reproducible\n");
+  printf("                                for a given seed and thread count\n");
   printf("  -i,  -in, --input=FILE        Use FILE as input configuration\n");
   printf("  -o,  -ou, --output=FILE       Output to FILE instead of stdout\n\n");
   printf("  -u,  -ul, --ui.lang=[LANG]    Set UI language (en/fr/es) [default: en]\n");
   printf("  -p,  -pr, --prng.seed=[SEED]  Set PRNG seed [default: random]\n");
   printf("                                If SEED omitted, uses %lu\n", M_TWISTER_SEED);
-  printf("                                If option omitted, uses random seed\n\n");
+  printf("                                If option omitted, uses random seed\n");
+  printf("  -r,  -ra, --prng.alg=ALG      PRNG backend: mt (MT19937, default,\n");
+  printf("                                reproduces historical seeds) or xoshiro\n");
+  printf("                                (xoshiro256**, small splittable state)\n");
+  printf("  -P,  -ap, --ai.players=A[,B]  stda.auto agents for players A and B\n");
+  printf("                                [default: rand,rand]; see -A for names\n");
+  printf("  -b,  -ab, --ai.budget=N       Playouts per AI decision [default: agent's]\n");
+  printf("  -m,  -at, --ai.time=MS        Time limit per AI decision, in ms\n");
+  printf("  -w,  -aw, --ai.workers=N      Search threads per AI decision [default: 1]\n");
+  printf("  -k,  -ak, --ai.parallel=MODE  Parallel search: root (independent trees,\n");
+  printf("                                default) or tree (shared tree, virtual loss)\n");
+  printf("  -R,  -to, --tournament=A,B,.. stda.auto round robin between the listed\n");
+  printf("                                agents: every pairing, both seats, N games\n");
+  printf("                                each (-n), rated by Bradley-Terry\n");
+  printf("  -D,  -pa, --paired            stda.auto common random numbers: -n deals,\n");
+  printf("                                each played twice with the seats swapped;\n");
+  printf("                                reports the paired score difference\n");
+  printf("  -E,  -sp, --sprt=E0,E1[,A,B]  stda.auto two-agent match that stops once a\n");
+  printf("                                sequential probability ratio test decides\n");
+  printf("                                H0: Elo E0 or H1: Elo E1 (errors A and B,\n");
+  printf("                                default 0.05); -n is then the game limit\n");
+  printf("  -M,  -ml, --matchlog=FILE     stda.auto: write every game (seed, agents,\n");
+  printf("                                result, final energy and cash, per-turn\n");
+  printf("                                summaries) to the binary match log FILE\n");
+  printf("  -Y,  -mr, --matchlog.read=FILE stda.auto: report on match log FILE\n");
+  printf("                                instead of playing\n");
+  printf("  -K,  -ma, --matchlog.actions  stda.auto: also log every game's actions\n");
+  printf("                                (needs -M and -X)\n");
+  printf("  -X,  -rp, --replayable        stda.auto: seed every game from the seed\n");
+  printf("                                and its index, so it can be replayed alone\n");
+  printf("  -Z,  -re, --replay=JOB:GAME   stda.auto: rebuild game GAME of job JOB\n");
+  printf("                                (0 for a -P match, the pairing with -R)\n");
+  printf("                                turn by turn, from the -Y log's actions if\n");
+  printf("                                it has them, else by rerunning the agents\n");
+  printf("  -F,  -pf, --profile           stda.auto: report ns per turn and a per-phase\n");
+  printf("                                breakdown after the results (needs a build\n");
+  printf("                                with make FEATURES=-DORACLE_PROFILE)\n");
+  printf("  -Q,  -ld, --lazydeck          Unordered decks: a reshuffle only gathers\n");
+  printf("                                the discard, a draw takes a uniformly random\n");
+  printf("                                card (same game distribution, less RNG work)\n");
+  printf("  -B,  -bt, --batch             stda.auto: random vs random games played 16 at\n");
+  printf("                                a time in the lockstep SIMD batch simulator\n");
+  printf("                                (same statistics, not the same games)\n\n");
   printf("Game Modes:\n");
   printf("  -a,  -sa, --stda.auto         Standalone automated mode\n");
   printf("  -s,  -ss, --stda.sim          Standalone simulation mode (ncurses)\n");
@@ -76,6 +144,15 @@ void print_usage(const char* prog)
   printf("                                --ai=<agent>), not space-separated\n\n");
   printf("Examples:\n");
   printf("  %s -a -p                      Automated AI vs AI, fixed default seed\n", prog);
+  printf("  %s -a -p -j8                   Same, spread over 8 threads\n", prog);
+  printf("  %s -a -p -n100 -P=simplemc,rand  Simple MC agent against random\n", prog);
+  printf("  %s -a -p -n20 -P=ismcts -w4 -k=tree  ISMCTS on a 4-thread shared tree\n", prog);
+  printf("  %s -a -p -n200 -j8 -R=rand,simplemc,ismcts -b=200  Rate three agents\n", prog);
+  printf("  %s -a -p -n500 -D -P=simplemc,rand  Paired deals, seats swapped\n", prog);
+  printf("  %s -a -p -n1000000 -j8 -M=games.oml  Log a million games\n", prog);
+  printf("  %s -a -Y=games.oml              Report on the logged games\n", prog);
+  printf("  %s -a -p -n100000 -X -K -M=games.oml  Log games with their actions\n", prog);
+  printf("  %s -a -Y=games.oml -Z=0:73411   Replay game 73411 of that log\n", prog);
   printf("  %s -l -u=fr                   Interactive CLI, French UI\n", prog);
   printf("  %s -t -u=fr                   Text UI (ncurses), French UI\n", prog);
 }
@@ -97,10 +174,28 @@ int parse_options(int argc, char** argv, config_t* cfg)
     {"v",          no_argument,       0, 'v'},
     {"V",          no_argument,       0, 'V'},
     {"n",          required_argument, 0, 'n'},
+    {"j",          required_argument, 0, 'j'},
     {"i",          required_argument, 0, 'i'},
     {"o",          required_argument, 0, 'o'},
     {"u",          optional_argument, 0, 'u'},
     {"p",          optional_argument, 0, 'p'},
+    {"r",          required_argument, 0, 'r'},
+    {"P",          required_argument, 0, 'P'},
+    {"b",          required_argument, 0, 'b'},
+    {"m",          required_argument, 0, 'm'},
+    {"w",          required_argument, 0, 'w'},
+    {"k",          required_argument, 0, 'k'},
+    {"R",          required_argument, 0, 'R'},
+    {"D",          no_argument,       0, 'D'},
+    {"E",          required_argument, 0, 'E'},
+    {"M",          required_argument, 0, 'M'},
+    {"Y",          required_argument, 0, 'Y'},
+    {"K",          no_argument,       0, 'K'},
+    {"X",          no_argument,       0, 'X'},
+    {"Z",          required_argument, 0, 'Z'},
+    {"F",          no_argument,       0, 'F'},
+    {"Q",          no_argument,       0, 'Q'},
+    {"B",          no_argument,       0, 'B'},
     {"a",          no_argument,       0, 'a'},
     {"s",          no_argument,       0, 's'},
     {"l",          no_argument,       0, 'l'},
@@ -117,10 +212,28 @@ int parse_options(int argc, char** argv, config_t* cfg)
     {"vb",         no_argument,       0, 'v'},
     {"vr",         no_argument,       0, 'V'},
     {"ns",         required_argument, 0, 'n'},
+    {"nt",         required_argument, 0, 'j'},
     {"in",         required_argument, 0, 'i'},
     {"ou",         required_argument, 0, 'o'},
     {"ul",         optional_argument, 0, 'u'},
     {"pr",         optional_argument, 0, 'p'},
+    {"ra",         required_argument, 0, 'r'},
+    {"ap",         required_argument, 0, 'P'},
+    {"ab",         required_argument, 0, 'b'},
+    {"at",         required_argument, 0, 'm'},
+    {"aw",         required_argument, 0, 'w'},
+    {"ak",         required_argument, 0, 'k'},
+    {"to",         required_argument, 0, 'R'},
+    {"pa",         no_argument,       0, 'D'},
+    {"sp",         required_argument, 0, 'E'},
+    {"ml",         required_argument, 0, 'M'},
+    {"mr",         required_argument, 0, 'Y'},
+    {"ma",         no_argument,       0, 'K'},
+    {"rp",         no_argument,       0, 'X'},
+    {"re",         required_argument, 0, 'Z'},
+    {"pf",         no_argument,       0, 'F'},
+    {"ld",         no_argument,       0, 'Q'},
+    {"bt",         no_argument,       0, 'B'},
     {"sa",         no_argument,       0, 'a'},
     {"ss",         no_argument,       0, 's'},
     {"sl",         no_argument,       0, 'l'},
@@ -137,10 +250,28 @@ int parse_options(int argc, char** argv, config_t* cfg)
     {"verbose",    no_argument,       0, 'v'},
     {"version",    no_argument,       0, 'V'},
     {"numsim",     required_argument, 0, 'n'},
+    {"threads",    required_argument, 0, 'j'},
     {"input",      required_argument, 0, 'i'},
     {"output",     required_argument, 0, 'o'},
     {"ui.lang",    optional_argument, 0, 'u'},
     {"prng.seed",  optional_argument, 0, 'p'},
+    {"prng.alg",   required_argument, 0, 'r'},
+    {"ai.players", required_argument, 0, 'P'},
+    {"ai.budget",  required_argument, 0, 'b'},
+    {"ai.time",    required_argument, 0, 'm'},
+    {"ai.workers", required_argument, 0, 'w'},
+    {"ai.parallel", required_argument, 0, 'k'},
+    {"tournament", required_argument, 0, 'R'},
+    {"paired",     no_argument,       0, 'D'},
+    {"sprt",       required_argument, 0, 'E'},
+    {"matchlog",   required_argument, 0, 'M'},
+    {"matchlog.read", required_argument, 0, 'Y'},
+    {"matchlog.actions", no_argument, 0, 'K'},
+    {"replayable", no_argument,       0, 'X'},
+    {"replay",     required_argument, 0, 'Z'},
+    {"profile",    no_argument,       0, 'F'},
+    {"lazydeck",   no_argument,       0, 'Q'},
+    {"batch",      no_argument,       0, 'B'},
     {"stda.auto",  no_argument,       0, 'a'},
     {"stda.sim",   no_argument,       0, 's'},
     {"stda.cli",   no_argument,       0, 'l'},
@@ -157,13 +288,17 @@ int parse_options(int argc, char** argv, config_t* cfg)
   /* Initialize config with defaults */
   memset(cfg, 0, sizeof(config_t));
   cfg->verbose = false;
-  cfg->numsim = 1000;
+  cfg->numsim = DEFAULT_NUMBER_OF_SIM;
+  cfg->num_threads = 1;
   cfg->language = LANG_EN;
   cfg->use_random_seed = true;
   cfg->prng_seed = 0;
+  cfg->prng_backend = RND_BACKEND_MT19937;
+  cfg->ai_threads = 1;
+  cfg->ai_parallel = AI_PARALLEL_ROOT;
 
   while((opt = getopt_long_only(argc, argv,
-                                "hvVn:i:o:u::p::asltgSCLTGA::",
+                                "hvVn:j:i:o:u::p::r:P:b:m:w:k:R:DE:M:Y:KXZ:FQBasltgSCLTGA::",
                                 long_options, &option_index)) != -1)
   { switch(opt)
     { case 'h':
@@ -176,12 +311,32 @@ int parse_options(int argc, char** argv, config_t* cfg)
         print_version();
         return -1;
       case 'n':
-        cfg->numsim = atoi(optarg);
-        if(cfg->numsim <= 0)
+      { char* endptr;
+        errno = 0;
+        cfg->numsim = strtoull(optarg, &endptr, 10);
+        if(errno != 0 || *endptr != '\0' || *optarg == '-' || cfg->numsim == 0)
         { fprintf(stderr, "Error: numsim must be positive\n");
           return 1;
         }
         break;
+      }
+      case 'j':
+      case 'w':
+      { char* endptr;
+        long max = opt == 'j' ? MAX_SIM_THREADS : MAX_AI_SEARCH_THREADS;
+        errno = 0;
+        long value = strtol(optarg, &endptr, 10);
+        if(errno != 0 || endptr == optarg || *endptr != '\0' || value < 1 || value > max)
+        { fprintf(stderr, "Error: %s must be between 1 and %ld\n",
+                  opt == 'j' ? "threads" : "ai.workers", max);
+          return 1;
+        }
+        if(opt == 'j')
+          cfg->num_threads = (int)value;
+        else
+          cfg->ai_threads = (int)value;
+        break;
+      }
       case 'i':
         cfg->input_file = strdup(optarg);
         break;
@@ -200,6 +355,113 @@ int parse_options(int argc, char** argv, config_t* cfg)
         else
           cfg->prng_seed = M_TWISTER_SEED;
         break;
+      case 'r':
+        if(!parse_prng_backend_arg(optarg, &cfg->prng_backend))
+        { fprintf(stderr, "Error: unknown PRNG backend '%s' (use mt or xoshiro)\n",
+                  optarg);
+          return 1;
+        }
+        break;
+      case 'P':
+        if(!parse_ai_players_arg(optarg, cfg->ai_players))
+        { print_ai_agent_shorthand_list(cfg);
+          return 1;
+        }
+        break;
+      case 'b':
+      case 'm':
+      { char* endptr;
+        errno = 0;
+        unsigned long value = strtoul(optarg, &endptr, 10);
+        if(errno != 0 || *endptr != '\0' || *optarg == '-' || value == 0 ||
+           value > UINT32_MAX)
+        { fprintf(stderr, "Error: %s must be a positive integer\n",
+                  opt == 'b' ? "ai.budget" : "ai.time");
+          return 1;
+        }
+        if(opt == 'b')
+          cfg->ai_budget = (uint32_t)value;
+        else
+          cfg->ai_time_ms = (uint32_t)value;
+        break;
+      }
+      case 'k':
+        if(strcmp(optarg, "root") == 0)
+          cfg->ai_parallel = AI_PARALLEL_ROOT;
+        else if(strcmp(optarg, "tree") == 0)
+          cfg->ai_parallel = AI_PARALLEL_TREE;
+        else
+        { fprintf(stderr, "Error: unknown ai.parallel mode '%s' (use root or tree)\n",
+                  optarg);
+          return 1;
+        }
+        break;
+      case 'R':
+      { char buf[256];
+        snprintf(buf, sizeof(buf), "%s", optarg);
+        bool known = strlen(optarg) < sizeof(buf);
+        for(char* name = strtok(buf, ","); known && name; name = strtok(NULL, ","))
+        { if(parse_ai_strategy_shorthand(name) == AI_STRATEGY_COUNT)
+          { fprintf(stderr, "Error: unknown AI agent '%s'\n\n", name);
+            known = false;
+          }
+        }
+        if(!known)
+        { print_ai_agent_shorthand_list(cfg);
+          return 1;
+        }
+        free(cfg->tournament);
+        cfg->tournament = strdup(optarg);
+        break;
+      }
+      case 'D':
+        cfg->paired = true;
+        break;
+      case 'E':
+      { SPRTSpec sprt;
+        if(!parse_sprt_arg(optarg, &sprt))
+        { fprintf(stderr, "Error: invalid --sprt '%s': expected ELO0,ELO1[,ALPHA[,BETA]] "
+                  "with ELO0 < ELO1 and ALPHA + BETA < 1\n", optarg);
+          return 1;
+        }
+        free(cfg->sprt);
+        cfg->sprt = strdup(optarg);
+        break;
+      }
+      case 'M':
+        free(cfg->match_log);
+        cfg->match_log = strdup(optarg);
+        break;
+      case 'Y':
+        free(cfg->match_log_read);
+        cfg->match_log_read = strdup(optarg);
+        break;
+      case 'K':
+        cfg->match_log_actions = true;
+        break;
+      case 'X':
+        cfg->replayable = true;
+        break;
+      case 'Z':
+      { uint32_t job;
+        uint64_t game;
+        if(!parse_replay_arg(optarg, &job, &game))
+        { fprintf(stderr, "Error: invalid --replay '%s': expected JOB:GAME\n", optarg);
+          return 1;
+        }
+        free(cfg->replay);
+        cfg->replay = strdup(optarg);
+        break;
+      }
+      case 'F':
+        cfg->profile = true;
+        break;
+      case 'Q':
+        cfg->lazy_deck = true;
+        break;
+      case 'B':
+        cfg->batch = true;
+        break;
       case 'a':
         cfg->mode = MODE_STDA_AUTO;
         break;
@@ -266,6 +528,8 @@ int parse_options(int argc, char** argv, config_t* cfg)
              cfg->prng_seed, cfg->prng_seed);
     }
   }
+  if(cfg->verbose)
+    printf("Using PRNG backend: %s\n", RND_backend_name(cfg->prng_backend));
 
   return EXIT_SUCCESS;
 } // parse_options
@@ -8,6 +8,10 @@
 #include "cmdline.h"
 #include "../core/game_constants.h"
 #include "../core/game_state.h"
+#include "../core/combo_bonus.h"
+#include "../core/combat_analysis.h"
+#include "../core/zobrist.h"
+#include "../actions/action.h"
 #include "../ai_strat/ai_strategy.h"
 #include "../ai_strat/ai_strat_random.h"
 #include "../util/mtwister.h"
@@ -31,6 +35,18 @@ int main(int argc, char** argv)
   /* Initialize PRNG with the configured seed */
   seedRand(validate_seed(cfg.prng_seed));
 
+  /* Build engine lookup tables (before any worker thread starts) */
+  if(!combo_bonus_init())
+  { cleanup_config(&cfg);
+    return EXIT_FAILURE;
+  }
+  actions_init();
+  zobrist_init();
+  if(!combat_analysis_init())
+  { cleanup_config(&cfg);
+    return EXIT_FAILURE;
+  }
+
   /* Redirect output if requested */
   if(cfg.output_file)
   { if(!freopen(cfg.output_file, "w", stdout))
@@ -86,6 +102,7 @@ int main(int argc, char** argv)
       ret = EXIT_FAILURE;
   }
 
+  combat_analysis_free();
   cleanup_config(&cfg);
   return ret;
 
@@ -130,4 +147,9 @@ void cleanup_config(config_t* cfg)
 { if(cfg->input_file) free(cfg->input_file);
   if(cfg->output_file) free(cfg->output_file);
   if(cfg->ai_agent) free(cfg->ai_agent);
+  if(cfg->tournament) free(cfg->tournament);
+  if(cfg->sprt) free(cfg->sprt);
+  if(cfg->match_log) free(cfg->match_log);
+  if(cfg->match_log_read) free(cfg->match_log_read);
+  if(cfg->replay) free(cfg->replay);
 }
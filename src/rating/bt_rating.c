@@ -0,0 +1,518 @@
+// bt_rating.c
+// Bradley-Terry fitting and bootstrap (see bt_rating.h)
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bt_rating.h"
+#include "../util/xoshiro.h"
+
+#define MIN_LOG_STRENGTH -50.0
+#define MAX_NEWTON_STEP 2.0
+#define ELO_PER_NAT 173.71779276130073   // 400 / ln(10)
+#define TWO_PI 6.283185307179586
+
+// ============================================================================
+// Model and sparse pair counts
+// ============================================================================
+
+BTModel* bt_create(void)
+{ BTModel* model = calloc(1, sizeof(BTModel));
+  if(!model) return NULL;
+  model->prior = BT_DEFAULT_PRIOR;
+  return model;
+}
+
+void bt_destroy(BTModel* model)
+{ if(!model) return;
+  free(model->names);
+  free(model->strength);
+  free(model->half_wins);
+  free(model->games);
+  free(model->pairs);
+  free(model->pair_slots);
+  free(model);
+}
+
+static bool grow(void** array, uint32_t count, size_t elem_size)
+{ void* p = realloc(*array, count * elem_size);
+  if(!p) return false;
+  *array = p;
+  return true;
+}
+
+int bt_add_player(BTModel* model, const char* name)
+{ if(model->num_players == model->cap_players)
+  { uint32_t cap = model->cap_players ? 2 * model->cap_players : 16;
+    if(!grow((void**)&model->names, cap, BT_NAME_LEN) ||
+       !grow((void**)&model->strength, cap, sizeof(double)) ||
+       !grow((void**)&model->half_wins, cap, sizeof(uint64_t)) ||
+       !grow((void**)&model->games, cap, sizeof(uint64_t)))
+      return -1;
+    model->cap_players = cap;
+  }
+
+  uint32_t id = model->num_players++;
+  snprintf(model->names[id], BT_NAME_LEN, "%s", name ? name : "");
+  model->strength[id] = 1.0;
+  model->half_wins[id] = 0;
+  model->games[id] = 0;
+  return (int)id;
+}
+
+int bt_find_player(const BTModel* model, const char* name)
+{ for(uint32_t i = 0; i < model->num_players; i++)
+    if(strcmp(model->names[i], name) == 0) return (int)i;
+  return -1;
+}
+
+static inline uint32_t pair_hash(uint32_t i, uint32_t j)
+{ uint64_t z = ((uint64_t)i << 32 | j) * 0x9E3779B97F4A7C15ULL;
+  return (uint32_t)(z >> 32);
+}
+
+static bool rehash_pairs(BTModel* model, uint32_t num_slots)
+{ uint32_t* slots = calloc(num_slots, sizeof(uint32_t));
+  if(!slots) return false;
+  for(uint32_t k = 0; k < model->num_pairs; k++)
+  { uint32_t s = pair_hash(model->pairs[k].i, model->pairs[k].j) & (num_slots - 1);
+    while(slots[s]) s = (s + 1) & (num_slots - 1);
+    slots[s] = k + 1;
+  }
+  free(model->pair_slots);
+  model->pair_slots = slots;
+  model->slot_mask = num_slots - 1;
+  return true;
+}
+
+static BTPair* find_or_add_pair(BTModel* model, uint32_t i, uint32_t j)
+{ if(2 * (model->num_pairs + 1) > model->slot_mask + 1 || !model->pair_slots)
+  { if(!rehash_pairs(model, model->pair_slots ? 2 * (model->slot_mask + 1) : 64))
+      return NULL;
+  }
+
+  uint32_t s = pair_hash(i, j) & model->slot_mask;
+  while(model->pair_slots[s])
+  { BTPair* pair = &model->pairs[model->pair_slots[s] - 1];
+    if(pair->i == i && pair->j == j) return pair;
+    s = (s + 1) & model->slot_mask;
+  }
+
+  if(model->num_pairs == model->cap_pairs)
+  { uint32_t cap = model->cap_pairs ? 2 * model->cap_pairs : 64;
+    if(!grow((void**)&model->pairs, cap, sizeof(BTPair))) return NULL;
+    model->cap_pairs = cap;
+  }
+  BTPair* pair = &model->pairs[model->num_pairs++];
+  *pair = (BTPair){i, j, 0, 0, 0};
+  model->pair_slots[s] = model->num_pairs;
+  return pair;
+}
+
+bool bt_add_games(BTModel* model, uint32_t a, uint32_t b,
+                  uint64_t a_wins, uint64_t b_wins, uint64_t draws)
+{ if(a == b || a >= model->num_players || b >= model->num_players) return false;
+
+  uint64_t n = a_wins + b_wins + draws;
+  if(n == 0) return true;
+  if(a > b)
+  { uint32_t t = a; a = b; b = t;
+    uint64_t w = a_wins; a_wins = b_wins; b_wins = w;
+  }
+
+  BTPair* pair = find_or_add_pair(model, a, b);
+  if(!pair) return false;
+  pair->games += n;
+  pair->half_wins_i += 2 * a_wins + draws;
+  pair->draws += draws;
+  model->games[a] += n;
+  model->games[b] += n;
+  model->half_wins[a] += 2 * a_wins + draws;
+  model->half_wins[b] += 2 * b_wins + draws;
+  return true;
+}
+
+// ============================================================================
+// Fitting
+// ============================================================================
+
+// What a fit needs: the model's counts, or a bootstrap replicate's
+typedef struct
+{ uint32_t n;
+  const BTPair* pairs;
+  uint32_t num_pairs;
+  const uint64_t* half_wins;
+  double prior;
+  uint32_t anchor;
+} FitData;
+
+typedef struct
+{ double* theta;     // log-strengths
+  double* grad;
+  double* denom;     // MM denominators
+  double* hess;      // n x n negated Hessian, Cholesky factor in place
+} FitWork;
+
+static bool work_alloc(FitWork* w, uint32_t n)
+{ w->theta = malloc(n * sizeof(double));
+  w->grad = malloc(n * sizeof(double));
+  w->denom = malloc(n * sizeof(double));
+  w->hess = malloc((size_t)n * n * sizeof(double));
+  return w->theta && w->grad && w->denom && w->hess;
+}
+
+static void work_free(FitWork* w)
+{ free(w->theta);
+  free(w->grad);
+  free(w->denom);
+  free(w->hess);
+}
+
+static inline double sigmoid(double x)
+{ return 1.0 / (1.0 + exp(-x));
+}
+
+// Without a prior only differences are identified: pin the anchor at 0
+static void normalize(const FitData* d, double* theta)
+{ if(d->prior > 0) return;
+  double shift = theta[d->anchor];
+  for(uint32_t i = 0; i < d->n; i++)
+    theta[i] -= shift;
+}
+
+static int fit_mm(const FitData* d, FitWork* w, double tolerance, int max_iterations)
+{ for(int it = 1; it <= max_iterations; it++)
+  { for(uint32_t i = 0; i < d->n; i++)
+      w->denom[i] = d->prior / (exp(w->theta[i]) + 1.0);
+    for(uint32_t k = 0; k < d->num_pairs; k++)
+    { const BTPair* p = &d->pairs[k];
+      double share = (double)p->games / (exp(w->theta[p->i]) + exp(w->theta[p->j]));
+      w->denom[p->i] += share;
+      w->denom[p->j] += share;
+    }
+
+    double max_change = 0.0;
+    for(uint32_t i = 0; i < d->n; i++)
+    { if(w->denom[i] <= 0.0) continue;   // no games and no prior
+      double wins = 0.5 * (double)d->half_wins[i] + 0.5 * d->prior;
+      double theta = wins > 0.0 ? log(wins / w->denom[i]) : MIN_LOG_STRENGTH;
+      if(theta < MIN_LOG_STRENGTH) theta = MIN_LOG_STRENGTH;
+      max_change = fmax(max_change, fabs(theta - w->theta[i]));
+      w->theta[i] = theta;
+    }
+    normalize(d, w->theta);
+    if(max_change < tolerance) return it;
+  }
+  return -1;
+}
+
+// Solves A x = b for a symmetric positive definite A (n x n, row-major);
+// A is overwritten by its Cholesky factor, b by x. Pivots below `ridge` are
+// raised to it, so players without games simply do not move.
+static void cholesky_solve(double* a, double* b, uint32_t n, double ridge)
+{ for(uint32_t j = 0; j < n; j++)
+  { double diag = a[j * n + j];
+    for(uint32_t k = 0; k < j; k++)
+      diag -= a[j * n + k] * a[j * n + k];
+    diag = sqrt(fmax(diag, ridge));
+    a[j * n + j] = diag;
+    for(uint32_t i = j + 1; i < n; i++)
+    { double v = a[i * n + j];
+      for(uint32_t k = 0; k < j; k++)
+        v -= a[i * n + k] * a[j * n + k];
+      a[i * n + j] = v / diag;
+    }
+  }
+  for(uint32_t i = 0; i < n; i++)          // L y = b
+  { for(uint32_t k = 0; k < i; k++)
+      b[i] -= a[i * n + k] * b[k];
+    b[i] /= a[i * n + i];
+  }
+  for(uint32_t i = n; i-- > 0;)            // L^T x = y
+  { for(uint32_t k = i + 1; k < n; k++)
+      b[i] -= a[k * n + i] * b[k];
+    b[i] /= a[i * n + i];
+  }
+}
+
+static int fit_newton(const FitData* d, FitWork* w, double tolerance, int max_iterations)
+{ uint32_t n = d->n;
+
+  for(int it = 1; it <= max_iterations; it++)
+  { memset(w->hess, 0, (size_t)n * n * sizeof(double));
+    for(uint32_t i = 0; i < n; i++)
+    { double s = sigmoid(w->theta[i]);
+      w->grad[i] = 0.5 * (double)d->half_wins[i] + d->prior * (0.5 - s);
+      w->hess[i * n + i] = d->prior * s * (1.0 - s);
+    }
+    for(uint32_t k = 0; k < d->num_pairs; k++)
+    { const BTPair* p = &d->pairs[k];
+      double pij = sigmoid(w->theta[p->i] - w->theta[p->j]);
+      double n_ij = (double)p->games;
+      double h = n_ij * pij * (1.0 - pij);
+      w->grad[p->i] -= n_ij * pij;
+      w->grad[p->j] -= n_ij * (1.0 - pij);
+      w->hess[p->i * n + p->i] += h;
+      w->hess[p->j * n + p->j] += h;
+      w->hess[p->i * n + p->j] -= h;
+      w->hess[p->j * n + p->i] -= h;
+    }
+
+    if(d->prior <= 0.0)
+    { // Fix the anchor: its row and column become the identity
+      for(uint32_t i = 0; i < n; i++)
+        w->hess[d->anchor * n + i] = w->hess[i * n + d->anchor] = 0.0;
+      w->hess[d->anchor * n + d->anchor] = 1.0;
+      w->grad[d->anchor] = 0.0;
+    }
+
+    cholesky_solve(w->hess, w->grad, n, 1e-12);
+
+    double max_change = 0.0;
+    for(uint32_t i = 0; i < n; i++)
+    { double step = fmax(-MAX_NEWTON_STEP, fmin(MAX_NEWTON_STEP, w->grad[i]));
+      w->theta[i] = fmax(MIN_LOG_STRENGTH, w->theta[i] + step);
+      max_change = fmax(max_change, fabs(step));
+    }
+    normalize(d, w->theta);
+    if(max_change < tolerance) return it;
+  }
+  return -1;
+}
+
+static FitData model_data(const BTModel* model)
+{ return (FitData){model->num_players, model->pairs, model->num_pairs, model->half_wins,
+                   model->prior, model->anchor};
+}
+
+int bt_fit(BTModel* model, BTFitMethod method, double tolerance, int max_iterations)
+{ uint32_t n = model->num_players;
+  if(n == 0) return 0;
+
+  FitWork w;
+  if(!work_alloc(&w, n))
+  { work_free(&w);
+    return -1;
+  }
+  FitData d = model_data(model);
+  for(uint32_t i = 0; i < n; i++)
+    w.theta[i] = log(model->strength[i]);
+
+  int iterations = (method == BT_FIT_NEWTON) ? fit_newton(&d, &w, tolerance, max_iterations)
+                                             : fit_mm(&d, &w, tolerance, max_iterations);
+  for(uint32_t i = 0; i < n; i++)
+    model->strength[i] = exp(w.theta[i]);
+  work_free(&w);
+  return iterations;
+}
+
+double bt_log_likelihood(const BTModel* model)
+{ double ll = 0.0;
+  for(uint32_t k = 0; k < model->num_pairs; k++)
+  { const BTPair* p = &model->pairs[k];
+    double gi = model->strength[p->i], gj = model->strength[p->j];
+    double wi = 0.5 * (double)p->half_wins_i;
+    ll += wi * log(gi) + ((double)p->games - wi) * log(gj) - (double)p->games * log(gi + gj);
+  }
+  for(uint32_t i = 0; i < model->num_players; i++)
+    ll += model->prior * (0.5 * log(model->strength[i]) - log(model->strength[i] + 1.0));
+  return ll;
+}
+
+double bt_elo(const BTModel* model, uint32_t player)
+{ return ELO_PER_NAT * log(model->strength[player] / model->strength[model->anchor]);
+}
+
+double bt_win_probability(const BTModel* model, uint32_t a, uint32_t b)
+{ return model->strength[a] / (model->strength[a] + model->strength[b]);
+}
+
+// ============================================================================
+// Bootstrap
+// ============================================================================
+
+static inline double uniform01(Xoshiro256* rng)
+{ return (double)(nextXoshiro(rng) >> 11) * 0x1.0p-53;
+}
+
+static uint64_t poisson(Xoshiro256* rng, double mean)
+{ double limit = exp(-mean), prod = uniform01(rng);
+  uint64_t k = 0;
+  while(prod > limit)
+  { prod *= uniform01(rng);
+    k++;
+  }
+  return k;
+}
+
+// Binomial(n, p): exact for small n, Poisson or normal approximation beyond
+static uint64_t binomial(Xoshiro256* rng, uint64_t n, double p)
+{ if(n == 0 || p <= 0.0) return 0;
+  if(p >= 1.0) return n;
+  if(n <= 256)
+  { uint64_t k = 0;
+    for(uint64_t t = 0; t < n; t++)
+      k += uniform01(rng) < p;
+    return k;
+  }
+  double mean = (double)n * p;
+  if(mean < 10.0) return poisson(rng, mean);
+  if((double)n - mean < 10.0) return n - poisson(rng, (double)n - mean);
+
+  double u1 = uniform01(rng), u2 = uniform01(rng);
+  double z = sqrt(-2.0 * log(u1 > 0.0 ? u1 : 0x1.0p-53)) * cos(TWO_PI * u2);
+  double k = round(mean + z * sqrt(mean * (1.0 - p)));
+  return k < 0.0 ? 0 : (k > (double)n ? n : (uint64_t)k);
+}
+
+typedef struct
+{ const BTModel* model;
+  int first, step, replicates;
+  uint64_t seed;
+  double* elo;            // replicates x players, shared; each thread writes its rows
+  bool ok;
+} BootstrapWorker;
+
+static void* bootstrap_worker_main(void* arg)
+{ BootstrapWorker* bw = arg;
+  const BTModel* model = bw->model;
+  uint32_t n = model->num_players;
+
+  BTPair* pairs = malloc((model->num_pairs ? model->num_pairs : 1) * sizeof(BTPair));
+  uint64_t* half_wins = malloc(n * sizeof(uint64_t));
+  FitWork w;
+  bw->ok = work_alloc(&w, n) && pairs && half_wins;
+
+  for(int r = bw->first; bw->ok && r < bw->replicates; r += bw->step)
+  { // One stream per replicate: results do not depend on the thread count
+    Xoshiro256 rng = seedXoshiro(bw->seed + (uint64_t)(r + 1) * 0x9E3779B97F4A7C15ULL);
+
+    memset(half_wins, 0, n * sizeof(uint64_t));
+    for(uint32_t k = 0; k < model->num_pairs; k++)
+    { const BTPair* src = &model->pairs[k];
+      uint64_t wins_i = (src->half_wins_i - src->draws) / 2;
+      uint64_t losses_i = src->games - src->draws - wins_i;
+      double n_games = (double)src->games;
+
+      uint64_t wi = binomial(&rng, src->games, (double)wins_i / n_games);
+      uint64_t rest = src->games - wi;
+      double rest_share = (double)(src->draws + losses_i);
+      uint64_t dr = rest_share > 0.0 ? binomial(&rng, rest, (double)src->draws / rest_share) : 0;
+
+      pairs[k] = *src;
+      pairs[k].half_wins_i = 2 * wi + dr;
+      pairs[k].draws = dr;
+      half_wins[src->i] += 2 * wi + dr;
+      half_wins[src->j] += 2 * (rest - dr) + dr;
+    }
+
+    FitData d = {n, pairs, model->num_pairs, half_wins, model->prior, model->anchor};
+    for(uint32_t i = 0; i < n; i++)
+      w.theta[i] = log(model->strength[i]);
+    fit_newton(&d, &w, 1e-7, 100);
+
+    for(uint32_t i = 0; i < n; i++)
+      bw->elo[(size_t)r * n + i] = ELO_PER_NAT * (w.theta[i] - w.theta[model->anchor]);
+  }
+
+  work_free(&w);
+  free(pairs);
+  free(half_wins);
+  return NULL;
+} // bootstrap_worker_main
+
+static int compare_double(const void* a, const void* b)
+{ double x = *(const double*)a, y = *(const double*)b;
+  return (x > y) - (x < y);
+}
+
+static double quantile(const double* sorted, int count, double q)
+{ double pos = q * (count - 1);
+  int lo = (int)floor(pos);
+  int hi = lo + 1 < count ? lo + 1 : lo;
+  return sorted[lo] + (pos - lo) * (sorted[hi] - sorted[lo]);
+}
+
+bool bt_bootstrap(const BTModel* model, int replicates, int threads, uint64_t seed,
+                  double confidence, BTInterval* out)
+{ uint32_t n = model->num_players;
+  if(n == 0 || replicates < 2 || confidence <= 0.0 || confidence >= 1.0) return false;
+  if(threads < 1) threads = 1;
+  if(threads > replicates) threads = replicates;
+
+  double* elo = malloc((size_t)replicates * n * sizeof(double));
+  double* column = malloc(replicates * sizeof(double));
+  BootstrapWorker* workers = calloc(threads, sizeof(BootstrapWorker));
+  pthread_t* tids = calloc(threads, sizeof(pthread_t));
+  bool* started = calloc(threads, sizeof(bool));
+  bool ok = elo && column && workers && tids && started;
+
+  // The calling thread runs worker 0, and any worker whose thread fails to start
+  for(int t = 0; ok && t < threads; t++)
+  { workers[t] = (BootstrapWorker){model, t, threads, replicates, seed, elo, false};
+    if(t > 0)
+      started[t] = pthread_create(&tids[t], NULL, bootstrap_worker_main, &workers[t]) == 0;
+  }
+  for(int t = 0; ok && t < threads; t++)
+  { if(!started[t]) bootstrap_worker_main(&workers[t]);
+  }
+  for(int t = 0; ok && t < threads; t++)
+  { if(started[t]) pthread_join(tids[t], NULL);
+    ok &= workers[t].ok;
+  }
+
+  for(uint32_t i = 0; ok && i < n; i++)
+  { double sum = 0.0, sum2 = 0.0;
+    for(int r = 0; r < replicates; r++)
+    { column[r] = elo[(size_t)r * n + i];
+      sum += column[r];
+      sum2 += column[r] * column[r];
+    }
+    qsort(column, replicates, sizeof(double), compare_double);
+    double mean = sum / replicates;
+    out[i].elo = bt_elo(model, i);
+    out[i].low = quantile(column, replicates, 0.5 * (1.0 - confidence));
+    out[i].high = quantile(column, replicates, 0.5 * (1.0 + confidence));
+    out[i].stderr_elo = sqrt(fmax(0.0, sum2 / replicates - mean * mean) * replicates / (replicates - 1));
+  }
+
+  free(elo);
+  free(column);
+  free(workers);
+  free(tids);
+  free(started);
+  return ok;
+} // bt_bootstrap
+
+// ============================================================================
+// Report
+// ============================================================================
+
+void bt_print(const BTModel* model, const BTInterval* intervals, FILE* out)
+{ uint32_t n = model->num_players;
+  uint32_t* order = malloc(n * sizeof(uint32_t));
+  if(!order) return;
+  for(uint32_t i = 0; i < n; i++)
+    order[i] = i;
+  for(uint32_t i = 1; i < n; i++)        // insertion sort by decreasing strength
+  { uint32_t p = order[i];
+    uint32_t j = i;
+    for(; j > 0 && model->strength[order[j - 1]] < model->strength[p]; j--)
+      order[j] = order[j - 1];
+    order[j] = p;
+  }
+
+  fprintf(out, "%-4s %-*s %10s %7s %8s", "rank", BT_NAME_LEN - 1, "player", "games", "score", "elo");
+  if(intervals) fprintf(out, "  %19s", "interval");
+  fprintf(out, "\n");
+  for(uint32_t r = 0; r < n; r++)
+  { uint32_t i = order[r];
+    double score = model->games[i] ? 50.0 * (double)model->half_wins[i] / (double)model->games[i] : 0.0;
+    fprintf(out, "%-4u %-*s %10llu %6.1f%% %8.1f", r + 1, BT_NAME_LEN - 1, model->names[i],
+            (unsigned long long)model->games[i], score, bt_elo(model, i));
+    if(intervals) fprintf(out, "  [%8.1f, %8.1f]", intervals[i].low, intervals[i].high);
+    fprintf(out, "\n");
+  }
+  free(order);
+} // bt_print
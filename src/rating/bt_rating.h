@@ -0,0 +1,96 @@
+// bt_rating.h
+// Bradley-Terry rating of agents (or players) from aggregated match results:
+// sparse pairwise counts, MM and Newton fitting with warm starts, and
+// bootstrap confidence intervals computed on worker threads
+
+#ifndef BT_RATING_H
+#define BT_RATING_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define BT_NAME_LEN 32
+#define BT_DEFAULT_PRIOR 1.0
+#define BT_DEFAULT_TOLERANCE 1e-9
+#define BT_DEFAULT_MAX_ITERATIONS 10000
+
+// Results between two players, i < j. Draws count half a win for each side,
+// so wins are kept in half-points.
+typedef struct
+{ uint32_t i, j;
+  uint64_t games;
+  uint64_t half_wins_i;   // 2 per win of i, 1 per draw
+  uint64_t draws;
+} BTPair;
+
+// Strength gamma_i: P(i beats j) = gamma_i / (gamma_i + gamma_j). Each
+// player also plays `prior` virtual drawn games against a strength-1 player,
+// which keeps unbeaten and winless players finite and fixes the scale; with
+// prior = 0 the scale is fixed by the anchor instead.
+typedef struct
+{ uint32_t num_players;
+  uint32_t cap_players;
+  char (*names)[BT_NAME_LEN];
+  double* strength;          // gamma, kept between fits (warm start)
+  uint64_t* half_wins;       // per player, over all pairs
+  uint64_t* games;
+
+  BTPair* pairs;             // one per pair that has met
+  uint32_t num_pairs;
+  uint32_t cap_pairs;
+  uint32_t* pair_slots;      // open addressing: pair index + 1, 0 = empty
+  uint32_t slot_mask;
+
+  uint32_t anchor;           // player whose Elo is 0 (default: the first)
+  double prior;
+} BTModel;
+
+typedef enum
+{ BT_FIT_MM = 0,     // Hunter's minorization-maximization: cheap steps, linear convergence
+  BT_FIT_NEWTON      // Newton on log-strengths: dense n x n solve, converges in a few steps
+} BTFitMethod;
+
+typedef struct
+{ double elo;
+  double low;         // percentile interval over the bootstrap replicates
+  double high;
+  double stderr_elo;  // standard deviation over the replicates
+} BTInterval;
+
+BTModel* bt_create(void);
+void bt_destroy(BTModel* model);
+
+// Returns the new player's index, or -1 if out of memory
+int bt_add_player(BTModel* model, const char* name);
+int bt_find_player(const BTModel* model, const char* name);
+
+// Add games between a and b (either order; a != b). New games keep the
+// current strengths, so the next fit starts from them.
+bool bt_add_games(BTModel* model, uint32_t a, uint32_t b,
+                  uint64_t a_wins, uint64_t b_wins, uint64_t draws);
+
+// Maximum-likelihood strengths, starting from the current ones. Stops when no
+// log-strength moves by more than tolerance. Returns the iterations used, or
+// -1 if max_iterations was reached first.
+int bt_fit(BTModel* model, BTFitMethod method, double tolerance, int max_iterations);
+
+// Log-likelihood of the results (including the prior) at the current strengths
+double bt_log_likelihood(const BTModel* model);
+
+double bt_elo(const BTModel* model, uint32_t player);        // 400 log10(gamma / gamma_anchor)
+double bt_win_probability(const BTModel* model, uint32_t a, uint32_t b);
+
+// Bootstrap: each replicate resamples the games of every pair (win/draw/loss
+// counts redrawn from the pair's observed frequencies) and refits by Newton
+// from the point estimate. Each replicate has its own xoshiro stream derived
+// from the seed, so results do not depend on `threads` or on timing.
+// out[] gets one interval per player at the given confidence (e.g. 0.95).
+// The model must have been fitted. Returns false on bad arguments or no memory.
+bool bt_bootstrap(const BTModel* model, int replicates, int threads, uint64_t seed,
+                  double confidence, BTInterval* out);
+
+// Table of players by decreasing Elo: games, score, Elo and the interval if given
+void bt_print(const BTModel* model, const BTInterval* intervals, FILE* out);
+
+#endif // BT_RATING_H
@@ -0,0 +1,321 @@
+// match_log.c
+// Binary per-game match log writer and memory-mapped reader (see match_log.h)
+
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "match_log.h"
+#include "../core/game_constants.h"
+#include "../util/prng_seed.h"
+
+#define MATCH_LOG_STDIO_BUFFER (1u << 20)
+
+MatchLog* match_log_create(const char* path, uint32_t master_seed, RndBackend rng_backend,
+                           uint32_t flags, uint32_t num_agents,
+                           const char (*agent_names)[BT_NAME_LEN])
+{ if(num_agents > MATCH_LOG_MAX_AGENTS) return NULL;
+
+  MatchLog* log = (MatchLog*)calloc(1, sizeof(MatchLog));
+  if(log == NULL) return NULL;
+  log->file = fopen(path, "wb");
+  if(log->file == NULL)
+  { perror("Failed to create match log");
+    free(log);
+    return NULL;
+  }
+  setvbuf(log->file, NULL, _IOFBF, MATCH_LOG_STDIO_BUFFER);
+  pthread_mutex_init(&log->lock, NULL);
+  log->master_seed = master_seed;
+  log->flags = flags;
+
+  MatchLogHeader header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, MATCH_LOG_MAGIC, sizeof(header.magic));
+  header.version = MATCH_LOG_VERSION;
+  header.header_size = sizeof(MatchLogHeader);
+  header.game_size = sizeof(MatchLogGame);
+  header.turn_size = sizeof(MatchLogTurn);
+  header.master_seed = master_seed;
+  header.num_agents = num_agents;
+  header.flags = flags;
+  header.rng_backend = rng_backend;
+  for(uint32_t i = 0; i < num_agents; i++)
+    snprintf(header.agents[i], BT_NAME_LEN, "%s", agent_names[i]);
+  log->failed = fwrite(&header, sizeof(header), 1, log->file) != 1;
+
+  return log;
+} // match_log_create
+
+bool match_log_close(MatchLog* log)
+{ if(log == NULL) return false;
+  bool ok = !log->failed;
+  ok &= fclose(log->file) == 0;
+  pthread_mutex_destroy(&log->lock);
+  free(log);
+  return ok;
+} // match_log_close
+
+MatchLogBuffer* match_log_buffer_create(MatchLog* log, uint64_t first_game, uint32_t seed,
+                                        uint16_t stream, uint8_t agent_a, uint8_t agent_b)
+{ MatchLogBuffer* buffer = (MatchLogBuffer*)malloc(sizeof(MatchLogBuffer));
+  if(buffer == NULL) return NULL;
+
+  buffer->log = log;
+  buffer->next_game = first_game;
+  buffer->seed = seed;
+  buffer->stream = stream;
+  buffer->agent[PLAYER_A] = agent_a;
+  buffer->agent[PLAYER_B] = agent_b;
+  buffer->game_turns = 0;
+  memset(&buffer->block, 0, sizeof(buffer->block));
+  buffer->block.magic = MATCH_LOG_BLOCK_MAGIC;
+  buffer->actions = NULL;
+  if(log->flags & MATCH_LOG_ACTIONS)
+  { buffer->actions = (uint8_t*)malloc(MATCH_LOG_BLOCK_ACTION_BYTES);
+    if(buffer->actions == NULL)
+    { free(buffer);
+      return NULL;
+    }
+    action_trace_record(&buffer->trace, buffer->actions, MATCH_LOG_GAME_ACTION_BYTES);
+  }
+  return buffer;
+} // match_log_buffer_create
+
+void match_log_record_turn(MatchLogBuffer* buffer, const struct gamestate* gstate)
+{ // A game never has more than MAX_NUMBER_OF_TURNS turns, and a block is
+  // flushed while it still has room for that many
+  if(buffer->game_turns >= MAX_NUMBER_OF_TURNS) return;
+
+  MatchLogTurn* turn = &buffer->turns[buffer->block.num_turns + buffer->game_turns++];
+  for(PlayerID p = PLAYER_A; p <= PLAYER_B; p++)
+  { turn->cash[p] = gstate->current_cash_balance[p];
+    turn->energy[p] = gstate->current_energy[p];
+    turn->hand_size[p] = gstate->hand[p].size;
+  }
+} // match_log_record_turn
+
+void match_log_record_game(MatchLogBuffer* buffer, const struct gamestate* gstate)
+{ MatchLogGame* game = &buffer->games[buffer->block.num_games++];
+  memset(game, 0, sizeof(MatchLogGame));
+  game->game = buffer->next_game++;
+  game->seed = (buffer->log->flags & MATCH_LOG_REPLAYABLE) ?
+               derive_game_seed(buffer->log->master_seed, game->game, GAME_STREAM_CHANCE) :
+               buffer->seed;
+  game->stream = buffer->stream;
+  game->first_turn = buffer->block.num_turns;
+  game->turns = gstate->turn;
+  game->result = gstate->game_state;
+  for(PlayerID p = PLAYER_A; p <= PLAYER_B; p++)
+  { game->cash[p] = gstate->current_cash_balance[p];
+    game->energy[p] = gstate->current_energy[p];
+    game->agent[p] = buffer->agent[p];
+  }
+  buffer->block.num_turns += buffer->game_turns;
+  buffer->game_turns = 0;
+
+  // The trace was recorded in place, right after the previous game's
+  if(buffer->actions != NULL)
+  { ActionTrace* trace = &buffer->trace;
+    game->first_action = buffer->block.num_action_bytes;
+    if(!trace->failed)
+    { game->action_bytes = (uint16_t)trace->length;
+      buffer->block.num_action_bytes += trace->length;
+    }
+  }
+
+  if(buffer->block.num_games == MATCH_LOG_BLOCK_GAMES ||
+     buffer->block.num_turns + MAX_NUMBER_OF_TURNS > MATCH_LOG_BLOCK_TURNS ||
+     buffer->block.num_action_bytes + MATCH_LOG_GAME_ACTION_BYTES > MATCH_LOG_BLOCK_ACTION_BYTES)
+    match_log_buffer_flush(buffer);
+  if(buffer->actions != NULL)
+    action_trace_record(&buffer->trace, buffer->actions + buffer->block.num_action_bytes,
+                        MATCH_LOG_GAME_ACTION_BYTES);
+} // match_log_record_game
+
+void match_log_buffer_flush(MatchLogBuffer* buffer)
+{ MatchLogBlockHeader* block = &buffer->block;
+  if(block->num_games == 0) return;
+
+  static const uint8_t padding[8] = {0};
+  uint32_t pad = (8 - block->num_action_bytes % 8) % 8;
+  MatchLog* log = buffer->log;
+  pthread_mutex_lock(&log->lock);
+  bool ok = fwrite(block, sizeof(MatchLogBlockHeader), 1, log->file) == 1 &&
+            fwrite(buffer->games, sizeof(MatchLogGame), block->num_games, log->file) == block->num_games &&
+            fwrite(buffer->turns, sizeof(MatchLogTurn), block->num_turns, log->file) == block->num_turns &&
+            (block->num_action_bytes == 0 ||
+             fwrite(buffer->actions, 1, block->num_action_bytes, log->file) == block->num_action_bytes) &&
+            fwrite(padding, 1, pad, log->file) == pad;
+  log->failed |= !ok;
+  log->games += block->num_games;
+  pthread_mutex_unlock(&log->lock);
+
+  block->num_games = 0;
+  block->num_turns = 0;
+  block->num_action_bytes = 0;
+} // match_log_buffer_flush
+
+void match_log_buffer_destroy(MatchLogBuffer* buffer)
+{ if(buffer == NULL) return;
+  match_log_buffer_flush(buffer);
+  free(buffer->actions);
+  free(buffer);
+}
+
+bool match_log_open(const char* path, MatchLogReader* reader)
+{ memset(reader, 0, sizeof(MatchLogReader));
+
+  int fd = open(path, O_RDONLY);
+  if(fd < 0)
+  { perror("Failed to open match log");
+    return false;
+  }
+  struct stat st;
+  if(fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(MatchLogHeader))
+  { fprintf(stderr, "Error: %s is not a match log\n", path);
+    close(fd);
+    return false;
+  }
+  void* map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);  // the mapping keeps the file
+  if(map == MAP_FAILED)
+  { perror("Failed to map match log");
+    return false;
+  }
+  posix_madvise(map, (size_t)st.st_size, POSIX_MADV_SEQUENTIAL);
+  reader->data = (const uint8_t*)map;
+  reader->size = (size_t)st.st_size;
+  reader->header = (const MatchLogHeader*)map;
+
+  const MatchLogHeader* h = reader->header;
+  if(memcmp(h->magic, MATCH_LOG_MAGIC, sizeof(h->magic)) != 0 ||
+     h->version != MATCH_LOG_VERSION || h->header_size != sizeof(MatchLogHeader) ||
+     h->game_size != sizeof(MatchLogGame) || h->turn_size != sizeof(MatchLogTurn) ||
+     h->num_agents > MATCH_LOG_MAX_AGENTS)
+  { fprintf(stderr, "Error: %s is not a version %d match log\n", path, MATCH_LOG_VERSION);
+    match_log_reader_close(reader);
+    return false;
+  }
+
+  // Index the blocks, growing the index by doubling
+  uint32_t capacity = 0;
+  size_t offset = sizeof(MatchLogHeader);
+  while(offset < reader->size)
+  { const MatchLogBlockHeader* block = (const MatchLogBlockHeader*)(reader->data + offset);
+    bool whole = reader->size - offset >= sizeof(MatchLogBlockHeader);
+    size_t body = whole ? (size_t)block->num_games * sizeof(MatchLogGame) +
+                          (size_t)block->num_turns * sizeof(MatchLogTurn) +
+                          ((size_t)block->num_action_bytes + 7) / 8 * 8 : 0;
+    if(!whole || block->magic != MATCH_LOG_BLOCK_MAGIC ||
+       reader->size - offset - sizeof(MatchLogBlockHeader) < body)
+    { fprintf(stderr, "Error: %s is truncated or corrupt at byte %zu\n", path, offset);
+      match_log_reader_close(reader);
+      return false;
+    }
+
+    if(reader->num_blocks == capacity)
+    { capacity = capacity ? 2 * capacity : 64;
+      MatchLogBlock* grown = (MatchLogBlock*)realloc(reader->blocks, capacity * sizeof(MatchLogBlock));
+      if(grown == NULL)
+      { fprintf(stderr, "Failed to index match log\n");
+        match_log_reader_close(reader);
+        return false;
+      }
+      reader->blocks = grown;
+    }
+    MatchLogBlock* entry = &reader->blocks[reader->num_blocks++];
+    entry->games = (const MatchLogGame*)(block + 1);
+    entry->turns = (const MatchLogTurn*)(entry->games + block->num_games);
+    entry->actions = (const uint8_t*)(entry->turns + block->num_turns);
+    entry->num_games = block->num_games;
+    entry->first_record = reader->num_games;
+    reader->num_games += block->num_games;
+    offset += sizeof(MatchLogBlockHeader) + body;
+  }
+  return true;
+} // match_log_open
+
+void match_log_reader_close(MatchLogReader* reader)
+{ if(reader->data != NULL)
+    munmap((void*)reader->data, reader->size);
+  free(reader->blocks);
+  memset(reader, 0, sizeof(MatchLogReader));
+}
+
+const MatchLogGame* match_log_record(const MatchLogReader* reader, uint64_t i,
+                                     const MatchLogTurn** turns)
+{ if(i >= reader->num_games) return NULL;
+
+  // Last block starting at or before record i
+  uint32_t lo = 0, hi = reader->num_blocks - 1;
+  while(lo < hi)
+  { uint32_t mid = (lo + hi + 1) / 2;
+    if(reader->blocks[mid].first_record <= i) lo = mid;
+    else hi = mid - 1;
+  }
+  const MatchLogBlock* block = &reader->blocks[lo];
+  const MatchLogGame* game = &block->games[i - block->first_record];
+  if(turns != NULL)
+    *turns = &block->turns[game->first_turn];
+  return game;
+} // match_log_record
+
+const MatchLogGame* match_log_find_game(const MatchLogReader* reader, uint64_t game,
+                                        const MatchLogTurn** turns, const uint8_t** actions)
+{ for(uint32_t b = 0; b < reader->num_blocks; b++)
+  { const MatchLogBlock* block = &reader->blocks[b];
+    if(block->num_games == 0 || game < block->games[0].game ||
+       game - block->games[0].game >= block->num_games)
+      continue;
+
+    const MatchLogGame* record = &block->games[game - block->games[0].game];
+    if(record->game != game) continue;   // not consecutive: damaged block
+    if(turns != NULL)
+      *turns = &block->turns[record->first_turn];
+    if(actions != NULL)
+      *actions = &block->actions[record->first_action];
+    return record;
+  }
+  return NULL;
+} // match_log_find_game
+
+bool match_log_add_to_rating(const MatchLogReader* reader, BTModel* model)
+{ uint32_t n = reader->header->num_agents;
+  uint64_t wins[MATCH_LOG_MAX_AGENTS][MATCH_LOG_MAX_AGENTS];
+  uint64_t draws[MATCH_LOG_MAX_AGENTS][MATCH_LOG_MAX_AGENTS];
+  memset(wins, 0, sizeof(wins));
+  memset(draws, 0, sizeof(draws));
+
+  for(uint32_t b = 0; b < reader->num_blocks; b++)
+  { const MatchLogBlock* block = &reader->blocks[b];
+    for(uint32_t g = 0; g < block->num_games; g++)
+    { const MatchLogGame* game = &block->games[g];
+      uint8_t a = game->agent[PLAYER_A] % MATCH_LOG_MAX_AGENTS;
+      uint8_t c = game->agent[PLAYER_B] % MATCH_LOG_MAX_AGENTS;
+      if(game->result == PLAYER_A_WINS) wins[a][c]++;
+      else if(game->result == PLAYER_B_WINS) wins[c][a]++;
+      else draws[a][c]++;
+    }
+  }
+
+  int player[MATCH_LOG_MAX_AGENTS];
+  for(uint32_t i = 0; i < n; i++)
+  { player[i] = bt_find_player(model, reader->header->agents[i]);
+    if(player[i] < 0)
+      player[i] = bt_add_player(model, reader->header->agents[i]);
+    if(player[i] < 0) return false;
+  }
+
+  for(uint32_t i = 0; i < n; i++)
+    for(uint32_t j = i + 1; j < n; j++)
+    { uint64_t d = draws[i][j] + draws[j][i];
+      if(wins[i][j] + wins[j][i] + d > 0 &&
+         !bt_add_games(model, (uint32_t)player[i], (uint32_t)player[j], wins[i][j], wins[j][i], d))
+        return false;
+    }
+  return true;
+} // match_log_add_to_rating
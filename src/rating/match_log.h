@@ -0,0 +1,177 @@
+// match_log.h
+// Binary per-game match log: fixed-size game records and per-turn summaries,
+// written in large blocks by each simulation worker, and read back through a
+// memory map with no parsing (records are used in place). Optionally every
+// game's actions are logged too (actions/action_trace.h), so any one game can
+// be rebuilt on its own (roles/stda/stda_replay.h).
+
+#ifndef MATCH_LOG_H
+#define MATCH_LOG_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <pthread.h>
+
+#include "../core/game_types.h"
+#include "../actions/action_trace.h"
+#include "bt_rating.h"
+
+#define MATCH_LOG_MAGIC "ORMLOG\r\n"      // 8 bytes, no terminator
+#define MATCH_LOG_VERSION 2
+#define MATCH_LOG_BLOCK_MAGIC 0x4b4c424fu  // "OBLK" little-endian
+#define MATCH_LOG_MAX_AGENTS 16
+#define MATCH_LOG_BLOCK_GAMES 4096          // game records per block
+#define MATCH_LOG_BLOCK_TURNS (64 * MATCH_LOG_BLOCK_GAMES)
+#define MATCH_LOG_BLOCK_ACTION_BYTES (1024 * MATCH_LOG_BLOCK_GAMES)
+#define MATCH_LOG_GAME_ACTION_BYTES 16384   // a longer trace is dropped (action_bytes 0)
+
+// MatchLogHeader.flags
+#define MATCH_LOG_REPLAYABLE 0x1  // games seeded one by one (--replayable): record seed is the game's chance seed
+#define MATCH_LOG_ACTIONS    0x2  // blocks carry the action traces
+#define MATCH_LOG_LAZY_DECK  0x4  // games played with --lazydeck
+
+// File layout, native (little-endian) byte order throughout:
+//   MatchLogHeader
+//   blocks: MatchLogBlockHeader, MatchLogGame[num_games], MatchLogTurn[num_turns],
+//           action bytes[num_action_bytes] padded to a multiple of 8
+// A game's turn summaries and actions are in the same block as its record.
+// Blocks from different workers interleave, so records are not in game order;
+// each one carries its game index. A block holds consecutive games of one
+// worker.
+typedef struct
+{ char magic[8];
+  uint32_t version;
+  uint32_t header_size;
+  uint32_t game_size;      // sizeof(MatchLogGame)
+  uint32_t turn_size;      // sizeof(MatchLogTurn)
+  uint32_t master_seed;
+  uint32_t num_agents;
+  uint32_t flags;          // MATCH_LOG_REPLAYABLE, MATCH_LOG_ACTIONS, MATCH_LOG_LAZY_DECK
+  uint32_t rng_backend;    // RndBackend of the run
+  char agents[MATCH_LOG_MAX_AGENTS][BT_NAME_LEN];
+} MatchLogHeader;
+
+typedef struct
+{ uint32_t magic;
+  uint32_t num_games;
+  uint32_t num_turns;
+  uint32_t num_action_bytes;
+} MatchLogBlockHeader;
+
+typedef struct
+{ uint64_t game;           // index in the run
+  uint32_t seed;           // seed of the worker stream it was played on (derive_stream_seed),
+                           // or with MATCH_LOG_REPLAYABLE its own chance seed (derive_game_seed)
+  uint32_t first_turn;     // its first turn summary, in the block
+  uint32_t first_action;   // its first action byte, in the block
+  uint16_t action_bytes;   // 0 = actions not logged
+  uint16_t turns;
+  uint16_t cash[2];        // final
+  uint16_t stream;         // worker stream
+  uint8_t agent[2];        // header agent of seat A and seat B
+  uint8_t result;          // GameStateEnum: PLAYER_A_WINS, PLAYER_B_WINS or DRAW
+  uint8_t energy[2];       // final
+  uint8_t reserved[5];
+} MatchLogGame;
+
+// State after each turn
+typedef struct
+{ uint16_t cash[2];
+  uint8_t energy[2];
+  uint8_t hand_size[2];
+} MatchLogTurn;
+
+_Static_assert(sizeof(MatchLogGame) == 40, "match log game records are 40 bytes");
+_Static_assert(sizeof(MatchLogTurn) == 8, "match log turn records are 8 bytes");
+_Static_assert(sizeof(MatchLogHeader) % 8 == 0 && sizeof(MatchLogBlockHeader) % 8 == 0,
+               "match log headers keep the records 8-byte aligned");
+
+// An open log, shared by the workers; blocks are appended under the lock
+typedef struct
+{ FILE* file;
+  pthread_mutex_t lock;
+  uint32_t master_seed;
+  uint32_t flags;
+  uint64_t games;
+  bool failed;             // a write failed; match_log_close() reports it
+} MatchLog;
+
+// One worker's block in the making. Games are numbered from first_game on.
+// With actions, the worker's GameContext.action_trace points to trace, which
+// records each game straight into the block.
+typedef struct MatchLogBuffer
+{ MatchLog* log;
+  uint64_t next_game;
+  uint32_t seed;           // worker stream seed (a replayable log seeds each record)
+  uint16_t stream;
+  uint8_t agent[2];
+  uint32_t game_turns;     // turns recorded for the game in progress
+  MatchLogBlockHeader block;
+  ActionTrace trace;
+  uint8_t* actions;        // MATCH_LOG_BLOCK_ACTION_BYTES, NULL without actions
+  MatchLogGame games[MATCH_LOG_BLOCK_GAMES];
+  MatchLogTurn turns[MATCH_LOG_BLOCK_TURNS];
+} MatchLogBuffer;
+
+// Create (truncate) path and write the header (flags: MATCH_LOG_*). Returns
+// NULL on failure.
+MatchLog* match_log_create(const char* path, uint32_t master_seed, RndBackend rng_backend,
+                           uint32_t flags, uint32_t num_agents,
+                           const char (*agent_names)[BT_NAME_LEN]);
+// Close the log; false if any write failed
+bool match_log_close(MatchLog* log);
+
+// A replayable log (MATCH_LOG_REPLAYABLE) ignores seed; one with
+// MATCH_LOG_ACTIONS also gets room for the action traces
+MatchLogBuffer* match_log_buffer_create(MatchLog* log, uint64_t first_game, uint32_t seed,
+                                        uint16_t stream, uint8_t agent_a, uint8_t agent_b);
+// Summary of the turn just played, and the record of the game just finished
+void match_log_record_turn(MatchLogBuffer* buffer, const struct gamestate* gstate);
+void match_log_record_game(MatchLogBuffer* buffer, const struct gamestate* gstate);
+// Append the buffered games as one block
+void match_log_buffer_flush(MatchLogBuffer* buffer);
+// Flush and free
+void match_log_buffer_destroy(MatchLogBuffer* buffer);
+
+// Reader: the file is mapped read-only and only the block headers are read on
+// open, to index the blocks; records are returned as pointers into the map
+typedef struct
+{ const MatchLogGame* games;
+  const MatchLogTurn* turns;
+  const uint8_t* actions;
+  uint32_t num_games;
+  uint64_t first_record;   // records in the blocks before this one
+} MatchLogBlock;
+
+typedef struct
+{ const MatchLogHeader* header;
+  const uint8_t* data;
+  size_t size;
+  MatchLogBlock* blocks;
+  uint32_t num_blocks;
+  uint64_t num_games;
+} MatchLogReader;
+
+// Map and index path; prints the reason to stderr and returns false if it is
+// not a match log of this version or is truncated
+bool match_log_open(const char* path, MatchLogReader* reader);
+void match_log_reader_close(MatchLogReader* reader);
+
+// Record i in file order (0 <= i < num_games), and its turn summaries if
+// turns is not NULL
+const MatchLogGame* match_log_record(const MatchLogReader* reader, uint64_t i,
+                                     const MatchLogTurn** turns);
+// Record of game number `game` (its index in the run), with its turn
+// summaries and action trace if turns and actions are not NULL; NULL if the
+// game is not in the log. Blocks are searched in file order.
+const MatchLogGame* match_log_find_game(const MatchLogReader* reader, uint64_t game,
+                                        const MatchLogTurn** turns, const uint8_t** actions);
+
+// Add the agents (by name, reusing players already in the model) and the
+// results of every pairing to model, in one scan of the records. Returns
+// false if the model runs out of memory.
+bool match_log_add_to_rating(const MatchLogReader* reader, BTModel* model);
+
+#endif // MATCH_LOG_H
@@ -0,0 +1,61 @@
+// sprt.c
+// Sequential probability ratio test (see sprt.h)
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "sprt.h"
+
+bool parse_sprt_arg(const char* arg, SPRTSpec* spec)
+{ if(arg == NULL) return false;
+
+  double values[4] = {0.0, 0.0, SPRT_DEFAULT_ALPHA, SPRT_DEFAULT_BETA};
+  const char* p = arg;
+  int count = 0;
+  for(;;)
+  { char* end;
+    values[count++] = strtod(p, &end);
+    if(end == p) return false;
+    if(*end == '\0') break;
+    if(*end != ',' || count == 4) return false;
+    p = end + 1;
+  }
+  if(count < 2) return false;
+
+  spec->elo0 = values[0];
+  spec->elo1 = values[1];
+  spec->alpha = values[2];
+  spec->beta = values[3];
+  return spec->elo0 < spec->elo1 &&
+         spec->alpha > 0.0 && spec->beta > 0.0 && spec->alpha + spec->beta < 1.0;
+} // parse_sprt_arg
+
+double sprt_elo_to_score(double elo)
+{ return 1.0 / (1.0 + pow(10.0, -elo / 400.0));
+}
+
+double sprt_llr(const SPRTSpec* spec, uint64_t n, double sum, double sum_sq)
+{ if(n < 2) return 0.0;
+
+  double mean = sum / (double)n;
+  double var = sum_sq / (double)n - mean * mean;
+  if(var <= 0.0) return 0.0;
+
+  double s0 = sprt_elo_to_score(spec->elo0);
+  double s1 = sprt_elo_to_score(spec->elo1);
+  return (double)n * (s1 - s0) * (2.0 * mean - s0 - s1) / (2.0 * var);
+} // sprt_llr
+
+double sprt_lower_bound(const SPRTSpec* spec)
+{ return log(spec->beta / (1.0 - spec->alpha));
+}
+
+double sprt_upper_bound(const SPRTSpec* spec)
+{ return log((1.0 - spec->beta) / spec->alpha);
+}
+
+SPRTDecision sprt_decide(const SPRTSpec* spec, double llr)
+{ if(llr >= sprt_upper_bound(spec)) return SPRT_ACCEPT_H1;
+  if(llr <= sprt_lower_bound(spec)) return SPRT_ACCEPT_H0;
+  return SPRT_CONTINUE;
+}
@@ -0,0 +1,47 @@
+// sprt.h
+// Sequential probability ratio test on the Elo difference of two agents,
+// for stopping an A/B match as soon as the answer is clear
+
+#ifndef SPRT_H
+#define SPRT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SPRT_DEFAULT_ALPHA 0.05
+#define SPRT_DEFAULT_BETA 0.05
+
+// H0: the Elo difference is elo0, H1: it is elo1 (elo0 < elo1). alpha is the
+// chance of accepting H1 when H0 holds, beta that of accepting H0 under H1.
+typedef struct
+{ double elo0;
+  double elo1;
+  double alpha;
+  double beta;
+} SPRTSpec;
+
+typedef enum
+{ SPRT_CONTINUE = 0,
+  SPRT_ACCEPT_H0,
+  SPRT_ACCEPT_H1
+} SPRTDecision;
+
+// Parse "ELO0,ELO1[,ALPHA[,BETA]]" (alpha and beta default to 0.05)
+bool parse_sprt_arg(const char* arg, SPRTSpec* spec);
+
+// Log-likelihood ratio of H1 against H0 after n samples in [0, 1] (game
+// scores, or the mean score of a paired deal) with the given sum and sum of
+// squares. Uses the normal approximation with the observed variance (the
+// generalized SPRT), so draws and paired deals need no separate model.
+// Returns 0 while the variance is 0.
+double sprt_llr(const SPRTSpec* spec, uint64_t n, double sum, double sum_sq);
+
+// Stopping bounds log(beta / (1 - alpha)) and log((1 - beta) / alpha)
+double sprt_lower_bound(const SPRTSpec* spec);
+double sprt_upper_bound(const SPRTSpec* spec);
+SPRTDecision sprt_decide(const SPRTSpec* spec, double llr);
+
+// Expected score of the stronger side at an Elo difference (logistic model)
+double sprt_elo_to_score(double elo);
+
+#endif // SPRT_H
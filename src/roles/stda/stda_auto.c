@@ -1,6 +1,10 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <inttypes.h>
+#include <math.h>
+#include <pthread.h>
+#include <time.h>
 
 #include "stda_auto.h"
 #include "../../core/game_types.h"
@@ -11,17 +15,104 @@
 #include "../../core/game_state.h"
 #include "../../core/turn_logic.h"
 #include "../../core/card_actions.h"
+#include "../../core/zobrist.h"
+#include "../../core/batch_sim.h"
 #include "../../util/debug.h"
-#include "stats_constants.h"
+#include "../../util/prng_seed.h"
+#include "../../util/profile.h"
+#include "../../rating/match_log.h"
+#include "../../actions/action_trace.h"
+#include "../../core/stats_constants.h"
+#include "stda_tournament.h"
+#include "stda_replay.h"
 
 //extern MTRand MTwister_rand_struct;
 
+#define MATCH_LOG_LEAD_TURN 10  // --matchlog.read: turn at which the energy lead is checked
+
+// One simulation worker: a contiguous slice of the game range, played on its
+// own GameContext (own RNG stream) into its own gamestats shard
+typedef struct
+{ pthread_t thread;
+  uint64_t numsim;
+  uint64_t first_game;
+  uint16_t initial_cash;
+  StrategySet* strategies;
+  GameContext* ctx;
+  struct gamestats gstats;
+} SimWorker;
+
+void match_agent_names(const config_t* cfg, char (*names)[BT_NAME_LEN])
+{ for(PlayerID p = PLAYER_A; p <= PLAYER_B; p++)
+    snprintf(names[p], BT_NAME_LEN, "%s%s",
+             get_strategy_display_name(cfg->ai_players[p], cfg->language),
+             (p == PLAYER_B && cfg->ai_players[PLAYER_A] == cfg->ai_players[PLAYER_B]) ? " #2" : "");
+}
+
+bool create_agent_contexts(GameContext* ctx)
+{ for(PlayerID p = PLAYER_A; p <= PLAYER_B; p++)
+  { ctx->agent_ctx[p] = create_game_context(ctx->config);
+    if(ctx->agent_ctx[p] == NULL)
+    { destroy_agent_contexts(ctx);
+      return false;
+    }
+  }
+  return true;
+}
+
+void destroy_agent_contexts(GameContext* ctx)
+{ for(PlayerID p = PLAYER_A; p <= PLAYER_B; p++)
+  { destroy_game_context(ctx->agent_ctx[p]);
+    ctx->agent_ctx[p] = NULL;
+  }
+}
+
+static void destroy_worker_context(GameContext* ctx)
+{ if(ctx == NULL) return;
+  match_log_buffer_destroy(ctx->match_log);
+  destroy_agent_contexts(ctx);
+  destroy_game_context(ctx);
+}
+
+// A worker's context: with --replayable each agent gets its own, and with a
+// match log the worker gets a log buffer (and traces its games into it when
+// the log keeps actions)
+static GameContext* create_worker_context(config_t* cfg, uint16_t t, uint64_t first_game,
+                                          MatchLog* log)
+{ GameContext* ctx = create_game_context_for_stream(cfg, t);
+  if(ctx == NULL) return NULL;
+
+  bool ok = !cfg->replayable || create_agent_contexts(ctx);
+  if(ok && log != NULL)
+  { ctx->match_log = match_log_buffer_create(log, first_game, derive_stream_seed(cfg->prng_seed, t),
+                                             t, PLAYER_A, PLAYER_B);
+    ok = ctx->match_log != NULL;
+    if(ok && ctx->match_log->actions != NULL)
+      ctx->action_trace = &ctx->match_log->trace;
+  }
+  if(!ok)
+  { destroy_worker_context(ctx);
+    return NULL;
+  }
+  return ctx;
+} // create_worker_context
+
 // Standalone Auto mode code
 int run_mode_stda_auto(config_t* cfg)
-{ // Create game context
-  GameContext* ctx = create_game_context(cfg);
-  if(ctx == NULL)
-  { fprintf(stderr, "Failed to create game context\n");
+{ if(cfg->replay)
+    return run_mode_stda_replay(cfg);
+  if(cfg->match_log_read)
+    return run_mode_stda_match_log(cfg);
+  if(cfg->tournament || cfg->paired || cfg->sprt)
+    return run_mode_stda_tournament(cfg);
+  if(cfg->match_log_actions && (!cfg->match_log || !cfg->replayable))
+  { fprintf(stderr, "Error: --matchlog.actions needs --matchlog and --replayable\n");
+    return EXIT_FAILURE;
+  }
+  if(cfg->batch && (cfg->ai_players[PLAYER_A] != AI_STRATEGY_RANDOM ||
+                    cfg->ai_players[PLAYER_B] != AI_STRATEGY_RANDOM ||
+                    cfg->match_log || cfg->replayable))
+  { fprintf(stderr, "Error: --batch plays random agents only, without --matchlog or --replayable\n");
     return EXIT_FAILURE;
   }
 
@@ -30,60 +121,279 @@ int run_mode_stda_auto(config_t* cfg)
   memset(&gstats, 0, sizeof(struct gamestats));
 
   // Simulation parameters: this is something that is specific to a 'simulation' mode (stda.sim or client.sim for interactive simulation or stda.auto for automated simulation)
-  uint16_t numsim = (cfg->numsim > 0) ? oraclemin(cfg->numsim, MAX_NUMBER_OF_SIM) : MAX_NUMBER_OF_SIM;
+  uint64_t numsim = (cfg->numsim > 0) ? cfg->numsim : DEFAULT_NUMBER_OF_SIM;
   uint16_t initial_cash = INITIAL_CASH_DEFAULT;
+  uint16_t num_threads = (cfg->num_threads > 1) ?
+                         (uint16_t)oraclemin((uint64_t)cfg->num_threads, numsim) : 1;
 
   // Setup strategies for both players: this is something that would be client side
   StrategySet* strategies = create_strategy_set();
-  set_player_strategy(strategies, PLAYER_A,
-                      random_attack_strategy, random_defense_strategy);
-  set_player_strategy(strategies, PLAYER_B,
-                      random_attack_strategy, random_defense_strategy);
+  for(PlayerID p = PLAYER_A; p <= PLAYER_B; p++)
+  { if(!set_player_strategy_by_type(strategies, p, cfg->ai_players[p]))
+    { fprintf(stderr, "Error: AI agent '%s' is not implemented yet\n",
+              get_strategy_display_name(cfg->ai_players[p], cfg->language));
+      free_strategy_set(strategies);
+      return EXIT_FAILURE;
+    }
+  }
+  if(cfg->verbose)
+    printf("Player A: %s, player B: %s\n",
+           get_strategy_display_name(cfg->ai_players[PLAYER_A], cfg->language),
+           get_strategy_display_name(cfg->ai_players[PLAYER_B], cfg->language));
+
+  MatchLog* log = NULL;
+  if(cfg->match_log)
+  { char names[2][BT_NAME_LEN];
+    match_agent_names(cfg, names);
+    uint32_t flags = (cfg->replayable ? MATCH_LOG_REPLAYABLE : 0) |
+                     (cfg->match_log_actions ? MATCH_LOG_ACTIONS : 0) |
+                     (cfg->lazy_deck ? MATCH_LOG_LAZY_DECK : 0);
+    log = match_log_create(cfg->match_log, cfg->prng_seed, cfg->prng_backend, flags, 2,
+                           (const char (*)[BT_NAME_LEN])names);
+    if(log == NULL)
+    { free_strategy_set(strategies);
+      return EXIT_FAILURE;
+    }
+  }
+
+  if(cfg->profile)
+    profile_start();
 
   // Run simulation: this is something that is specific to simulation mode (in this specific case, for the CLI only application, it's the automated simulation stda.auto)
-  run_simulation(numsim, initial_cash, &gstats, strategies, ctx);
-  present_results(&gstats);
+  int ret = EXIT_SUCCESS;
+  if(num_threads > 1)
+  { if(cfg->verbose)
+      printf("Running %" PRIu64 " games on %u threads\n", numsim, num_threads);
+    ret = run_simulation_parallel(numsim, initial_cash, num_threads,
+                                  &gstats, strategies, cfg, log);
+  }
+  else
+  { GameContext* ctx = create_worker_context(cfg, 0, 0, log);
+    if(ctx == NULL)
+    { fprintf(stderr, "Failed to create game context\n");
+      match_log_close(log);
+      free_strategy_set(strategies);
+      return EXIT_FAILURE;
+    }
+    run_simulation(numsim, 0, initial_cash, &gstats, strategies, ctx);
+    destroy_worker_context(ctx);
+  }
+
+  if(log)
+  { uint64_t logged = log->games;
+    if(!match_log_close(log))
+    { fprintf(stderr, "Failed to write match log %s\n", cfg->match_log);
+      ret = EXIT_FAILURE;
+    }
+    else if(cfg->verbose)
+      printf("Logged %" PRIu64 " games to %s\n", logged, cfg->match_log);
+  }
+
+  if(ret == EXIT_SUCCESS)
+    present_results(&gstats);
 
   // Cleanup (counterpart to initialization strategies struct earlier)
   free_strategy_set(strategies);
-  destroy_game_context(ctx);
 
-  return EXIT_SUCCESS;
+  return ret;
 } // end of standalone auto mode code
 
-void run_simulation(uint16_t numsim, uint16_t initial_cash,
+void seed_stda_auto_game(GameContext* ctx, uint32_t master_seed, uint64_t game,
+                         uint32_t stream_base, uint8_t first)
+{ RND_reseed(&ctx->rng, derive_game_seed(master_seed, game, stream_base + GAME_STREAM_CHANCE));
+  for(PlayerID seat = PLAYER_A; seat <= PLAYER_B; seat++)
+    if(ctx->agent_ctx[seat] != NULL)
+      RND_reseed(&ctx->agent_ctx[seat]->rng,
+                 derive_game_seed(master_seed, game, stream_base + GAME_STREAM_AGENT_0 + (seat ^ first)));
+}
+
+// --batch: the games in lockstep batches, seeded from ctx's stream
+static void run_simulation_batch(uint64_t numsim, uint16_t initial_cash,
+                                 struct gamestats* gstats, GameContext* ctx)
+{ BatchSim bs;
+  BatchResult results[BATCH_LANES];
+  uint64_t seed = (uint64_t)RND_next32(&ctx->rng) << 32;
+  seed |= RND_next32(&ctx->rng);
+  batch_sim_init(&bs, numsim, initial_cash, seed, BATCH_ISA_AUTO);
+
+  while(!batch_sim_done(&bs))
+  { uint32_t n = batch_sim_step(&bs, results);
+    for(uint32_t i = 0; i < n; i++)
+    { if(results[i].game_state == DRAW)
+        ++gstats->cumul_number_of_draws;
+      else
+        ++gstats->cumul_player_wins[results[i].game_state];
+      record_game_length(gstats, results[i].turns);
+    }
+  }
+}
+
+void run_simulation(uint64_t numsim, uint64_t first_game, uint16_t initial_cash,
                     struct gamestats* gstats, StrategySet* strategies, GameContext* ctx)
-{ for(gstats->simnum = 0; gstats->simnum < numsim; gstats->simnum++)
-  { DEBUG_PRINT("Begin game %.4u\n", gstats->simnum);
+{ if(ctx->config->batch)
+  { run_simulation_batch(numsim, initial_cash, gstats, ctx);
+    return;
+  }
+  for(uint64_t simnum = 0; simnum < numsim; simnum++)
+  { if(ctx->config->replayable)
+      seed_stda_auto_game(ctx, ctx->config->prng_seed, first_game + simnum, 0, 0);
+    DEBUG_PRINT("Begin game %.4" PRIu64 "\n", simnum);
     play_stda_auto_game(initial_cash, gstats, strategies, ctx);
-    DEBUG_PRINT("End game %.4u\n\n", gstats->simnum);
+    DEBUG_PRINT("End game %.4" PRIu64 "\n\n", simnum);
   }
+  profile_thread_flush();
 }
 
-void play_stda_auto_game(uint16_t initial_cash, struct gamestats* gstats,
-                         StrategySet* strategies, GameContext* ctx)  // need to accept a *cfg here so as to use later on
-{ struct gamestate gstate;
-  setup_game(initial_cash, &gstate, ctx);
+static void* sim_worker_main(void* arg)
+{ SimWorker* w = (SimWorker*)arg;
+  run_simulation(w->numsim, w->first_game, w->initial_cash, &w->gstats, w->strategies, w->ctx);
+  return NULL;
+}
+
+// Split numsim games into num_threads contiguous slices. Worker t always gets
+// the same slice and RNG stream t, and shards are merged in worker order, so
+// results only depend on (seed, numsim, num_threads) -- never on scheduling;
+// with --replayable every game is seeded by its index, and not even on
+// num_threads.
+// The strategy set and fullDeck are shared read-only; everything mutable is
+// per worker.
+int run_simulation_parallel(uint64_t numsim, uint16_t initial_cash, uint16_t num_threads,
+                            struct gamestats* gstats, StrategySet* strategies, config_t* cfg,
+                            MatchLog* log)
+{ SimWorker* workers = (SimWorker*)calloc(num_threads, sizeof(SimWorker));
+  if(workers == NULL)
+  { fprintf(stderr, "Failed to allocate simulation workers\n");
+    return EXIT_FAILURE;
+  }
+
+  int ret = EXIT_SUCCESS;
+  uint16_t t;
+  for(t = 0; t < num_threads; t++)
+  { workers[t].numsim = (t + 1) * numsim / num_threads - t * numsim / num_threads;
+    workers[t].first_game = t * numsim / num_threads;
+    workers[t].initial_cash = initial_cash;
+    workers[t].strategies = strategies;
+    workers[t].ctx = create_worker_context(cfg, t, workers[t].first_game, log);
+    if(workers[t].ctx == NULL)
+    { fprintf(stderr, "Failed to create game context for worker %u\n", t);
+      ret = EXIT_FAILURE;
+      break;
+    }
+  }
+
+  if(ret == EXIT_SUCCESS)
+  { // Worker 0 runs on the calling thread; a worker whose thread cannot be
+    // started also runs inline, which changes timing but not results
+    bool started[num_threads];
+    for(t = 1; t < num_threads; t++)
+      started[t] = pthread_create(&workers[t].thread, NULL,
+                                  sim_worker_main, &workers[t]) == 0;
+
+    sim_worker_main(&workers[0]);
+
+    for(t = 1; t < num_threads; t++)
+    { if(started[t])
+        pthread_join(workers[t].thread, NULL);
+      else
+        sim_worker_main(&workers[t]);
+    }
+
+    for(t = 0; t < num_threads; t++)
+      merge_gamestats(gstats, &workers[t].gstats);
+  }
+
+  for(t = 0; t < num_threads; t++)
+    destroy_worker_context(workers[t].ctx);
+  free(workers);
+
+  return ret;
+} // run_simulation_parallel
+
+// Fold a worker shard into the aggregate statistics (Chan et al. pairwise
+// combination of the Welford accumulators)
+void merge_gamestats(struct gamestats* dst, const struct gamestats* src)
+{ dst->cumul_player_wins[PLAYER_A] += src->cumul_player_wins[PLAYER_A];
+  dst->cumul_player_wins[PLAYER_B] += src->cumul_player_wins[PLAYER_B];
+  dst->cumul_number_of_draws += src->cumul_number_of_draws;
+
+  for(uint8_t i = 0; i < HISTOGRAM_TOTAL_BINS; i++)
+    dst->turn_histogram[i] += src->turn_histogram[i];
+
+  if(src->simnum == 0) return;
+  if(dst->simnum == 0)
+  { dst->simnum = src->simnum;
+    dst->turn_mean = src->turn_mean;
+    dst->turn_m2 = src->turn_m2;
+    dst->turn_min = src->turn_min;
+    dst->turn_max = src->turn_max;
+    return;
+  }
+
+  double n_a = (double)dst->simnum;
+  double n_b = (double)src->simnum;
+  double n = n_a + n_b;
+  double delta = src->turn_mean - dst->turn_mean;
+
+  dst->turn_mean += delta * n_b / n;
+  dst->turn_m2 += src->turn_m2 + delta * delta * n_a * n_b / n;
+  dst->turn_min = oraclemin(dst->turn_min, src->turn_min);
+  dst->turn_max = oraclemax(dst->turn_max, src->turn_max);
+  dst->simnum += src->simnum;
+} // merge_gamestats
+
+void begin_stda_auto_game(uint16_t initial_cash, struct gamestate* gstate, GameContext* ctx)
+{ setup_game(initial_cash, gstate, ctx);
 
   // Apply mulligan for player B: when in interactive mode (CLI, TUI, GUI), this needs to be delegated to the user or AI to make a choice of what to mulligan (if anything)
-  apply_mulligan(&gstate, ctx);
+  apply_mulligan(gstate, ctx);
 
   DEBUG_PRINT("Game started with %d A, %d B cash; %d A, %d B energy\n",
-              gstate.current_cash_balance[PLAYER_A],
-              gstate.current_cash_balance[PLAYER_B],
-              gstate.current_energy[PLAYER_A],
-              gstate.current_energy[PLAYER_B]);
+              gstate->current_cash_balance[PLAYER_A],
+              gstate->current_cash_balance[PLAYER_B],
+              gstate->current_energy[PLAYER_A],
+              gstate->current_energy[PLAYER_B]);
+
+  gstate->turn = 0;
+
+  for(PlayerID p = PLAYER_A; p <= PLAYER_B; p++)
+    if(ctx->agent_ctx[p] != NULL)
+    { ctx->agent_ctx[p]->game_ctx = ctx;
+      ctx->agent_ctx[p]->game = gstate;
+    }
+  if(ctx->action_trace)
+    action_trace_start(ctx->action_trace, gstate);
+} // begin_stda_auto_game
+
+bool stda_auto_game_over(const struct gamestate* gstate)
+{ return gstate->turn >= MAX_NUMBER_OF_TURNS || gstate->someone_has_zero_energy;
+}
+
+void end_stda_auto_game(struct gamestate* gstate, GameContext* ctx)
+{ if(!gstate->someone_has_zero_energy)
+    gstate->game_state = DRAW;
 
+  for(PlayerID p = PLAYER_A; p <= PLAYER_B; p++)
+    if(ctx->agent_ctx[p] != NULL)
+    { ctx->agent_ctx[p]->game_ctx = NULL;
+      ctx->agent_ctx[p]->game = NULL;
+    }
+  if(ctx->action_trace)
+    ctx->action_trace->gstate = NULL;  // the trace itself stays for the match log
+} // end_stda_auto_game
 
-  gstate.turn = 0;
+void play_stda_auto_game(uint16_t initial_cash, struct gamestats* gstats,
+                         StrategySet* strategies, GameContext* ctx)  // need to accept a *cfg here so as to use later on
+{ struct gamestate gstate;
+  begin_stda_auto_game(initial_cash, &gstate, ctx);
 
   do
   { play_turn(gstats, &gstate, strategies, ctx); // need to pass cfg pointer to provide game mode information
+    if(ctx->match_log)
+      match_log_record_turn(ctx->match_log, &gstate);
   }
-  while(gstate.turn < MAX_NUMBER_OF_TURNS && !gstate.someone_has_zero_energy);
+  while(!stda_auto_game_over(&gstate));
 
-  if(!gstate.someone_has_zero_energy)
-    gstate.game_state = DRAW;
+  end_stda_auto_game(&gstate, ctx);
 
   DEBUG_PRINT("Game ended at round %.4u, turn %.4u, winner is %s\n",
               (uint16_t)((gstate.turn-1) * 0.5)+1,
@@ -92,6 +402,8 @@ void play_stda_auto_game(uint16_t initial_cash, struct gamestats* gstats,
 
 
   record_final_stats(gstats, &gstate); // need to pass cfg pointer to provide game mode information
+  if(ctx->match_log)
+    match_log_record_game(ctx->match_log, &gstate);
 
   // Free heap memory - No cleanup needed for fixed arrays
   DeckStk_emptyOut(&gstate.deck[PLAYER_A]);
@@ -133,6 +445,7 @@ void apply_mulligan(struct gamestate* gstate, GameContext* ctx)
 
     Hand_remove(&gstate->hand[PLAYER_B], card_with_lowest_power);
     Discard_add(&gstate->discard[PLAYER_B], card_with_lowest_power);
+    zobrist_move_card(gstate, PLAYER_B, ZOBRIST_HAND, ZOBRIST_DISCARD, card_with_lowest_power);
     nbr_cards_left_to_mulligan--;
   }
 
@@ -157,9 +470,34 @@ void record_final_stats(struct gamestats* gstats, struct gamestate* gstate) // n
       break;
   }
 
-  gstats->game_end_turn_number[gstats->simnum] = gstate->turn;
+  record_game_length(gstats, gstate->turn);
 } // record_final_stats
 
+// Fold one game length into the streaming accumulators (Welford's online
+// mean/variance, min/max, histogram), so memory stays O(1) in the number of games
+void record_game_length(struct gamestats* gstats, uint16_t turns)
+{ if(gstats->simnum == 0)
+  { gstats->turn_min = turns;
+    gstats->turn_max = turns;
+  }
+  else
+  { gstats->turn_min = oraclemin(gstats->turn_min, turns);
+    gstats->turn_max = oraclemax(gstats->turn_max, turns);
+  }
+
+  gstats->simnum++;
+  double delta = turns - gstats->turn_mean;
+  gstats->turn_mean += delta / (double)gstats->simnum;
+  gstats->turn_m2 += delta * (turns - gstats->turn_mean);
+
+  updateHistogram(gstats->turn_histogram, turns);
+} // record_game_length
+
+// Sample variance of the game length (0 with fewer than 2 games)
+double gamestats_turn_variance(const struct gamestats* gstats)
+{ return (gstats->simnum > 1) ? gstats->turn_m2 / (double)(gstats->simnum - 1) : 0.0;
+}
+
 /* Histogram preparation:
     Total bins: The NUM_BINS includes special underflow and overflow bins, resulting in a total of NUM_BINS + 2 bins in the histogram array.
     Underflow bin (Index 0): Any value in the raw data that is less than MIN_VALUE will be counted in this special bin.
@@ -168,74 +506,134 @@ void record_final_stats(struct gamestats* gstats, struct gamestate* gstate) // n
     Calculations: The logic for assigning a data point to a bin checks for the underflow and overflow conditions before calculating the index for the standard bins.
       The size of the histogram_array should reflect that.
     Printout changes: The output section is updated to properly label and display the results for the special underflow and overflow bins.
+    Streaming: bins live in struct gamestats and are updated once per game (updateHistogram), instead of being rebuilt from a per-game array.
 */
 
-// Function to create a histogram array from unsigned int data
-void createHistogram(uint16_t data[], uint16_t data_size, uint16_t histogram_array[])
-{ // Initialize the histogram array with zeros
-  for(uint16_t i = 0; i < HISTOGRAM_TOTAL_BINS; i++)
-    histogram_array[i] = 0;
-
-  // Define the upper boundary of the standard bins
+// Function to add one data point to a histogram array
+void updateHistogram(uint64_t histogram_array[], uint16_t value)
+{ // Define the upper boundary of the standard bins
   uint16_t max_valid_value = HISTOGRAM_MIN_VALUE + (HISTOGRAM_NUM_BINS * HISTOGRAM_BIN_WIDTH);
 
-  // Process each data point
-  for(uint16_t i = 0; i < data_size; i++)
-  { uint16_t value = data[i];
-
-    if(value < HISTOGRAM_MIN_VALUE)
-    { // Assign to the underflow bin
-      histogram_array[HISTOGRAM_UNDERFLOW_BIN]++;
-    }
-    else if(value >= max_valid_value)
-    { // Assign to the overflow bin
-      histogram_array[HISTOGRAM_OVERFLOW_BIN]++;
-    }
-    else
-    { // Calculate the bin index for standard bins
-      uint8_t bin_index = (value - HISTOGRAM_MIN_VALUE) / HISTOGRAM_BIN_WIDTH;
-      // The standard bins start at index 1
-      histogram_array[bin_index + 1]++;
-    }
+  if(value < HISTOGRAM_MIN_VALUE)
+  { // Assign to the underflow bin
+    histogram_array[HISTOGRAM_UNDERFLOW_BIN]++;
   }
-} // createHistogram
-
-void present_results(struct gamestats* gstats)
-{ printf("Number of wins for player A: %u\n", gstats->cumul_player_wins[PLAYER_A]);
-  printf("Number of wins for player B: %u\n", gstats->cumul_player_wins[PLAYER_B]);
-  printf("Number of draws: %u\n", gstats->cumul_number_of_draws);
-
-  uint16_t minNbrTurn = MAX_NUMBER_OF_TURNS;
-  uint16_t maxNbrTurn = 0;
-  uint32_t totalNbrTurn = 0;
-
-  for(uint16_t s = 0; s < gstats->simnum; s++)
-  { minNbrTurn = oraclemin(minNbrTurn, gstats->game_end_turn_number[s]);
-    maxNbrTurn = oraclemax(maxNbrTurn, gstats->game_end_turn_number[s]);
-    totalNbrTurn += gstats->game_end_turn_number[s];
+  else if(value >= max_valid_value)
+  { // Assign to the overflow bin
+    histogram_array[HISTOGRAM_OVERFLOW_BIN]++;
   }
+  else
+  { // Calculate the bin index for standard bins
+    uint8_t bin_index = (value - HISTOGRAM_MIN_VALUE) / HISTOGRAM_BIN_WIDTH;
+    // The standard bins start at index 1
+    histogram_array[bin_index + 1]++;
+  }
+} // updateHistogram
 
-  printf("\nAverage = %.1f, Minimum = %u, Maximum = %d number of turns per game\n",
-         (float)totalNbrTurn / (float)gstats->simnum, minNbrTurn, maxNbrTurn);
+void present_results(struct gamestats* gstats)
+{ printf("Number of wins for player A: %" PRIu64 "\n", gstats->cumul_player_wins[PLAYER_A]);
+  printf("Number of wins for player B: %" PRIu64 "\n", gstats->cumul_player_wins[PLAYER_B]);
+  printf("Number of draws: %" PRIu64 "\n", gstats->cumul_number_of_draws);
 
-  // compute and display histogram
-  { // Array to store the histogram counts. Size is total number of bins.
-    uint16_t histogram[HISTOGRAM_TOTAL_BINS];
+  printf("\nAverage = %.1f, Minimum = %u, Maximum = %u number of turns per game\n",
+         gstats->turn_mean, gstats->turn_min, gstats->turn_max);
+  printf("Standard deviation = %.2f number of turns per game\n",
+         sqrt(gamestats_turn_variance(gstats)));
 
-    // Create the histogram
-    createHistogram(gstats->game_end_turn_number, gstats->simnum, histogram);
+  // display histogram
+  { const uint64_t* histogram = gstats->turn_histogram;
 
     // Print the histogram results
     printf("\nHistogram with %d bins, each with a width of %d, starting from %u:\n", HISTOGRAM_NUM_BINS, HISTOGRAM_BIN_WIDTH, HISTOGRAM_MIN_VALUE);
-    printf("Bin (<%3u): %d\n", HISTOGRAM_MIN_VALUE, histogram[HISTOGRAM_UNDERFLOW_BIN]);
+    printf("Bin (<%3u): %" PRIu64 "\n", HISTOGRAM_MIN_VALUE, histogram[HISTOGRAM_UNDERFLOW_BIN]);
 
     for(uint8_t i = 0; i < HISTOGRAM_NUM_BINS; i++)
     { uint16_t bin_start = HISTOGRAM_MIN_VALUE + (i * HISTOGRAM_BIN_WIDTH);
       uint16_t bin_end = bin_start + HISTOGRAM_BIN_WIDTH - 1;
-      printf("Bin [%3u - %3u]: %d\n", bin_start, bin_end, histogram[i + 1]);
+      printf("Bin [%3u - %3u]: %" PRIu64 "\n", bin_start, bin_end, histogram[i + 1]);
     }
 
-    printf("Bin (>=%3u): %d\n", HISTOGRAM_MIN_VALUE + (HISTOGRAM_NUM_BINS * HISTOGRAM_BIN_WIDTH), histogram[HISTOGRAM_OVERFLOW_BIN]);
+    printf("Bin (>=%3u): %" PRIu64 "\n", HISTOGRAM_MIN_VALUE + (HISTOGRAM_NUM_BINS * HISTOGRAM_BIN_WIDTH), histogram[HISTOGRAM_OVERFLOW_BIN]);
   } // histogram section
 
+  profile_report(stdout);  // --profile only
+
 } // present_results
+
+// stda.auto with --matchlog.read: the same report as the games that wrote the
+// log, from one scan of the mapped records, plus final energy and cash by
+// result and the ratings of the logged agents
+int run_mode_stda_match_log(config_t* cfg)
+{ MatchLogReader reader;
+  if(!match_log_open(cfg->match_log_read, &reader))
+    return EXIT_FAILURE;
+
+  struct timespec start, end;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+
+  struct gamestats gstats;
+  memset(&gstats, 0, sizeof(struct gamestats));
+  uint64_t energy_sum[2] = {0, 0}, cash_sum[2] = {0, 0}, decided = 0;
+  uint64_t led = 0, leader_won = 0;  // energy leader after MATCH_LOG_LEAD_TURN turns
+  for(uint32_t b = 0; b < reader.num_blocks; b++)
+  { const MatchLogBlock* block = &reader.blocks[b];
+    for(uint32_t g = 0; g < block->num_games; g++)
+    { const MatchLogGame* game = &block->games[g];
+      if(game->result == PLAYER_A_WINS || game->result == PLAYER_B_WINS)
+      { gstats.cumul_player_wins[game->result]++;
+        uint8_t winner = game->result, loser = 1 - game->result;
+        energy_sum[0] += game->energy[winner];
+        energy_sum[1] += game->energy[loser];
+        cash_sum[0] += game->cash[winner];
+        cash_sum[1] += game->cash[loser];
+        decided++;
+
+        if(game->turns > MATCH_LOG_LEAD_TURN)
+        { const MatchLogTurn* turn = &block->turns[game->first_turn + MATCH_LOG_LEAD_TURN - 1];
+          if(turn->energy[PLAYER_A] != turn->energy[PLAYER_B])
+          { led++;
+            leader_won += (turn->energy[PLAYER_A] > turn->energy[PLAYER_B]) == (winner == PLAYER_A);
+          }
+        }
+      }
+      else
+        gstats.cumul_number_of_draws++;
+      record_game_length(&gstats, game->turns);
+    }
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  double elapsed_ms = (end.tv_sec - start.tv_sec) * 1e3 + (end.tv_nsec - start.tv_nsec) / 1e6;
+
+  printf("Match log %s: %" PRIu64 " games in %u blocks, seed %u\n", cfg->match_log_read,
+         reader.num_games, reader.num_blocks, reader.header->master_seed);
+  if(cfg->verbose)
+    printf("Scanned %.1f MB in %.1f ms (%.0f games/s)\n", reader.size / 1e6, elapsed_ms,
+           elapsed_ms > 0 ? 1e3 * (double)reader.num_games / elapsed_ms : 0.0);
+  printf("\n");
+  present_results(&gstats);
+
+  if(decided > 0)
+    printf("\nFinal energy: winner %.2f, loser %.2f; final cash: winner %.2f, loser %.2f\n",
+           (double)energy_sum[0] / decided, (double)energy_sum[1] / decided,
+           (double)cash_sum[0] / decided, (double)cash_sum[1] / decided);
+  if(led > 0)
+    printf("The energy leader after turn %d won %.1f%% of %" PRIu64 " decided games\n",
+           MATCH_LOG_LEAD_TURN, 100.0 * (double)leader_won / (double)led, led);
+
+  int ret = EXIT_SUCCESS;
+  BTModel* model = bt_create();
+  if(model == NULL || !match_log_add_to_rating(&reader, model))
+  { fprintf(stderr, "Failed to rate the match log\n");
+    ret = EXIT_FAILURE;
+  }
+  else if(model->num_pairs > 0 && bt_fit(model, BT_FIT_NEWTON, BT_DEFAULT_TOLERANCE,
+                                         BT_DEFAULT_MAX_ITERATIONS) >= 0)
+  { printf("\nBradley-Terry ratings (Elo, %s = 0):\n", reader.header->agents[0]);
+    bt_print(model, NULL, stdout);
+  }
+
+  bt_destroy(model);
+  match_log_reader_close(&reader);
+  return ret;
+} // run_mode_stda_match_log
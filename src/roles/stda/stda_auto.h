@@ -4,21 +4,55 @@
 #include <string.h>
 #include "../../core/game_types.h"
 #include "../../ai_strat/ai_strategy.h"
+#include "../../rating/match_log.h"
 
 
 /* Run mode functions */
 int run_mode_stda_auto(config_t* cfg);
+int run_mode_stda_match_log(config_t* cfg);
 
-// Simulation functions
-void run_simulation(uint16_t numsim, uint16_t initial_cash,
+// Log names of the -P agents; a mirror match gets a second name so ratings
+// can tell the seats apart
+void match_agent_names(const config_t* cfg, char (*names)[BT_NAME_LEN]);
+
+// Simulation functions. Games are numbered from first_game on; with
+// cfg->replayable each one is seeded by seed_stda_auto_game(..., game, 0, 0).
+// With cfg->batch (random agents) the games are played by the batch
+// simulator, core/batch_sim.h, and strategies is not used.
+void run_simulation(uint64_t numsim, uint64_t first_game, uint16_t initial_cash,
                     struct gamestats* gstats, StrategySet* strategies, GameContext* ctx);
+int run_simulation_parallel(uint64_t numsim, uint16_t initial_cash, uint16_t num_threads,
+                            struct gamestats* gstats, StrategySet* strategies, config_t* cfg,
+                            MatchLog* log);
+void merge_gamestats(struct gamestats* dst, const struct gamestats* src);
+
+// Give ctx a context for each seat's agent (--replayable), and free them
+bool create_agent_contexts(GameContext* ctx);
+void destroy_agent_contexts(GameContext* ctx);
+// Reseed ctx for game `game` alone (no need to play the games before it):
+// the chance stream from derive_game_seed(master_seed, game, stream_base +
+// GAME_STREAM_CHANCE), and the agent contexts, if any, from the agent streams;
+// the agent of seat s gets stream GAME_STREAM_AGENT_0 + (s ^ first), so with
+// first = 1 the agents keep their streams in swapped seats
+void seed_stda_auto_game(GameContext* ctx, uint32_t master_seed, uint64_t game,
+                         uint32_t stream_base, uint8_t first);
 
 void apply_mulligan(struct gamestate* gstate, GameContext* ctx);
+// One game, in steps: deal and mulligan (and hook the game to the agent
+// contexts and ctx->action_trace), play_turn() until stda_auto_game_over(),
+// then settle a draw and unhook. play_stda_auto_game() does all of it and
+// records the result.
+void begin_stda_auto_game(uint16_t initial_cash, struct gamestate* gstate, GameContext* ctx);
+bool stda_auto_game_over(const struct gamestate* gstate);
+void end_stda_auto_game(struct gamestate* gstate, GameContext* ctx);
 void play_stda_auto_game(uint16_t initial_cash, struct gamestats* gstats,
                          StrategySet* strategies, GameContext* ctx);
 
 // Stats recording and presentation
 void record_final_stats(struct gamestats* gstats, struct gamestate* gstate);
+void record_game_length(struct gamestats* gstats, uint16_t turns);
+double gamestats_turn_variance(const struct gamestats* gstats);
+void updateHistogram(uint64_t histogram_array[], uint16_t value);
 void present_results(struct gamestats* gstats);
 
 #endif
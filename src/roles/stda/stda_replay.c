@@ -0,0 +1,304 @@
+// stda_replay.c
+// Single-game replay of stda.auto runs (see stda_replay.h)
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include <time.h>
+
+#include "stda_replay.h"
+#include "stda_auto.h"
+#include "stda_tournament.h"
+#include "../../core/game_constants.h"
+#include "../../core/game_context.h"
+#include "../../core/turn_logic.h"
+#include "../../actions/action_trace.h"
+#include "../../rating/match_log.h"
+
+#define REPLAY_TRACE_BYTES 16384  // trace of a game replayed with its agents
+
+bool parse_replay_arg(const char* arg, uint32_t* job, uint64_t* game)
+{ if(arg == NULL || *arg < '0' || *arg > '9') return false;
+
+  char* end;
+  unsigned long long j = strtoull(arg, &end, 10);
+  if(*end != ':' || j > UINT32_MAX || end[1] < '0' || end[1] > '9') return false;
+  unsigned long long g = strtoull(end + 1, &end, 10);
+  if(*end != '\0') return false;
+
+  *job = (uint32_t)j;
+  *game = (uint64_t)g;
+  return true;
+} // parse_replay_arg
+
+static double elapsed_us(const struct timespec* from, const struct timespec* to)
+{ return (to->tv_sec - from->tv_sec) * 1e6 + (to->tv_nsec - from->tv_nsec) / 1e3;
+}
+
+// Seat and seed the game on ctx: a tournament game through its job, or game
+// `game` of the -P match
+static bool seat_replay_game(config_t* cfg, uint32_t job, uint64_t game, GameContext* ctx,
+                             GameContext* const agent_ctx[2], StrategySet* strategies,
+                             ReplayResult* out)
+{ if(cfg->tournament || cfg->paired || cfg->sprt)
+  { TournamentSpec spec;
+    if(!tournament_spec_from_config(cfg, &spec)) return false;
+    uint8_t seat_agent[2];
+    if(!tournament_seat_game(&spec, cfg->prng_seed, job, game, ctx, agent_ctx, strategies,
+                             seat_agent))
+    { fprintf(stderr, "Error: the tournament has no game %" PRIu64 " in job %u\n", game, job);
+      return false;
+    }
+    for(PlayerID seat = PLAYER_A; seat <= PLAYER_B; seat++)
+      snprintf(out->agents[seat], BT_NAME_LEN, "%s", spec.names[seat_agent[seat]]);
+    return true;
+  }
+
+  if(job != 0)
+  { fprintf(stderr, "Error: a -P match has job 0 only\n");
+    return false;
+  }
+  for(PlayerID seat = PLAYER_A; seat <= PLAYER_B; seat++)
+  { if(!set_player_strategy_by_type(strategies, seat, cfg->ai_players[seat]))
+    { fprintf(stderr, "Error: AI agent '%s' is not implemented yet\n",
+              get_strategy_display_name(cfg->ai_players[seat], cfg->language));
+      return false;
+    }
+    ctx->agent_ctx[seat] = agent_ctx[seat];
+  }
+  match_agent_names(cfg, out->agents);
+  seed_stda_auto_game(ctx, cfg->prng_seed, game, 0, 0);
+  return true;
+} // seat_replay_game
+
+bool replay_game(config_t* cfg, uint32_t job, uint64_t game, const uint8_t* actions,
+                 uint32_t action_bytes, ReplayTurnFunc on_turn, void* arg, ReplayResult* out)
+{ memset(out, 0, sizeof(ReplayResult));
+
+  GameContext* ctx = create_game_context(cfg);
+  GameContext* agent_ctx[2] = { create_game_context(cfg), create_game_context(cfg) };
+  StrategySet strategies;
+  bool ok = ctx != NULL && agent_ctx[0] != NULL && agent_ctx[1] != NULL;
+  if(!ok)
+    fprintf(stderr, "Failed to create game context\n");
+  else
+    ok = seat_replay_game(cfg, job, game, ctx, agent_ctx, &strategies, out);
+
+  if(ok)
+  { // With a trace the agents are not consulted, and the game's context
+    // serves every chance event, as it did for their actions when recorded
+    uint8_t recorded[REPLAY_TRACE_BYTES];
+    ActionTrace trace;
+    if(actions != NULL)
+    { action_trace_replay(&trace, actions, action_bytes);
+      for(PlayerID seat = PLAYER_A; seat <= PLAYER_B; seat++)
+      { strategies.attack_strategy[seat] = action_trace_attack_strategy;
+        strategies.defense_strategy[seat] = action_trace_defense_strategy;
+        ctx->agent_ctx[seat] = NULL;
+      }
+    }
+    else
+      action_trace_record(&trace, recorded, sizeof(recorded));
+    ctx->action_trace = &trace;
+
+    struct gamestats gstats;
+    memset(&gstats, 0, sizeof(gstats));
+    struct gamestate gstate;
+    struct timespec start, now;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    begin_stda_auto_game(INITIAL_CASH_DEFAULT, &gstate, ctx);
+    do
+    { uint32_t from = trace.length;
+      PlayerID attacker = gstate.current_player;
+      play_turn(&gstats, &gstate, &strategies, ctx);
+
+      if(on_turn != NULL)
+      { clock_gettime(CLOCK_MONOTONIC, &now);
+        out->elapsed_us += elapsed_us(&start, &now);
+        ReplayTurn turn = { .gstate = &gstate, .attacker = attacker,
+                            .actions = (actions != NULL ? actions : recorded) + from,
+                            .action_bytes = trace.length - from };
+        on_turn(&turn, arg);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+      }
+    }
+    while(!stda_auto_game_over(&gstate));
+    end_stda_auto_game(&gstate, ctx);
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    out->elapsed_us += elapsed_us(&start, &now);
+    out->result = gstate.game_state;
+    out->turns = gstate.turn;
+    for(PlayerID p = PLAYER_A; p <= PLAYER_B; p++)
+    { out->energy[p] = gstate.current_energy[p];
+      out->cash[p] = gstate.current_cash_balance[p];
+    }
+    out->trace_ok = !trace.failed && (actions == NULL || trace.length == action_bytes);
+    ctx->action_trace = NULL;
+    DeckStk_emptyOut(&gstate.deck[PLAYER_A]);
+    DeckStk_emptyOut(&gstate.deck[PLAYER_B]);
+  }
+
+  if(ctx != NULL)
+    ctx->agent_ctx[PLAYER_A] = ctx->agent_ctx[PLAYER_B] = NULL;
+  destroy_game_context(ctx);
+  destroy_game_context(agent_ctx[0]);
+  destroy_game_context(agent_ctx[1]);
+  return ok;
+} // replay_game
+
+// Printing pass: one line per turn, checked against the logged summaries
+typedef struct
+{ const MatchLogTurn* logged;   // NULL without a log
+  uint16_t logged_turns;
+  uint16_t mismatches;
+} ReplayPrinter;
+
+// The actions of one phase, as text; returns the bytes used
+static uint32_t format_phase(const uint8_t* bytes, uint32_t length, char* buf, size_t size)
+{ if(length == 0)
+  { snprintf(buf, size, "-");
+    return 0;
+  }
+  uint32_t used = 1;
+  int n = 0;
+  buf[0] = '\0';
+  for(uint8_t i = 0; i < bytes[0]; i++)
+  { Action action;
+    uint32_t len = action_decode(bytes + used, length - used, &action);
+    if(len == 0) break;
+    char text[48];
+    action_format(&action, text, sizeof(text));
+    if(n >= 0 && (size_t)n < size)
+      n += snprintf(buf + n, size - n, "%s%s", i ? ", " : "", text);
+    used += len;
+  }
+  if(bytes[0] == 0)
+    snprintf(buf, size, "pass");
+  return used;
+} // format_phase
+
+static void print_turn(const ReplayTurn* turn, void* arg)
+{ ReplayPrinter* printer = (ReplayPrinter*)arg;
+  const struct gamestate* g = turn->gstate;
+
+  char attack[96], defense[96];
+  uint32_t used = format_phase(turn->actions, turn->action_bytes, attack, sizeof(attack));
+  format_phase(turn->actions + used, turn->action_bytes - used, defense, sizeof(defense));
+  printf("%4u  %c: %-28s %c: %-20s energy %3u %3u  cash %3u %3u  hand %2u %2u",
+         g->turn, 'A' + turn->attacker, attack, 'A' + (1 - turn->attacker), defense,
+         g->current_energy[PLAYER_A], g->current_energy[PLAYER_B],
+         g->current_cash_balance[PLAYER_A], g->current_cash_balance[PLAYER_B],
+         g->hand[PLAYER_A].size, g->hand[PLAYER_B].size);
+
+  if(printer->logged != NULL)
+  { const MatchLogTurn* t = g->turn <= printer->logged_turns ? &printer->logged[g->turn - 1] : NULL;
+    bool same = t != NULL;
+    for(PlayerID p = PLAYER_A; p <= PLAYER_B && same; p++)
+      same = t->energy[p] == g->current_energy[p] && t->cash[p] == g->current_cash_balance[p] &&
+             t->hand_size[p] == g->hand[p].size;
+    if(!same)
+    { printer->mismatches++;
+      if(t != NULL)
+        printf("  <- log: energy %u %u cash %u %u hand %u %u", t->energy[PLAYER_A],
+               t->energy[PLAYER_B], t->cash[PLAYER_A], t->cash[PLAYER_B],
+               t->hand_size[PLAYER_A], t->hand_size[PLAYER_B]);
+      else
+        printf("  <- not in the log");
+    }
+  }
+  printf("\n");
+} // print_turn
+
+int run_mode_stda_replay(config_t* cfg)
+{ uint32_t job;
+  uint64_t game;
+  if(!parse_replay_arg(cfg->replay, &job, &game))
+  { fprintf(stderr, "Error: invalid --replay '%s': expected JOB:GAME\n", cfg->replay);
+    return EXIT_FAILURE;
+  }
+
+  MatchLogReader reader;
+  const MatchLogGame* record = NULL;
+  const MatchLogTurn* logged_turns = NULL;
+  const uint8_t* actions = NULL;
+  if(cfg->match_log_read)
+  { if(cfg->tournament || cfg->paired || cfg->sprt || job != 0)
+    { fprintf(stderr, "Error: match logs hold -P matches (job 0), not tournaments\n");
+      return EXIT_FAILURE;
+    }
+    if(!match_log_open(cfg->match_log_read, &reader))
+      return EXIT_FAILURE;
+    if(!(reader.header->flags & MATCH_LOG_REPLAYABLE))
+    { fprintf(stderr, "Error: %s was not written with --replayable\n", cfg->match_log_read);
+      match_log_reader_close(&reader);
+      return EXIT_FAILURE;
+    }
+    record = match_log_find_game(&reader, game, &logged_turns, &actions);
+    if(record == NULL)
+    { fprintf(stderr, "Error: game %" PRIu64 " is not in %s\n", game, cfg->match_log_read);
+      match_log_reader_close(&reader);
+      return EXIT_FAILURE;
+    }
+    if(record->action_bytes == 0)
+      actions = NULL;
+
+    // The log knows how its games were seeded; without actions the agents
+    // must be the logged ones
+    cfg->prng_seed = reader.header->master_seed;
+    cfg->prng_backend = (RndBackend)reader.header->rng_backend;
+    cfg->lazy_deck = (reader.header->flags & MATCH_LOG_LAZY_DECK) != 0;
+    char names[2][BT_NAME_LEN];
+    match_agent_names(cfg, names);
+    if(actions == NULL && (strcmp(names[PLAYER_A], reader.header->agents[record->agent[PLAYER_A]]) ||
+                           strcmp(names[PLAYER_B], reader.header->agents[record->agent[PLAYER_B]])))
+    { fprintf(stderr, "Error: the log has no actions for game %" PRIu64 "; replay it with its "
+              "agents, %s and %s (-P)\n", game, reader.header->agents[record->agent[PLAYER_A]],
+              reader.header->agents[record->agent[PLAYER_B]]);
+      match_log_reader_close(&reader);
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Timed pass, then the printing pass (which must come out the same)
+  ReplayResult timed, shown;
+  ReplayPrinter printer = { .logged = logged_turns, .logged_turns = record ? record->turns : 0,
+                            .mismatches = 0 };
+  uint32_t action_bytes = record ? record->action_bytes : 0;
+  int ret = EXIT_FAILURE;
+  if(replay_game(cfg, job, game, actions, action_bytes, NULL, NULL, &timed))
+  { if(record != NULL)
+      for(PlayerID p = PLAYER_A; p <= PLAYER_B; p++)
+        snprintf(timed.agents[p], BT_NAME_LEN, "%s", reader.header->agents[record->agent[p]]);
+    printf("Game %" PRIu64 " of job %u (seed %u): %s (A) vs %s (B), %s\n\n",
+           game, job, cfg->prng_seed, timed.agents[PLAYER_A], timed.agents[PLAYER_B],
+           actions ? "moves from the action log" : "moves from the agents");
+    printf("Turn  attack                          defense                 after the turn\n");
+    replay_game(cfg, job, game, actions, action_bytes, print_turn, &printer, &shown);
+
+    printf("\n%s after %u turns: energy %u-%u, cash %u-%u\n", GAME_STATE_NAMES[timed.result],
+           timed.turns, timed.energy[PLAYER_A], timed.energy[PLAYER_B],
+           timed.cash[PLAYER_A], timed.cash[PLAYER_B]);
+    printf("Rebuilt in %.1f us\n", timed.elapsed_us);
+
+    bool same = shown.result == timed.result && shown.turns == timed.turns &&
+                timed.trace_ok && printer.mismatches == 0;
+    if(record != NULL)
+      same &= record->result == timed.result && record->turns == timed.turns &&
+              record->energy[PLAYER_A] == timed.energy[PLAYER_A] &&
+              record->energy[PLAYER_B] == timed.energy[PLAYER_B] &&
+              record->cash[PLAYER_A] == timed.cash[PLAYER_A] &&
+              record->cash[PLAYER_B] == timed.cash[PLAYER_B];
+    if(!timed.trace_ok)
+      printf("The action log does not fit this game (different seed, backend or engine?)\n");
+    if(record != NULL)
+      printf("%s the match log\n", same ? "Matches" : "Differs from");
+    ret = same ? EXIT_SUCCESS : EXIT_FAILURE;
+  }
+
+  if(cfg->match_log_read)
+    match_log_reader_close(&reader);
+  return ret;
+} // run_mode_stda_replay
@@ -0,0 +1,55 @@
+// stda_replay.h
+// --replay=JOB:GAME: rebuild one game of an stda.auto run on its own, turn by
+// turn through play_turn(). The game is seeded by its index alone (games of
+// --replayable matches and of tournaments are), so none of the games before
+// it is played; its moves come from the match log's action trace when there
+// is one, or else from the agents, rerun on their own streams.
+
+#ifndef STDA_REPLAY_H
+#define STDA_REPLAY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "../../core/game_types.h"
+#include "../../rating/bt_rating.h"
+
+// One turn as replayed
+typedef struct
+{ const struct gamestate* gstate;  // after the turn
+  PlayerID attacker;
+  const uint8_t* actions;          // the turn's phases, action trace format
+  uint32_t action_bytes;
+} ReplayTurn;
+
+typedef void (*ReplayTurnFunc)(const ReplayTurn* turn, void* arg);
+
+typedef struct
+{ char agents[2][BT_NAME_LEN];  // seat A and seat B
+  GameStateEnum result;
+  uint16_t turns;
+  uint8_t energy[2];            // final
+  uint16_t cash[2];
+  bool trace_ok;                // replaying actions: every logged action fit, and all were used
+  double elapsed_us;            // rebuilding, callbacks excluded
+} ReplayResult;
+
+// "JOB:GAME", both non-negative integers
+bool parse_replay_arg(const char* arg, uint32_t* job, uint64_t* game);
+
+// Rebuild game `game` of job `job` of the run the cfg options describe: job 0
+// is the -P match (played with --replayable), the jobs of --tournament or
+// --paired are numbered as in TournamentResult.jobs (paired: game 2d + s is
+// deal d, seats swapped when s = 1). With actions (action_bytes of them), the
+// moves are applied from the trace instead of asking the agents. on_turn, if
+// not NULL, is called after every turn. Returns false with the reason on
+// stderr if there is no such game.
+bool replay_game(config_t* cfg, uint32_t job, uint64_t game, const uint8_t* actions,
+                 uint32_t action_bytes, ReplayTurnFunc on_turn, void* arg, ReplayResult* out);
+
+// stda.auto entry point with --replay: with a match log (-Y) the seed, PRNG
+// backend and actions come from the log, and every turn is checked against
+// the logged summaries
+int run_mode_stda_replay(config_t* cfg);
+
+#endif // STDA_REPLAY_H
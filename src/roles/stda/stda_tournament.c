@@ -0,0 +1,663 @@
+// stda_tournament.c
+// Round-robin tournaments between AI agents: batch scheduling on a worker
+// pool, paired (common random numbers) deals, SPRT early stopping, result
+// matrices and Bradley-Terry ratings
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <time.h>
+
+#include "stda_tournament.h"
+#include "stda_auto.h"
+#include "../../core/game_constants.h"
+#include "../../core/game_context.h"
+#include "../../ai_strat/ai_strategy.h"
+#include "../../util/prng_seed.h"
+
+// A finished batch waiting for the batches before it
+typedef struct
+{ bool done;
+  TournamentJob counts;
+} TournamentBatch;
+
+// Shared by all workers: the next batch to claim, and the commit point.
+// Batches finish out of order but are folded into the result in batch order,
+// so the result (and an SPRT stop) only depends on the batches before the
+// commit point, never on which worker was faster.
+typedef struct
+{ const TournamentSpec* spec;
+  uint32_t num_jobs;
+  uint64_t batch_games;
+  uint64_t batches_per_job;
+  uint64_t total_batches;
+  _Atomic uint64_t next_batch;
+  _Atomic bool stop;             // SPRT decided: claim nothing more
+  pthread_mutex_t lock;          // guards everything below
+  pthread_cond_t advanced;       // the commit point moved
+  uint64_t committed;            // batches [0, committed) are in the result
+  TournamentBatch window[TOURNAMENT_COMMIT_WINDOW];
+  TournamentResult* result;
+} TournamentQueue;
+
+// One worker: its own GameContext, plus one per agent
+typedef struct
+{ pthread_t thread;
+  TournamentQueue* queue;
+  GameContext* ctx;
+  GameContext* agent_ctx[2];
+} TournamentWorker;
+
+bool parse_tournament_agents(const char* list, TournamentSpec* spec)
+{ char buf[256];
+  if(list == NULL || strlen(list) >= sizeof(buf))
+  { fprintf(stderr, "Error: tournament agent list missing or too long\n");
+    return false;
+  }
+  snprintf(buf, sizeof(buf), "%s", list);
+
+  spec->num_agents = 0;
+  char* saveptr = NULL;
+  for(char* name = strtok_r(buf, ",", &saveptr); name != NULL;
+      name = strtok_r(NULL, ",", &saveptr))
+  { AIStrategyType type = parse_ai_strategy_shorthand(name);
+    if(type == AI_STRATEGY_COUNT)
+    { fprintf(stderr, "Error: unknown AI agent '%s'\n", name);
+      return false;
+    }
+
+    StrategySet probe;
+    if(!set_player_strategy_by_type(&probe, PLAYER_A, type))
+    { fprintf(stderr, "Error: AI agent '%s' is not implemented yet\n", name);
+      return false;
+    }
+
+    for(uint32_t i = 0; i < spec->num_agents; i++)
+      if(spec->agents[i] == type)
+      { fprintf(stderr, "Error: AI agent '%s' is listed twice\n", name);
+        return false;
+      }
+
+    if(spec->num_agents == MAX_TOURNAMENT_AGENTS)
+    { fprintf(stderr, "Error: at most %d agents per tournament\n", MAX_TOURNAMENT_AGENTS);
+      return false;
+    }
+    spec->agents[spec->num_agents] = type;
+    snprintf(spec->names[spec->num_agents], BT_NAME_LEN, "%s", name);
+    spec->num_agents++;
+  }
+
+  if(spec->num_agents < 2)
+  { fprintf(stderr, "Error: a tournament needs at least 2 agents\n");
+    return false;
+  }
+  return true;
+} // parse_tournament_agents
+
+// Jobs in a fixed order: for each agent a, a in seat A against every other b
+// (paired: every b after a)
+static uint32_t build_jobs(uint32_t num_agents, bool paired, TournamentJob* jobs)
+{ uint32_t k = 0;
+  for(uint32_t a = 0; a < num_agents; a++)
+    for(uint32_t b = paired ? a + 1 : 0; b < num_agents; b++)
+      if(a != b)
+      { memset(&jobs[k], 0, sizeof(TournamentJob));
+        jobs[k].agent[PLAYER_A] = (uint8_t)a;
+        jobs[k].agent[PLAYER_B] = (uint8_t)b;
+        k++;
+      }
+  return k;
+}
+
+// One game of a job, with agent[first] in seat A; returns the game's result
+static GameStateEnum play_job_game(GameContext* ctx, StrategySet* strategies,
+                                   TournamentJob* job, uint8_t first)
+{ struct gamestats gstats;
+  memset(&gstats, 0, sizeof(gstats));
+  play_stda_auto_game(INITIAL_CASH_DEFAULT, &gstats, strategies, ctx);
+
+  GameStateEnum outcome = gstats.cumul_number_of_draws ? DRAW :
+                          gstats.cumul_player_wins[PLAYER_A] ? PLAYER_A_WINS : PLAYER_B_WINS;
+  job->games++;
+  job->turn_sum += gstats.turn_max;
+  job->turn_sq_sum += (uint64_t)gstats.turn_max * gstats.turn_max;
+  if(outcome == DRAW)
+    job->draws++;
+  else
+  { PlayerID seat = (outcome == PLAYER_A_WINS) ? PLAYER_A : PLAYER_B;
+    job->seat_wins[seat]++;
+    job->agent_wins[seat ^ first]++;
+  }
+  return outcome;
+} // play_job_game
+
+// Seat and seed game `game` of job k.
+// Paired: game 2d + s is deal d, seats swapped when s = 1, seeded by the deal
+// alone (streams 0-2), so every pairing and both seatings get the same deals.
+// Unpaired: seeded by (job, game), streams 3(k + 1) to 3(k + 1) + 2.
+static void seat_job_game(const TournamentSpec* spec, uint32_t seed, const TournamentJob* job,
+                          uint32_t k, uint64_t game, GameContext* ctx,
+                          GameContext* const agent_ctx[2], StrategySet* strategies)
+{ uint8_t first = spec->paired ? (uint8_t)(game & 1) : 0;
+  for(PlayerID seat = PLAYER_A; seat <= PLAYER_B; seat++)
+  { uint8_t slot = seat ^ first;
+    set_player_strategy_by_type(strategies, seat, spec->agents[job->agent[slot]]);
+    ctx->agent_ctx[seat] = agent_ctx[slot];
+  }
+  if(spec->paired)
+    seed_stda_auto_game(ctx, seed, game >> 1, 0, first);
+  else
+    seed_stda_auto_game(ctx, seed, game, GAME_STREAM_COUNT * (k + 1), 0);
+} // seat_job_game
+
+// Deal d of a paired job: the same chance stream and agent streams for both
+// games, agent[0] in seat A first and in seat B second
+static void play_paired_deal(TournamentWorker* w, TournamentJob* job, uint32_t k, uint64_t d)
+{ uint32_t seed = w->ctx->config->prng_seed;
+  uint32_t half_points = 0;   // agent[0]'s
+
+  for(uint8_t first = 0; first < 2; first++)
+  { StrategySet strategies;
+    seat_job_game(w->queue->spec, seed, job, k, 2 * d + first, w->ctx, w->agent_ctx, &strategies);
+
+    GameStateEnum outcome = play_job_game(w->ctx, &strategies, job, first);
+    if(outcome == DRAW)
+      half_points += 1;
+    else if(((outcome == PLAYER_A_WINS) ? PLAYER_A : PLAYER_B) == first)
+      half_points += 2;
+  }
+
+  job->deals++;
+  job->deal_sum += half_points;
+  job->deal_sq_sum += half_points * half_points;
+} // play_paired_deal
+
+// Batch b is round b / num_jobs of job b % num_jobs: every job gets its first
+// batch before any job gets its second. Counts go to job (a zeroed copy of the
+// job's header); the batch is abandoned if the SPRT stops the run meanwhile.
+static void play_batch(TournamentWorker* w, uint64_t b, TournamentJob* job)
+{ TournamentQueue* q = w->queue;
+  const TournamentSpec* spec = q->spec;
+  uint32_t k = (uint32_t)(b % q->num_jobs);
+  uint64_t first = (b / q->num_jobs) * q->batch_games;
+  uint64_t count = oraclemin(q->batch_games, spec->games_per_job - first);
+
+  if(spec->paired)
+  { for(uint64_t d = first; d < first + count && !atomic_load(&q->stop); d++)
+      play_paired_deal(w, job, k, d);
+    return;
+  }
+
+  for(uint64_t g = first; g < first + count && !atomic_load(&q->stop); g++)
+  { StrategySet strategies;
+    seat_job_game(spec, w->ctx->config->prng_seed, job, k, g, w->ctx, w->agent_ctx, &strategies);
+    play_job_game(w->ctx, &strategies, job, PLAYER_A);
+  }
+} // play_batch
+
+bool tournament_seat_game(const TournamentSpec* spec, uint32_t seed, uint32_t k, uint64_t game,
+                          GameContext* ctx, GameContext* const agent_ctx[2],
+                          StrategySet* strategies, uint8_t seat_agent[2])
+{ TournamentJob jobs[MAX_TOURNAMENT_AGENTS * (MAX_TOURNAMENT_AGENTS - 1)];
+  uint32_t num_jobs = build_jobs(spec->num_agents, spec->paired, jobs);
+  if(k >= num_jobs || game >= spec->games_per_job * (spec->paired ? 2 : 1)) return false;
+
+  seat_job_game(spec, seed, &jobs[k], k, game, ctx, agent_ctx, strategies);
+  uint8_t first = spec->paired ? (uint8_t)(game & 1) : 0;
+  seat_agent[PLAYER_A] = jobs[k].agent[first];
+  seat_agent[PLAYER_B] = jobs[k].agent[1 - first];
+  return true;
+} // tournament_seat_game
+
+static void add_job_counts(TournamentJob* dst, const TournamentJob* src)
+{ dst->games += src->games;
+  dst->seat_wins[PLAYER_A] += src->seat_wins[PLAYER_A];
+  dst->seat_wins[PLAYER_B] += src->seat_wins[PLAYER_B];
+  dst->agent_wins[0] += src->agent_wins[0];
+  dst->agent_wins[1] += src->agent_wins[1];
+  dst->draws += src->draws;
+  dst->turn_sum += src->turn_sum;
+  dst->turn_sq_sum += src->turn_sq_sum;
+  dst->deals += src->deals;
+  dst->deal_sum += src->deal_sum;
+  dst->deal_sq_sum += src->deal_sq_sum;
+}
+
+// Keep at most TOURNAMENT_TRAJECTORY_POINTS points, evenly spaced in batches:
+// when full, drop every other point and record half as often
+static void compact_trajectory(TournamentResult* result)
+{ for(uint32_t i = 1; i < TOURNAMENT_TRAJECTORY_POINTS; i += 2)
+    result->trajectory[i / 2] = result->trajectory[i];
+  result->num_trajectory = TOURNAMENT_TRAJECTORY_POINTS / 2;
+  result->trajectory_stride *= 2;
+}
+
+static void record_llr(TournamentResult* result, uint64_t batches, double llr)
+{ if(batches % result->trajectory_stride != 0) return;
+  if(result->num_trajectory == TOURNAMENT_TRAJECTORY_POINTS)
+  { compact_trajectory(result);
+    if(batches % result->trajectory_stride != 0) return;
+  }
+  result->trajectory[result->num_trajectory++] =
+    (TournamentLLRPoint){ .games = result->games, .llr = llr };
+}
+
+// Log-likelihood ratio of a two-agent run so far, on agent 0's scores: one
+// sample per game, or per deal (its mean score) in paired mode
+static double tournament_llr(const TournamentSpec* spec, const TournamentResult* result)
+{ if(spec->paired)
+  { const TournamentJob* job = &result->jobs[0];
+    return sprt_llr(&spec->sprt, job->deals, (double)job->deal_sum / 4.0,
+                    (double)job->deal_sq_sum / 16.0);
+  }
+
+  uint64_t wins = 0, draws = 0, games = 0;
+  for(uint32_t k = 0; k < result->num_jobs; k++)
+  { const TournamentJob* job = &result->jobs[k];
+    wins += job->agent_wins[job->agent[0] == 0 ? 0 : 1];
+    draws += job->draws;
+    games += job->games;
+  }
+  return sprt_llr(&spec->sprt, games, (double)wins + 0.5 * (double)draws,
+                  (double)wins + 0.25 * (double)draws);
+} // tournament_llr
+
+// Store batch k, then fold every finished batch at the commit point into the
+// result, checking the SPRT after each
+static void commit_batch(TournamentQueue* q, uint64_t k, const TournamentJob* counts)
+{ TournamentResult* result = q->result;
+
+  pthread_mutex_lock(&q->lock);
+  TournamentBatch* slot = &q->window[k % TOURNAMENT_COMMIT_WINDOW];
+  slot->counts = *counts;
+  slot->done = true;
+
+  while(!atomic_load(&q->stop))
+  { slot = &q->window[q->committed % TOURNAMENT_COMMIT_WINDOW];
+    if(!slot->done) break;
+
+    add_job_counts(&result->jobs[q->committed % q->num_jobs], &slot->counts);
+    result->games += slot->counts.games;
+    slot->done = false;
+    q->committed++;
+
+    if(q->spec->use_sprt)
+    { result->llr = tournament_llr(q->spec, result);
+      record_llr(result, q->committed, result->llr);
+      result->sprt_decision = sprt_decide(&q->spec->sprt, result->llr);
+      if(result->sprt_decision != SPRT_CONTINUE)
+        atomic_store(&q->stop, true);
+    }
+  }
+
+  pthread_cond_broadcast(&q->advanced);
+  pthread_mutex_unlock(&q->lock);
+} // commit_batch
+
+static void* tournament_worker_main(void* arg)
+{ TournamentWorker* w = (TournamentWorker*)arg;
+  TournamentQueue* q = w->queue;
+
+  while(!atomic_load(&q->stop))
+  { uint64_t k = atomic_fetch_add_explicit(&q->next_batch, 1, memory_order_relaxed);
+    if(k >= q->total_batches) break;
+
+    // Stay within the commit window (the oldest unfinished batch is always
+    // being played, so this cannot wait forever)
+    pthread_mutex_lock(&q->lock);
+    while(!atomic_load(&q->stop) && k >= q->committed + TOURNAMENT_COMMIT_WINDOW)
+      pthread_cond_wait(&q->advanced, &q->lock);
+    pthread_mutex_unlock(&q->lock);
+    if(atomic_load(&q->stop)) break;
+
+    TournamentJob counts;
+    memset(&counts, 0, sizeof(counts));
+    memcpy(counts.agent, q->result->jobs[k % q->num_jobs].agent, sizeof(counts.agent));
+    play_batch(w, k, &counts);
+    commit_batch(q, k, &counts);
+  }
+  return NULL;
+} // tournament_worker_main
+
+bool run_tournament(const TournamentSpec* spec, config_t* cfg, TournamentResult* result)
+{ if(spec->use_sprt && spec->num_agents != 2)
+  { fprintf(stderr, "Error: the SPRT compares exactly 2 agents\n");
+    return false;
+  }
+
+  memset(result, 0, sizeof(TournamentResult));
+  result->num_agents = spec->num_agents;
+  result->paired = spec->paired;
+  result->num_jobs = build_jobs(spec->num_agents, spec->paired, result->jobs);
+  result->trajectory_stride = 1;
+
+  TournamentQueue* queue = (TournamentQueue*)calloc(1, sizeof(TournamentQueue));
+  uint64_t batch_games = spec->batch_games ? spec->batch_games : TOURNAMENT_BATCH_GAMES;
+  uint64_t total_batches = (spec->games_per_job + batch_games - 1) / batch_games * result->num_jobs;
+  uint16_t num_threads = (uint16_t)oraclemax((uint64_t)1, oraclemin((uint64_t)spec->num_threads,
+                                                                     total_batches));
+  TournamentWorker* workers = (TournamentWorker*)calloc(num_threads, sizeof(TournamentWorker));
+  if(queue == NULL || workers == NULL)
+  { fprintf(stderr, "Failed to allocate tournament workers\n");
+    free(queue);
+    free(workers);
+    return false;
+  }
+
+  queue->spec = spec;
+  queue->num_jobs = result->num_jobs;
+  queue->batch_games = batch_games;
+  queue->batches_per_job = total_batches / result->num_jobs;
+  queue->total_batches = total_batches;
+  queue->result = result;
+  atomic_init(&queue->next_batch, 0);
+  atomic_init(&queue->stop, false);
+  pthread_mutex_init(&queue->lock, NULL);
+  pthread_cond_init(&queue->advanced, NULL);
+  result->planned_games = spec->games_per_job * result->num_jobs * (spec->paired ? 2 : 1);
+
+  bool ok = true;
+  uint16_t t;
+  for(t = 0; t < num_threads; t++)
+  { workers[t].queue = queue;
+    workers[t].ctx = create_game_context(cfg);
+    workers[t].agent_ctx[0] = create_game_context(cfg);
+    workers[t].agent_ctx[1] = create_game_context(cfg);
+    if(workers[t].ctx == NULL || workers[t].agent_ctx[0] == NULL || workers[t].agent_ctx[1] == NULL)
+    { fprintf(stderr, "Failed to create game context for worker %u\n", t);
+      ok = false;
+      break;
+    }
+  }
+
+  if(ok)
+  { struct timespec start, end;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    // Worker 0 runs on the calling thread; a worker whose thread cannot be
+    // started leaves its share of the queue to the others
+    bool started[num_threads];
+    for(t = 1; t < num_threads; t++)
+      started[t] = pthread_create(&workers[t].thread, NULL,
+                                  tournament_worker_main, &workers[t]) == 0;
+    tournament_worker_main(&workers[0]);
+    for(t = 1; t < num_threads; t++)
+      if(started[t])
+        pthread_join(workers[t].thread, NULL);
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    result->elapsed_ms = (end.tv_sec - start.tv_sec) * 1e3 +
+                         (end.tv_nsec - start.tv_nsec) / 1e6;
+
+    for(uint32_t k = 0; k < result->num_jobs; k++)
+    { const TournamentJob* job = &result->jobs[k];
+      uint8_t a = job->agent[0], b = job->agent[1];
+      result->wins[a][b] += job->agent_wins[0];
+      result->wins[b][a] += job->agent_wins[1];
+      result->draws[a][b] += job->draws;
+      result->draws[b][a] += job->draws;
+    }
+    if(spec->use_sprt && result->num_trajectory > 0 &&
+       result->trajectory[result->num_trajectory - 1].games != result->games)
+    { // The last point, off the stride
+      if(result->num_trajectory == TOURNAMENT_TRAJECTORY_POINTS)
+        compact_trajectory(result);
+      result->trajectory[result->num_trajectory++] =
+        (TournamentLLRPoint){ .games = result->games, .llr = result->llr };
+    }
+  }
+
+  for(t = 0; t < num_threads; t++)
+  { destroy_game_context(workers[t].ctx);
+    destroy_game_context(workers[t].agent_ctx[0]);
+    destroy_game_context(workers[t].agent_ctx[1]);
+  }
+  free(workers);
+  pthread_mutex_destroy(&queue->lock);
+  pthread_cond_destroy(&queue->advanced);
+  free(queue);
+
+  return ok;
+} // run_tournament
+
+bool tournament_add_to_rating(const TournamentSpec* spec, const TournamentResult* result,
+                              BTModel* model)
+{ int player[MAX_TOURNAMENT_AGENTS];
+  for(uint32_t i = 0; i < spec->num_agents; i++)
+  { player[i] = bt_find_player(model, spec->names[i]);
+    if(player[i] < 0)
+      player[i] = bt_add_player(model, spec->names[i]);
+    if(player[i] < 0) return false;
+  }
+
+  for(uint32_t i = 0; i < spec->num_agents; i++)
+    for(uint32_t j = i + 1; j < spec->num_agents; j++)
+      if(result->wins[i][j] + result->wins[j][i] + result->draws[i][j] > 0 &&
+         !bt_add_games(model, (uint32_t)player[i], (uint32_t)player[j],
+                       result->wins[i][j], result->wins[j][i], result->draws[i][j]))
+        return false;
+  return true;
+} // tournament_add_to_rating
+
+bool tournament_paired_estimate(const TournamentJob* job, TournamentPairedEstimate* out)
+{ if(job->deals < 2) return false;
+
+  double games = (double)job->games;
+  double deals = (double)job->deals;
+  double score = ((double)job->agent_wins[0] + 0.5 * (double)job->draws) / games;
+
+  // Per deal: agent[0]'s mean score over its two games, deal_sum / 4 in total
+  double deal_var = ((double)job->deal_sq_sum / 16.0 - deals * score * score) / (deals - 1);
+  // Per game: score x in {0, 1/2, 1}, so the sum of x^2 is wins + draws / 4
+  double game_var = ((double)job->agent_wins[0] + 0.25 * (double)job->draws -
+                     games * score * score) / (games - 1);
+
+  out->score = score;
+  out->difference = 2.0 * score - 1.0;
+  out->paired_stderr = 2.0 * sqrt(fmax(deal_var, 0.0) / deals);
+  out->unpaired_stderr = 2.0 * sqrt(fmax(game_var, 0.0) / games);
+  if(score > 0.0 && score < 1.0)
+  { out->elo = 400.0 * log10(score / (1.0 - score));
+    out->elo_stderr = 400.0 / log(10.0) / (score * (1.0 - score)) * 0.5 * out->paired_stderr;
+  }
+  else
+  { out->elo = (score > 0.5) ? INFINITY : -INFINITY;
+    out->elo_stderr = INFINITY;
+  }
+  return true;
+} // tournament_paired_estimate
+
+// About 20 rows of the LLR trajectory between the bounds, then the decision
+static void present_sprt(const TournamentSpec* spec, const TournamentResult* result, FILE* out)
+{ static const char* decisions[] = {"no decision (game limit reached)", "H0 accepted", "H1 accepted"};
+  double lower = sprt_lower_bound(&spec->sprt), upper = sprt_upper_bound(&spec->sprt);
+
+  fprintf(out, "\nSPRT %s vs %s, H0: Elo %+.1f, H1: Elo %+.1f, alpha %.3f, beta %.3f\n",
+          spec->names[0], spec->names[1], spec->sprt.elo0, spec->sprt.elo1,
+          spec->sprt.alpha, spec->sprt.beta);
+  fprintf(out, "LLR bounds [%.3f, %.3f]\n%10s %9s\n", lower, upper, "games", "LLR");
+  uint32_t step = (result->num_trajectory + 19) / 20;
+  for(uint32_t i = 0; i < result->num_trajectory; i++)
+  { if(i % step != 0 && i + 1 != result->num_trajectory) continue;
+    const TournamentLLRPoint* pt = &result->trajectory[i];
+    // Position between the bounds, 0 to 40 characters
+    int pos = (int)lround(40.0 * (fmin(fmax(pt->llr, lower), upper) - lower) / (upper - lower));
+    fprintf(out, "%10" PRIu64 " %+9.3f |%*s*%*s|\n", pt->games, pt->llr, pos, "", 40 - pos, "");
+  }
+
+  uint64_t saved = result->planned_games - result->games;
+  fprintf(out, "%s after %" PRIu64 " of at most %" PRIu64 " games: %" PRIu64 " games (%.1f%%) saved\n",
+          decisions[result->sprt_decision], result->games, result->planned_games, saved,
+          result->planned_games ? 100.0 * (double)saved / (double)result->planned_games : 0.0);
+} // present_sprt
+
+void present_tournament(const TournamentSpec* spec, const TournamentResult* result,
+                        FILE* out)
+{ uint32_t n = spec->num_agents;
+
+  fprintf(out, "Score (%%) of each row agent against each column agent, both seats:\n%-12s", "");
+  for(uint32_t j = 0; j < n; j++)
+    fprintf(out, " %10.10s", spec->names[j]);
+  fprintf(out, " %10s\n", "overall");
+  for(uint32_t i = 0; i < n; i++)
+  { fprintf(out, "%-12.12s", spec->names[i]);
+    uint64_t half_points = 0, games = 0;
+    for(uint32_t j = 0; j < n; j++)
+    { uint64_t played = result->wins[i][j] + result->wins[j][i] + result->draws[i][j];
+      if(i == j || played == 0)
+      { fprintf(out, " %10s", "-");
+        continue;
+      }
+      uint64_t hp = 2 * result->wins[i][j] + result->draws[i][j];
+      fprintf(out, " %10.1f", 50.0 * (double)hp / (double)played);
+      half_points += hp;
+      games += played;
+    }
+    fprintf(out, " %10.1f\n", games ? 50.0 * (double)half_points / (double)games : 0.0);
+  }
+
+  fprintf(out, "\nWins-draws-losses of each row agent:\n%-12s", "");
+  for(uint32_t j = 0; j < n; j++)
+    fprintf(out, " %16.16s", spec->names[j]);
+  fprintf(out, "\n");
+  for(uint32_t i = 0; i < n; i++)
+  { fprintf(out, "%-12.12s", spec->names[i]);
+    for(uint32_t j = 0; j < n; j++)
+    { char cell[64];
+      if(i == j)
+        snprintf(cell, sizeof(cell), "-");
+      else
+        snprintf(cell, sizeof(cell), "%" PRIu64 "-%" PRIu64 "-%" PRIu64,
+                 result->wins[i][j], result->draws[i][j], result->wins[j][i]);
+      fprintf(out, " %16s", cell);
+    }
+    fprintf(out, "\n");
+  }
+
+  uint64_t seat_wins[2] = {0, 0}, draws = 0, turn_sum = 0, turn_sq_sum = 0;
+  for(uint32_t k = 0; k < result->num_jobs; k++)
+  { seat_wins[PLAYER_A] += result->jobs[k].seat_wins[PLAYER_A];
+    seat_wins[PLAYER_B] += result->jobs[k].seat_wins[PLAYER_B];
+    draws += result->jobs[k].draws;
+    turn_sum += result->jobs[k].turn_sum;
+    turn_sq_sum += result->jobs[k].turn_sq_sum;
+  }
+  double games = (double)result->games;
+  double mean = games > 0 ? (double)turn_sum / games : 0.0;
+  double var = games > 1 ? ((double)turn_sq_sum - games * mean * mean) / (games - 1) : 0.0;
+  fprintf(out, "\nSeat A won %" PRIu64 ", seat B won %" PRIu64 ", %" PRIu64 " draws\n",
+          seat_wins[PLAYER_A], seat_wins[PLAYER_B], draws);
+  fprintf(out, "Average = %.1f, standard deviation = %.2f number of turns per game\n",
+          mean, sqrt(fmax(var, 0.0)));
+
+  if(spec->use_sprt)
+    present_sprt(spec, result, out);
+
+  if(!result->paired) return;
+  fprintf(out, "\nPaired deals (each played in both seatings), score difference of the first agent:\n");
+  for(uint32_t k = 0; k < result->num_jobs; k++)
+  { const TournamentJob* job = &result->jobs[k];
+    TournamentPairedEstimate est;
+    if(!tournament_paired_estimate(job, &est)) continue;
+    double saved = est.paired_stderr > 0.0 ?
+                   (est.unpaired_stderr * est.unpaired_stderr) / (est.paired_stderr * est.paired_stderr) : 0.0;
+    fprintf(out, "  %s vs %s: %+.2f%% +/- %.2f (unpaired +/- %.2f, %.1fx fewer games), "
+            "Elo %+.1f +/- %.1f over %" PRIu64 " deals\n",
+            spec->names[job->agent[0]], spec->names[job->agent[1]],
+            100.0 * est.difference, 100.0 * est.paired_stderr, 100.0 * est.unpaired_stderr,
+            saved, est.elo, est.elo_stderr, job->deals);
+  }
+} // present_tournament
+
+bool tournament_spec_from_config(const config_t* cfg, TournamentSpec* spec)
+{ memset(spec, 0, sizeof(TournamentSpec));
+  if(cfg->tournament)
+  { if(!parse_tournament_agents(cfg->tournament, spec))
+      return false;
+  }
+  else
+  { // The -P match; a mirror match gets a second name so the rating can tell them apart
+    StrategySet probe;
+    for(PlayerID p = PLAYER_A; p <= PLAYER_B; p++)
+    { spec->agents[p] = (AIStrategyType)cfg->ai_players[p];
+      if(!set_player_strategy_by_type(&probe, p, spec->agents[p]))
+      { fprintf(stderr, "Error: AI agent '%s' is not implemented yet\n",
+                get_strategy_display_name(spec->agents[p], cfg->language));
+        return false;
+      }
+      snprintf(spec->names[p], BT_NAME_LEN, "%s%s",
+               get_strategy_display_name(spec->agents[p], cfg->language),
+               (p == PLAYER_B && spec->agents[PLAYER_A] == spec->agents[PLAYER_B]) ? " #2" : "");
+    }
+    spec->num_agents = 2;
+  }
+  spec->games_per_job = (cfg->numsim > 0) ? cfg->numsim : DEFAULT_NUMBER_OF_SIM;
+  spec->num_threads = (cfg->num_threads > 1) ? (uint16_t)cfg->num_threads : 1;
+  spec->paired = cfg->paired;
+  if(cfg->sprt)
+  { if(spec->num_agents != 2)
+    { fprintf(stderr, "Error: --sprt compares exactly 2 agents\n");
+      return false;
+    }
+    spec->use_sprt = parse_sprt_arg(cfg->sprt, &spec->sprt);
+  }
+  return true;
+} // tournament_spec_from_config
+
+int run_mode_stda_tournament(config_t* cfg)
+{ TournamentSpec spec;
+  if(cfg->match_log)
+  { fprintf(stderr, "Error: --matchlog logs single matches, not --tournament, --paired or --sprt\n");
+    return EXIT_FAILURE;
+  }
+  if(!tournament_spec_from_config(cfg, &spec))
+    return EXIT_FAILURE;
+
+  TournamentResult* result = (TournamentResult*)malloc(sizeof(TournamentResult));
+  if(result == NULL)
+  { fprintf(stderr, "Failed to allocate tournament results\n");
+    return EXIT_FAILURE;
+  }
+
+  uint32_t num_jobs = spec.num_agents * (spec.num_agents - 1);
+  if(spec.paired)
+    printf("Round robin: %u agents, %u pairings, %" PRIu64 " paired deals each (two games per deal)\n",
+           spec.num_agents, num_jobs / 2, spec.games_per_job);
+  else
+    printf("Round robin: %u agents, %u pairings x seat orders, %" PRIu64 " games each\n",
+           spec.num_agents, num_jobs, spec.games_per_job);
+  if(!run_tournament(&spec, cfg, result))
+  { free(result);
+    return EXIT_FAILURE;
+  }
+  if(cfg->verbose)
+    printf("%" PRIu64 " games on %u threads in %.1f ms (%.0f games/s)\n",
+           result->games, spec.num_threads, result->elapsed_ms,
+           result->elapsed_ms > 0 ? 1e3 * (double)result->games / result->elapsed_ms : 0.0);
+  printf("\n");
+  present_tournament(&spec, result, stdout);
+
+  int ret = EXIT_SUCCESS;
+  BTModel* model = bt_create();
+  BTInterval intervals[MAX_TOURNAMENT_AGENTS];
+  if(model == NULL || !tournament_add_to_rating(&spec, result, model) ||
+     bt_fit(model, BT_FIT_NEWTON, BT_DEFAULT_TOLERANCE, BT_DEFAULT_MAX_ITERATIONS) < 0)
+  { fprintf(stderr, "Failed to rate the tournament\n");
+    ret = EXIT_FAILURE;
+  }
+  else
+  { bool have_intervals = bt_bootstrap(model, TOURNAMENT_BOOTSTRAP_REPLICATES, spec.num_threads,
+                                       cfg->prng_seed, 0.95, intervals);
+    printf("\nBradley-Terry ratings (Elo, %s = 0%s):\n", spec.names[0],
+           have_intervals ? ", 95% bootstrap intervals" : "");
+    bt_print(model, have_intervals ? intervals : NULL, stdout);
+  }
+
+  bt_destroy(model);
+  free(result);
+  return ret;
+} // run_mode_stda_tournament
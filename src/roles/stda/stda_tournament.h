@@ -0,0 +1,148 @@
+// stda_tournament.h
+// Round-robin tournaments between AI agents in stda.auto mode: every pairing
+// in both seat orders, played in small batches on a worker pool, with the
+// results fed to the Bradley-Terry rating (rating/bt_rating.h). In paired
+// mode every deal is played twice with the seats swapped (common random numbers).
+// A two-agent match can stop early on a sequential probability ratio test.
+
+#ifndef STDA_TOURNAMENT_H
+#define STDA_TOURNAMENT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../../core/game_types.h"
+#include "../../core/game_context.h"
+#include "../../ai_strat/ai_strategy.h"
+#include "../../ui/shared/player_config.h"
+#include "../../rating/bt_rating.h"
+#include "../../rating/sprt.h"
+
+#define MAX_TOURNAMENT_AGENTS 16
+#define TOURNAMENT_BATCH_GAMES 4            // games a worker claims at a time
+#define TOURNAMENT_BOOTSTRAP_REPLICATES 1000
+#define TOURNAMENT_COMMIT_WINDOW 1024       // batches finished ahead of the oldest unfinished one
+#define TOURNAMENT_TRAJECTORY_POINTS 256    // LLR points kept for the report
+
+typedef struct
+{ uint32_t num_agents;
+  AIStrategyType agents[MAX_TOURNAMENT_AGENTS];
+  char names[MAX_TOURNAMENT_AGENTS][BT_NAME_LEN];
+  uint64_t games_per_job;   // games per pairing and seat order (paired: deals per pairing)
+  uint32_t batch_games;     // games (paired: deals) per batch; 0 = TOURNAMENT_BATCH_GAMES
+  uint16_t num_threads;
+  bool paired;              // play every deal in both seatings
+  bool use_sprt;            // two agents only: stop once the SPRT decides
+  SPRTSpec sprt;
+} TournamentSpec;
+
+// A job is one pairing in one seat order: agent[PLAYER_A] sits in seat A. In
+// paired mode a job is one pairing, and every deal is played once as listed
+// and once with the seats swapped. Counts are integers, so they add up the
+// same in any order.
+typedef struct
+{ uint8_t agent[2];
+  uint64_t games;
+  uint64_t seat_wins[2];
+  uint64_t agent_wins[2];  // wins of agent[0] and agent[1]
+  uint64_t draws;
+  uint64_t turn_sum;
+  uint64_t turn_sq_sum;
+  uint64_t deals;          // paired mode: deals played (two games each)
+  uint64_t deal_sum;       // paired mode: agent[0]'s half-points per deal (0 to 4), summed
+  uint64_t deal_sq_sum;
+} TournamentJob;
+
+// Comparison of the two agents of a paired job. The score difference is
+// (wins of agent[0] - wins of agent[1]) / games; its standard error comes from
+// the spread of the per-deal differences. unpaired_stderr is what the same
+// number of games with independent deals would give, from the per-game spread;
+// (unpaired_stderr / paired_stderr)^2 is the factor in games saved.
+typedef struct
+{ double score;            // agent[0]'s mean score, draws counting half
+  double difference;       // 2 * score - 1
+  double paired_stderr;    // of the difference
+  double unpaired_stderr;
+  double elo;              // of agent[0] over agent[1], from the score
+  double elo_stderr;       // by the delta method (infinite at a 0% or 100% score)
+} TournamentPairedEstimate;
+
+typedef struct
+{ uint64_t games;
+  double llr;
+} TournamentLLRPoint;
+
+typedef struct
+{ uint32_t num_agents;
+  uint32_t num_jobs;
+  TournamentJob jobs[MAX_TOURNAMENT_AGENTS * (MAX_TOURNAMENT_AGENTS - 1)];
+  bool paired;
+  uint64_t wins[MAX_TOURNAMENT_AGENTS][MAX_TOURNAMENT_AGENTS];   // [i][j]: i beat j, either seat
+  uint64_t draws[MAX_TOURNAMENT_AGENTS][MAX_TOURNAMENT_AGENTS];  // symmetric
+  uint64_t games;
+  uint64_t planned_games;  // without an early stop
+  double elapsed_ms;
+  // SPRT: the decision, the final LLR, and the LLR as games were committed
+  SPRTDecision sprt_decision;
+  double llr;
+  uint32_t num_trajectory;
+  uint64_t trajectory_stride;  // in batches
+  TournamentLLRPoint trajectory[TOURNAMENT_TRAJECTORY_POINTS];
+} TournamentResult;
+
+// Parse a comma-separated list of agent shorthands ("rand,simplemc,ismcts")
+// into spec->agents and spec->names. Rejects unknown, unimplemented and
+// repeated agents, and lists of fewer than 2; prints the reason to stderr.
+bool parse_tournament_agents(const char* list, TournamentSpec* spec);
+
+// Play the tournament. Workers claim batches of batch_games games from a
+// shared counter; the batches of all jobs are interleaved, so slow pairings
+// (search agents) are spread over the run instead of all coming last. Every
+// game is seeded by itself (tournament_seat_game), through separate chance
+// and agent streams (agent_ctx in GameContext), so the results depend on the
+// seed alone, not on num_threads or the batch size, and any game can be
+// replayed. In paired mode deal d of every pairing is seeded from
+// (cfg->prng_seed, d) alone, so both seatings, and all pairings, are dealt the
+// same cards and dice.
+// Finished batches are committed to the result in batch order; with use_sprt
+// the LLR is checked after every commit and the run stops at the first batch
+// where it crosses a bound, so an early stop is also independent of num_threads.
+// Returns false if a worker context cannot be created, or if use_sprt is set
+// with other than 2 agents.
+bool run_tournament(const TournamentSpec* spec, config_t* cfg, TournamentResult* result);
+
+// Add the agents (by name, reusing players already in the model) and the
+// games of every pairing to model; the next bt_fit() warm-starts from the
+// ratings already there. Returns false if the model runs out of memory.
+bool tournament_add_to_rating(const TournamentSpec* spec, const TournamentResult* result,
+                              BTModel* model);
+
+// Paired-difference estimate of a paired job; false if it has fewer than 2 deals
+bool tournament_paired_estimate(const TournamentJob* job, TournamentPairedEstimate* out);
+
+// Score and win-draw-loss matrices, seat balance and game length, the
+// paired comparisons in paired mode, and the LLR trajectory with the SPRT
+void present_tournament(const TournamentSpec* spec, const TournamentResult* result,
+                        FILE* out);
+
+// Seat the agents of game `game` of job k (jobs in the order of
+// TournamentResult.jobs; paired: game 2d + s is deal d, seats swapped when
+// s = 1) in strategies and ctx->agent_ctx (from agent_ctx, indexed by job
+// slot), and seed ctx and the agent contexts for that game alone; seat_agent
+// gets the spec agent in each seat. False if there is no such game.
+bool tournament_seat_game(const TournamentSpec* spec, uint32_t seed, uint32_t k, uint64_t game,
+                          GameContext* ctx, GameContext* const agent_ctx[2],
+                          StrategySet* strategies, uint8_t seat_agent[2]);
+
+// The tournament, paired match or SPRT match the stda.auto options describe;
+// prints the reason to stderr and returns false if they are invalid
+bool tournament_spec_from_config(const config_t* cfg, TournamentSpec* spec);
+
+// stda.auto entry point when --tournament or --paired is given: play, print
+// the matrices and the Bradley-Terry ratings with bootstrap intervals. With
+// --paired or --sprt and no list, the match is the -P agents (a mirror match
+// is allowed); with --sprt, -n is the most games the match may take.
+int run_mode_stda_tournament(config_t* cfg);
+
+#endif // STDA_TOURNAMENT_H
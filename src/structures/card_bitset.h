@@ -0,0 +1,36 @@
+// card_bitset.h
+// 128-bit set of fullDeck card indices, for O(1) card-location membership tests
+
+#ifndef CARD_BITSET_H
+#define CARD_BITSET_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Optional: only compiled into the card collections when building with
+// -DGAMESTATE_CARD_BITSETS (make FEATURES=-DGAMESTATE_CARD_BITSETS). Each deck,
+// hand, discard and combat zone then also keeps the set of card indices it
+// holds, so *_contains() is a single bit test instead of a scan, at the cost
+// of growing struct gamestate from 256 to 448 bytes.
+typedef struct
+{ uint64_t words[2];
+} CardBitset;
+
+static inline void CardBitset_clear(CardBitset* set)
+{ set->words[0] = 0;
+  set->words[1] = 0;
+}
+
+static inline void CardBitset_add(CardBitset* set, uint8_t card)
+{ set->words[card >> 6] |= UINT64_C(1) << (card & 63);
+}
+
+static inline void CardBitset_remove(CardBitset* set, uint8_t card)
+{ set->words[card >> 6] &= ~(UINT64_C(1) << (card & 63));
+}
+
+static inline bool CardBitset_contains(const CardBitset* set, uint8_t card)
+{ return (set->words[card >> 6] >> (card & 63)) & 1;
+}
+
+#endif // CARD_BITSET_H
@@ -9,11 +9,17 @@
 
 void Hand_init(Hand* hand) {
     hand->size = 0;
+#ifdef GAMESTATE_CARD_BITSETS
+    CardBitset_clear(&hand->members);
+#endif
 }
 
 void Hand_add(Hand* hand, uint8_t card) {
     if (hand->size < 12) {
         hand->cards[hand->size++] = card;
+#ifdef GAMESTATE_CARD_BITSETS
+        CardBitset_add(&hand->members, card);
+#endif
     }
 }
 
@@ -25,6 +31,9 @@ bool Hand_remove(Hand* hand, uint8_t card) {
                 hand->cards[j] = hand->cards[j + 1];
             }
             hand->size--;
+#ifdef GAMESTATE_CARD_BITSETS
+            CardBitset_remove(&hand->members, card);
+#endif
             return true;
         }
     }
@@ -37,6 +46,9 @@ bool Hand_remove_unordered(Hand* hand, uint8_t card) {
             // Swap with last element instead of shifting!
             hand->cards[i] = hand->cards[hand->size - 1];
             hand->size--;
+#ifdef GAMESTATE_CARD_BITSETS
+            CardBitset_remove(&hand->members, card);
+#endif
             return true;
         }
     }
@@ -45,6 +57,9 @@ bool Hand_remove_unordered(Hand* hand, uint8_t card) {
 
 void Hand_clear(Hand* hand) {
     hand->size = 0;
+#ifdef GAMESTATE_CARD_BITSETS
+    CardBitset_clear(&hand->members);
+#endif
 }
 
 uint8_t Hand_get(const Hand* hand, uint8_t index) {
@@ -55,12 +70,16 @@ uint8_t Hand_get(const Hand* hand, uint8_t index) {
 }
 
 bool Hand_contains(const Hand* hand, uint8_t card) {
+#ifdef GAMESTATE_CARD_BITSETS
+    return CardBitset_contains(&hand->members, card);
+#else
     for (uint8_t i = 0; i < hand->size; i++) {
         if (hand->cards[i] == card) {
             return true;
         }
     }
     return false;
+#endif
 }
 
 // ============================================================================
@@ -69,11 +88,17 @@ bool Hand_contains(const Hand* hand, uint8_t card) {
 
 void CombatZone_init(CombatZone* zone) {
     zone->size = 0;
+#ifdef GAMESTATE_CARD_BITSETS
+    CardBitset_clear(&zone->members);
+#endif
 }
 
 void CombatZone_add(CombatZone* zone, uint8_t card) {
     if (zone->size < 3) {
         zone->cards[zone->size++] = card;
+#ifdef GAMESTATE_CARD_BITSETS
+        CardBitset_add(&zone->members, card);
+#endif
     }
 }
 
@@ -84,6 +109,9 @@ bool CombatZone_remove(CombatZone* zone, uint8_t card) {
                 zone->cards[j] = zone->cards[j + 1];
             }
             zone->size--;
+#ifdef GAMESTATE_CARD_BITSETS
+            CardBitset_remove(&zone->members, card);
+#endif
             return true;
         }
     }
@@ -92,6 +120,9 @@ bool CombatZone_remove(CombatZone* zone, uint8_t card) {
 
 void CombatZone_clear(CombatZone* zone) {
     zone->size = 0;
+#ifdef GAMESTATE_CARD_BITSETS
+    CardBitset_clear(&zone->members);
+#endif
 }
 
 uint8_t CombatZone_get(const CombatZone* zone, uint8_t index) {
@@ -101,17 +132,36 @@ uint8_t CombatZone_get(const CombatZone* zone, uint8_t index) {
     return 0;
 }
 
+bool CombatZone_contains(const CombatZone* zone, uint8_t card) {
+#ifdef GAMESTATE_CARD_BITSETS
+    return CardBitset_contains(&zone->members, card);
+#else
+    for (uint8_t i = 0; i < zone->size; i++) {
+        if (zone->cards[i] == card) {
+            return true;
+        }
+    }
+    return false;
+#endif
+}
+
 // ============================================================================
 // Discard Implementation
 // ============================================================================
 
 void Discard_init(Discard* discard) {
     discard->size = 0;
+#ifdef GAMESTATE_CARD_BITSETS
+    CardBitset_clear(&discard->members);
+#endif
 }
 
 void Discard_add(Discard* discard, uint8_t card) {
     if (discard->size < 40) {
         discard->cards[discard->size++] = card;
+#ifdef GAMESTATE_CARD_BITSETS
+        CardBitset_add(&discard->members, card);
+#endif
     }
 }
 
@@ -122,6 +172,9 @@ bool Discard_remove(Discard* discard, uint8_t card) {
                 discard->cards[j] = discard->cards[j + 1];
             }
             discard->size--;
+#ifdef GAMESTATE_CARD_BITSETS
+            CardBitset_remove(&discard->members, card);
+#endif
             return true;
         }
     }
@@ -134,6 +187,9 @@ bool Discard_remove_unordered(Discard* discard, uint8_t card) {
             // Swap with last element instead of shifting!
             discard->cards[i] = discard->cards[discard->size - 1];
             discard->size--;
+#ifdef GAMESTATE_CARD_BITSETS
+            CardBitset_remove(&discard->members, card);
+#endif
             return true;
         }
     }
@@ -142,6 +198,9 @@ bool Discard_remove_unordered(Discard* discard, uint8_t card) {
 
 void Discard_clear(Discard* discard) {
     discard->size = 0;
+#ifdef GAMESTATE_CARD_BITSETS
+    CardBitset_clear(&discard->members);
+#endif
 }
 
 uint8_t Discard_get(const Discard* discard, uint8_t index) {
@@ -150,3 +209,16 @@ uint8_t Discard_get(const Discard* discard, uint8_t index) {
     }
     return 0;
 }
+
+bool Discard_contains(const Discard* discard, uint8_t card) {
+#ifdef GAMESTATE_CARD_BITSETS
+    return CardBitset_contains(&discard->members, card);
+#else
+    for (uint8_t i = 0; i < discard->size; i++) {
+        if (discard->cards[i] == card) {
+            return true;
+        }
+    }
+    return false;
+#endif
+}
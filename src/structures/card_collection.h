@@ -6,6 +6,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "card_bitset.h"
 
 // ============================================================================
 // Hand Collection (max 10 cards in practice, but allow margin)
@@ -13,6 +14,9 @@
 typedef struct {
     uint8_t cards[12];  // Allow some margin beyond max of 10
     uint8_t size;
+#ifdef GAMESTATE_CARD_BITSETS
+    CardBitset members;
+#endif
 } Hand;
 
 void Hand_init(Hand* hand);
@@ -28,6 +32,9 @@ bool Hand_contains(const Hand* hand, uint8_t card);
 typedef struct {
     uint8_t cards[3];
     uint8_t size;
+#ifdef GAMESTATE_CARD_BITSETS
+    CardBitset members;
+#endif
 } CombatZone;
 
 void CombatZone_init(CombatZone* zone);
@@ -35,6 +42,7 @@ void CombatZone_add(CombatZone* zone, uint8_t card);
 bool CombatZone_remove(CombatZone* zone, uint8_t card);
 void CombatZone_clear(CombatZone* zone);
 uint8_t CombatZone_get(const CombatZone* zone, uint8_t index);
+bool CombatZone_contains(const CombatZone* zone, uint8_t card);
 
 // ============================================================================
 // Discard Collection (max 40 cards)
@@ -42,6 +50,9 @@ uint8_t CombatZone_get(const CombatZone* zone, uint8_t index);
 typedef struct {
     uint8_t cards[40];
     uint8_t size;
+#ifdef GAMESTATE_CARD_BITSETS
+    CardBitset members;
+#endif
 } Discard;
 
 void Discard_init(Discard* discard);
@@ -49,5 +60,6 @@ void Discard_add(Discard* discard, uint8_t card);
 bool Discard_remove(Discard* discard, uint8_t card);
 void Discard_clear(Discard* discard);
 uint8_t Discard_get(const Discard* discard, uint8_t index);
+bool Discard_contains(const Discard* discard, uint8_t card);
 
 #endif // CARD_COLLECTION_H
@@ -5,14 +5,12 @@
 
 // Function to check if the stack is empty
 bool DeckStk_isEmpty(struct deck_stack *deck)
-{ // If top is -1, the stack is empty
-  return deck->top == -1;
+{ return deck->size == 0;
 }
 
 // Function to check if the stack is full
 bool DeckStk_isFull(struct deck_stack *deck)
-{ // If top is MAX_SIZE - 1, the stack is full
-  return deck->top == MAX_DECK_STACK_SIZE - 1;
+{ return deck->size == MAX_DECK_STACK_SIZE;
 }
 
 // Function to push an element onto the stack
@@ -22,8 +20,11 @@ void DeckStk_push(struct deck_stack *deck, uint8_t value)
   { printf("Deck Stack Overflow\n");
     return;
   }
-  // Increment top and add the value to the top of the stack
-  deck->card_indices[++deck->top] = value;
+  // Add the value on top of the stack
+  deck->card_indices[deck->size++] = value;
+#ifdef GAMESTATE_CARD_BITSETS
+  CardBitset_add(&deck->members, value);
+#endif
   //printf("Pushed %d onto the deck stack\n", value);
 }
 
@@ -34,18 +35,41 @@ uint8_t DeckStk_pop(struct deck_stack *deck)
   { printf("Deck Stack Underflow\n");
     return -1;
   }
-  // Return the top element
-  uint8_t popped = deck->card_indices[deck->top];
-  // decrement top pointer
-  deck->top--;
+  // Remove the top element
+  uint8_t popped = deck->card_indices[--deck->size];
+#ifdef GAMESTATE_CARD_BITSETS
+  CardBitset_remove(&deck->members, popped);
+#endif
   //printf("Popped %d from the deck stack\n", popped);
   // return the popped element
   return popped;
 }
 
-// empty out the entire deck and free heap memory
+uint8_t DeckStk_take(struct deck_stack *deck, uint8_t i)
+{ uint8_t top = deck->size - 1;
+  uint8_t card = deck->card_indices[i];
+  deck->card_indices[i] = deck->card_indices[top];
+  deck->card_indices[top] = card;
+  return DeckStk_pop(deck);
+}
+
+bool DeckStk_contains(const struct deck_stack *deck, uint8_t card)
+{
+#ifdef GAMESTATE_CARD_BITSETS
+  return CardBitset_contains(&deck->members, card);
+#else
+  for(uint8_t i = 0; i < deck->size; i++)
+    if(deck->card_indices[i] == card) return true;
+  return false;
+#endif
+}
+
+// empty out the entire deck
 void DeckStk_emptyOut(struct deck_stack *deck)
-{ deck->top = -1;
+{ deck->size = 0;
+#ifdef GAMESTATE_CARD_BITSETS
+  CardBitset_clear(&deck->members);
+#endif
 }
 
 // Function to peek the top element of the stack
@@ -56,12 +80,12 @@ uint8_t DeckStk_peek(struct deck_stack *deck)
     return -1;
   }
   // Return the top element without removing it
-  return deck->card_indices[deck->top];
+  return deck->card_indices[deck->size - 1];
 }
 
 void DeckStk_print(struct deck_stack *deck)
 { printf("(");
-  for(int i = deck->top; i >= 0; i--)
+  for(int i = deck->size - 1; i >= 0; i--)
     printf("%u, ", deck->card_indices[i]);
   printf(")");
 }
@@ -1,16 +1,28 @@
 #ifndef __DECKSTACK_H
 #define __DECKSTACK_H
 
+#include <stdint.h>
+#include <stdbool.h>
+#include "card_bitset.h"
+
 #define MAX_DECK_STACK_SIZE 40
 
+// card_indices[size - 1] is the top of the stack
 struct deck_stack
 { uint8_t card_indices[MAX_DECK_STACK_SIZE];
-  int8_t top;
+  uint8_t size;
+#ifdef GAMESTATE_CARD_BITSETS
+  CardBitset members;
+#endif
 };
 
 void DeckStk_push(struct deck_stack *, uint8_t) ;
 uint8_t DeckStk_pop(struct deck_stack *) ;
+// Remove and return the card at position i (0 = bottom): it is swapped with
+// the top first, so the order of the others changes
+uint8_t DeckStk_take(struct deck_stack *, uint8_t i);
 bool DeckStk_isEmpty(struct deck_stack *);
+bool DeckStk_contains(const struct deck_stack *, uint8_t);
 void DeckStk_emptyOut(struct deck_stack *);
 void DeckStk_print(struct deck_stack *deck);
 
@@ -91,7 +91,7 @@ void display_game_status(struct gamestate* gstate, config_t* cfg)
          LOCALIZED_STRING("Hand", "Main", "Mano"),
          gstate->hand[PLAYER_A].size,
          LOCALIZED_STRING("Deck", "Paquet", "Mazo"),
-         gstate->deck[PLAYER_A].top + 1);
+         gstate->deck[PLAYER_A].size);
   display_player_discard(PLAYER_A, gstate, cfg);
   printf(COLOR_P2 "%s (B)" RESET ": " COLOR_ENERGY "HP:%d" RESET
          " " COLOR_LUNA "L:%d" RESET " %s:%d %s:%d\n",
@@ -101,7 +101,7 @@ void display_game_status(struct gamestate* gstate, config_t* cfg)
          LOCALIZED_STRING("Hand", "Main", "Mano"),
          gstate->hand[PLAYER_B].size,
          LOCALIZED_STRING("Deck", "Paquet", "Mazo"),
-         gstate->deck[PLAYER_B].top + 1);
+         gstate->deck[PLAYER_B].size);
   display_player_discard(PLAYER_B, gstate, cfg);
 }
 
@@ -178,7 +178,8 @@ struct gamestate* initialize_cli_game(uint16_t initial_cash,
   set_player_strategy(strategies, PLAYER_B,
                       random_attack_strategy, random_defense_strategy);
 
-  struct gamestate* gstate = malloc(sizeof(struct gamestate));
+  struct gamestate* gstate = aligned_alloc(GAMESTATE_ALIGNMENT,
+                                           sizeof(struct gamestate));
   setup_game(initial_cash, gstate, ctx);
 
   *strategies_out = strategies;
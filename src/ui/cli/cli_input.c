@@ -12,6 +12,8 @@
 #include "cli_constants.h"
 #include "../../core/game_constants.h"
 #include "../../core/card_actions.h"
+#include "../../core/zobrist.h"
+#include "../../actions/action.h"
 #include "../shared/localization.h"
 
 /* ========================================================================
@@ -42,51 +44,57 @@ int parse_champion_indices(char* input, uint8_t* indices, int max_count,
   return count;
 }
 
-/* Comparison function for qsort - descending order */
-static int compare_desc(const void* a, const void* b)
-{ return (*(uint8_t*)b - *(uint8_t*)a);
-}
-
 int validate_and_play_champions(struct gamestate* gstate, PlayerID player,
                                 uint8_t* indices, int count, GameContext* ctx,
                                 config_t* cfg)
 { if(count <= 0) return NO_ACTION;
 
-  int total_cost = 0;
-
+  /* Hand positions -> card indices: the engine plays cards by identity, so
+     the order in which they leave the hand does not matter */
+  Action action = {ACTION_CHAMPIONS, 0, (uint8_t)count, {0}};
   for(int i = 0; i < count; i++)
-  { uint8_t card_idx = gstate->hand[player].cards[indices[i]];
-    if(fullDeck[card_idx].card_type != CHAMPION_CARD)
-    { printf(RED "%s %d %s\n" RESET,
-             LOCALIZED_STRING("Error: Card", "Erreur: Carte", "Error: Carta"),
-             indices[i] + 1,
-             LOCALIZED_STRING("is not a champion", "n'est pas un champion",
-                              "no es un campeon"));
+    action.cards[i] = gstate->hand[player].cards[indices[i]];
+
+  switch(validate_action(gstate, player, &action))
+  { case ACTION_OK:
+      break;
+    case ACTION_ERR_CARD_TYPE:
+      for(int i = 0; i < count; i++)
+      { if(fullDeck[action.cards[i]].card_type != CHAMPION_CARD)
+        { printf(RED "%s %d %s\n" RESET,
+                 LOCALIZED_STRING("Error: Card", "Erreur: Carte", "Error: Carta"),
+                 indices[i] + 1,
+                 LOCALIZED_STRING("is not a champion", "n'est pas un champion",
+                                  "no es un campeon"));
+          break;
+        }
+      }
+      return NO_ACTION;
+    case ACTION_ERR_COST:
+    { int total_cost = 0;
+      for(int i = 0; i < count; i++)
+        total_cost += fullDeck[action.cards[i]].cost;
+      printf(RED "%s (%s %d, %s %d)\n" RESET,
+             LOCALIZED_STRING("Error: Not enough lunas",
+                              "Erreur: Pas assez de lunas",
+                              "Error: No hay suficientes lunas"),
+             LOCALIZED_STRING("need", "besoin", "necesita"),
+             total_cost,
+             LOCALIZED_STRING("have", "avoir", "tienes"),
+             gstate->current_cash_balance[player]);
       return NO_ACTION;
     }
-    total_cost += fullDeck[card_idx].cost;
-  }
-
-  if(total_cost > gstate->current_cash_balance[player])
-  { printf(RED "%s (%s %d, %s %d)\n" RESET,
-           LOCALIZED_STRING("Error: Not enough lunas",
-                            "Erreur: Pas assez de lunas",
-                            "Error: No hay suficientes lunas"),
-           LOCALIZED_STRING("need", "besoin", "necesita"),
-           total_cost,
-           LOCALIZED_STRING("have", "avoir", "tienes"),
-           gstate->current_cash_balance[player]);
-    return NO_ACTION;
+    case ACTION_ERR_DUPLICATE:
+      printf(RED "%s\n" RESET,
+             LOCALIZED_STRING("Error: The same card is listed twice",
+                              "Erreur: La meme carte est indiquee deux fois",
+                              "Error: La misma carta aparece dos veces"));
+      return NO_ACTION;
+    default:
+      return NO_ACTION;
   }
 
-  /* CRITICAL FIX: Sort indices in descending order before removal
-     This ensures we remove from highest index to lowest, preventing
-     index invalidation as cards shift in the array */
-  qsort(indices, count, sizeof(uint8_t), compare_desc);
-
-  /* Now remove cards from highest to lowest index */
-  for(int i = 0; i < count; i++)
-    play_champion(gstate, player, gstate->hand[player].cards[indices[i]], ctx);
+  apply_action(gstate, player, &action, ctx);
 
   printf(GREEN ICON_SUCCESS " %s %d %s\n" RESET,
          LOCALIZED_STRING("Played", "Joue", "Jugado"),
@@ -177,17 +185,12 @@ int validate_and_recall_champions(struct gamestate* gstate, PlayerID player,
   collect_champions(gstate->discard[player].cards, gstate->discard[player].size,
                     champions, true);
 
-  // Remove draw/recall card from hand, pay cost, discard it
-  Hand_remove(&gstate->hand[player], draw_card_idx);
-  gstate->current_cash_balance[player] -= fullDeck[draw_card_idx].cost;
-  Discard_add(&gstate->discard[player], draw_card_idx);
-
-  // Recall the selected champions from discard to hand
+  // The caller has checked the card and the selection (exact count, no
+  // duplicates): play the card, recalling the selected champions
+  Action action = {ACTION_RECALL, draw_card_idx, (uint8_t)count, {0}};
   for(int i = 0; i < count; i++)
-  { uint8_t champion_idx = champions[indices[i]];
-    Discard_remove(&gstate->discard[player], champion_idx);
-    Hand_add(&gstate->hand[player], champion_idx);
-  }
+    action.cards[i] = champions[indices[i]];
+  apply_action(gstate, player, &action, ctx);
 
   printf(GREEN ICON_SUCCESS " %s %d %s\n" RESET,
          LOCALIZED_STRING("Recalled", "Rappele", "Recuperado"),
@@ -477,6 +480,7 @@ void discard_and_draw_cards(struct gamestate* gstate, PlayerID player,
   { uint8_t card_idx = gstate->hand[player].cards[indices[i]];
     Hand_remove(&gstate->hand[player], card_idx);
     Discard_add(&gstate->discard[player], card_idx);
+    zobrist_move_card(gstate, player, ZOBRIST_HAND, ZOBRIST_DISCARD, card_idx);
   }
 
   // Draw replacement cards if requested
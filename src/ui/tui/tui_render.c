@@ -466,7 +466,7 @@ static void tui_draw_discard_column(WINDOW* win, PlayerID player,
 
 static void tui_draw_deck_discard(WINDOW* win, int y, PlayerID player,
                                   struct gamestate* gstate, config_t* cfg)
-{ int deck_size = gstate->deck[player].top + 1;
+{ int deck_size = gstate->deck[player].size;
   int discard_size = gstate->discard[player].size;
   char label[64];
 
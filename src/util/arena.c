@@ -0,0 +1,76 @@
+// arena.c
+// Bump allocator for per-decision search data
+#include <stdlib.h>
+
+#include "arena.h"
+
+#define ARENA_ALIGNMENT 16
+
+static ArenaChunk* new_chunk(size_t capacity)
+{ ArenaChunk* chunk = (ArenaChunk*)malloc(sizeof(ArenaChunk) + capacity);
+  if(chunk == NULL) return NULL;
+
+  chunk->next = NULL;
+  chunk->capacity = capacity;
+  chunk->used = 0;
+  return chunk;
+}
+
+Arena* arena_create(size_t chunk_size)
+{ Arena* arena = (Arena*)malloc(sizeof(Arena));
+  if(arena == NULL) return NULL;
+
+  arena->first = new_chunk(chunk_size);
+  if(arena->first == NULL)
+  { free(arena);
+    return NULL;
+  }
+  arena->current = arena->first;
+  arena->chunk_size = chunk_size;
+  arena->used = 0;
+  arena->peak = 0;
+  arena->reserved = chunk_size;
+  return arena;
+} // arena_create
+
+void arena_destroy(Arena* arena)
+{ if(arena == NULL) return;
+
+  ArenaChunk* chunk = arena->first;
+  while(chunk != NULL)
+  { ArenaChunk* next = chunk->next;
+    free(chunk);
+    chunk = next;
+  }
+  free(arena);
+}
+
+void* arena_alloc(Arena* arena, size_t size)
+{ size = (size + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1);
+
+  ArenaChunk* chunk = arena->current;
+  while(chunk->used + size > chunk->capacity)
+  { // Reuse the chunks kept by arena_reset() before allocating new ones
+    if(chunk->next == NULL)
+    { size_t capacity = size > arena->chunk_size ? size : arena->chunk_size;
+      chunk->next = new_chunk(capacity);
+      if(chunk->next == NULL) return NULL;
+      arena->reserved += capacity;
+    }
+    chunk = chunk->next;
+    chunk->used = 0;
+    arena->current = chunk;
+  }
+
+  void* ptr = chunk->data + chunk->used;
+  chunk->used += size;
+  arena->used += size;
+  if(arena->used > arena->peak) arena->peak = arena->used;
+  return ptr;
+} // arena_alloc
+
+void arena_reset(Arena* arena)
+{ arena->current = arena->first;
+  arena->first->used = 0;
+  arena->used = 0;
+}
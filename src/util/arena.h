@@ -0,0 +1,37 @@
+// arena.h
+// Bump allocator for per-decision search data (tree nodes, move lists)
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Memory comes from a chain of large chunks: an allocation is a pointer bump,
+// nothing is freed individually, and arena_reset() rewinds to the first chunk
+// while keeping every chunk for reuse -- so once a search has warmed the
+// arena up, later decisions make no malloc() calls at all.
+typedef struct ArenaChunk
+{ struct ArenaChunk* next;
+  size_t capacity;
+  size_t used;
+  _Alignas(16) unsigned char data[];
+} ArenaChunk;
+
+typedef struct Arena
+{ ArenaChunk* first;
+  ArenaChunk* current;
+  size_t chunk_size;   // default chunk capacity
+  size_t used;         // bytes handed out since the last reset
+  size_t peak;         // high-water mark of `used` over the arena's lifetime
+  size_t reserved;     // bytes held in chunks
+} Arena;
+
+Arena* arena_create(size_t chunk_size);
+void arena_destroy(Arena* arena);
+
+// 16-byte aligned; NULL only if a new chunk cannot be allocated
+void* arena_alloc(Arena* arena, size_t size);
+void arena_reset(Arena* arena);
+
+#endif // ARENA_H
@@ -17,6 +17,7 @@
 #endif
 
 #include "prng_seed.h"
+#include "xoshiro.h"
 #include "../core/game_constants.h"
 
 void prng_config_init(prng_config_t* config)
@@ -125,8 +126,37 @@ bool parse_seed_arg(const char* arg, uint32_t* seed)
   return true;
 }
 
+bool parse_prng_backend_arg(const char* arg, RndBackend* backend)
+{ if(!arg || !backend) return false;
+
+  if(strcmp(arg, "mt") == 0 || strcmp(arg, "mt19937") == 0)
+  { *backend = RND_BACKEND_MT19937;
+    return true;
+  }
+  if(strcmp(arg, "xoshiro") == 0 || strcmp(arg, "xoshiro256") == 0)
+  { *backend = RND_BACKEND_XOSHIRO256;
+    return true;
+  }
+
+  return false;
+}
+
 uint32_t validate_seed(uint32_t seed)
 { /* MT19937 accepts all uint32_t values, so just return as-is */
   /* This function exists for future extensions or different PRNGs */
   return seed;
 }
+
+/* mix64() (xoshiro.h) is bijective, so neighbouring (seed, stream) pairs
+   map to unrelated MT19937 seeds */
+uint32_t derive_stream_seed(uint32_t master_seed, uint32_t stream_id)
+{ if(stream_id == 0) return master_seed;
+
+  uint64_t z = ((uint64_t)master_seed << 32) | stream_id;
+  return (uint32_t)(mix64(z + 0x9E3779B97F4A7C15ULL) >> 32);
+}
+
+uint32_t derive_game_seed(uint32_t master_seed, uint64_t game, uint32_t stream)
+{ uint64_t z = mix64((((uint64_t)master_seed << 32) | stream) + 0x9E3779B97F4A7C15ULL);
+  return (uint32_t)(mix64(z + game) >> 32);
+}
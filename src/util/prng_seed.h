@@ -7,6 +7,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "rnd.h"
 
 //#define M_TWISTER_SEED 1337UL
 #define MT_SEED_MAX 0xFFFFFFFFUL  /* Maximum valid seed for MT19937 */
@@ -26,7 +27,31 @@ uint32_t generate_random_seed(void);
 /* Parse seed from command line argument, returns true on success */
 bool parse_seed_arg(const char* arg, uint32_t* seed);
 
+/* Parse PRNG backend name ("mt"/"mt19937", "xoshiro"/"xoshiro256"),
+   returns true on success */
+bool parse_prng_backend_arg(const char* arg, RndBackend* backend);
+
 /* Validate and clamp seed to legal values */
 uint32_t validate_seed(uint32_t seed);
 
+/* Derive the seed of an independent RNG stream from a master seed.
+   Stream 0 returns the master seed unchanged, so serial runs keep
+   reproducing historical results. */
+uint32_t derive_stream_seed(uint32_t master_seed, uint32_t stream_id);
+
+/* Seed of random stream `stream` of game number `game`: a hash of all three,
+   so any game can be seeded without playing the games before it. */
+uint32_t derive_game_seed(uint32_t master_seed, uint64_t game, uint32_t stream);
+
+/* Random streams of one game (derive_game_seed's stream, plus a per-run
+   offset): chance events of the game (deal, reshuffles, dice), and each
+   agent's own draws, kept apart so the luck of the game does not depend on
+   how much randomness the agents use. */
+typedef enum
+{ GAME_STREAM_CHANCE = 0,
+  GAME_STREAM_AGENT_0,
+  GAME_STREAM_AGENT_1,
+  GAME_STREAM_COUNT
+} GameStream;
+
 #endif /* PRNG_SEED_H */
@@ -0,0 +1,116 @@
+// profile.c
+// Hot-path profiling totals and report (see profile.h)
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+#include "profile.h"
+
+_Thread_local ProfileThread profile_thread;
+bool profile_enabled;
+
+static ProfileCounters totals;
+static pthread_mutex_t totals_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Clock calibration: wall time (and ticks) at profile_start()
+static double start_ns;
+#ifdef ORACLE_PROFILE
+static uint64_t start_ticks;
+
+// What the timers themselves cost, in ticks: an empty region's reading, and
+// what a timed region adds to the one around it (profile_start() measures both)
+#define PROFILE_CALIBRATION_SCOPES 4096
+static double empty_scope_ticks, nested_scope_ticks;
+
+static const int8_t REGION_PARENT[PROFILE_REGION_COUNT] =
+{ -1, PROFILE_TURN, PROFILE_BEGIN_OF_TURN, PROFILE_TURN, PROFILE_ATTACK_PHASE,
+  PROFILE_ATTACK_PHASE, PROFILE_TURN, PROFILE_DEFENSE_PHASE, PROFILE_DEFENSE_PHASE,
+  PROFILE_TURN, PROFILE_TURN
+};
+
+static const char* const REGION_NAMES[PROFILE_REGION_COUNT] =
+{ "turn", "  begin_of_turn", "    reshuffle", "  attack_phase", "    attack strategy A",
+  "    attack strategy B", "  defense_phase", "    defense strategy A",
+  "    defense strategy B", "  resolve_combat", "  end_of_turn"
+};
+#endif
+
+static double now_ns(void)
+{ struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+void profile_start(void)
+{ memset(&totals, 0, sizeof(totals));
+#ifdef ORACLE_PROFILE
+  ProfileThread* t = &profile_thread;
+  bool timing = t->timing;
+  t->timing = true;
+  uint64_t begin = profile_ticks();
+  for(int i = 0; i < PROFILE_CALIBRATION_SCOPES; i++)
+  { PROFILE_SCOPE(PROFILE_TURN);
+  }
+  uint64_t end = profile_ticks();
+  empty_scope_ticks = (double)t->counters.ticks[PROFILE_TURN] / PROFILE_CALIBRATION_SCOPES;
+  nested_scope_ticks = (double)(end - begin) / PROFILE_CALIBRATION_SCOPES;
+  memset(&t->counters, 0, sizeof(t->counters));
+  t->timing = timing;
+  start_ticks = profile_ticks();
+#endif
+  start_ns = now_ns();
+  profile_enabled = true;
+}
+
+void profile_thread_flush(void)
+{ ProfileCounters* local = &profile_thread.counters;
+  pthread_mutex_lock(&totals_lock);
+  totals.turns += local->turns;
+  for(int r = 0; r < PROFILE_REGION_COUNT; r++)
+  { totals.samples[r] += local->samples[r];
+    totals.ticks[r] += local->ticks[r];
+  }
+  pthread_mutex_unlock(&totals_lock);
+  memset(local, 0, sizeof(*local));
+}
+
+void profile_report(FILE* out)
+{ if(!profile_enabled) return;
+#ifndef ORACLE_PROFILE
+  fprintf(out, "\nProfile: not compiled in (rebuild with make clean; "
+               "make FEATURES=-DORACLE_PROFILE)\n");
+#else
+  double ns_per_tick = 1.0;
+  uint64_t elapsed_ticks = profile_ticks() - start_ticks;
+  if(elapsed_ticks > 0)
+    ns_per_tick = (now_ns() - start_ns) / (double)elapsed_ticks;
+
+  const uint64_t turns = totals.turns;
+  const uint64_t timed = totals.samples[PROFILE_TURN];
+  if(timed == 0)
+  { fprintf(out, "\nProfile: no timed turns (%lu turns played)\n", (unsigned long)turns);
+    return;
+  }
+  // Timed ticks less the timers' own: the region's, and its children's
+  double ticks[PROFILE_REGION_COUNT];
+  for(int r = 0; r < PROFILE_REGION_COUNT; r++)
+    ticks[r] = totals.ticks[r] - totals.samples[r] * empty_scope_ticks;
+  for(int r = 0; r < PROFILE_REGION_COUNT; r++)
+    if(REGION_PARENT[r] >= 0)
+      ticks[REGION_PARENT[r]] -= totals.samples[r] * nested_scope_ticks;
+  double ns_per_turn = ticks[PROFILE_TURN] * ns_per_tick / timed;
+
+  fprintf(out, "\nProfile: %lu turns, 1 in %d timed (%lu), %.1f ns/turn, clock %.3f GHz, "
+               "timer cost %.1f ns (subtracted)\n", (unsigned long)turns, PROFILE_SAMPLE_PERIOD,
+          (unsigned long)timed, ns_per_turn, 1.0 / ns_per_tick, nested_scope_ticks * ns_per_tick);
+  fprintf(out, "%-24s %12s %12s %12s %8s\n", "region", "calls/turn", "ns/call", "ns/turn",
+          "% turn");
+  for(int r = 0; r < PROFILE_REGION_COUNT; r++)
+  { double calls_per_turn = (double)totals.samples[r] / timed;
+    double ns_per_call = totals.samples[r] > 0 ? ticks[r] * ns_per_tick / totals.samples[r] : 0.0;
+    fprintf(out, "%-24s %12.4f %12.1f %12.1f %7.1f%%\n", REGION_NAMES[r], calls_per_turn,
+            ns_per_call, ns_per_call * calls_per_turn,
+            100.0 * ns_per_call * calls_per_turn / ns_per_turn);
+  }
+#endif
+} // profile_report
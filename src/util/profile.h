@@ -0,0 +1,137 @@
+// profile.h
+// Compile-time gated hot-path profiling: scoped timers (rdtsc on x86-64,
+// clock_gettime elsewhere) and call counters for the phases of a turn, the
+// reshuffles and the strategy calls, accumulated per thread.
+//
+// Build with make FEATURES=-DORACLE_PROFILE (run make clean first) and run
+// stda.auto with --profile; without ORACLE_PROFILE the macros below compile
+// to nothing. Turns are all counted, but only one in PROFILE_SAMPLE_PERIOD is
+// timed (and has its calls counted): outside those, a timer costs a load and
+// a branch, which keeps the overhead under 2% even for random agents. Engine
+// calls made inside a strategy (a search's playouts) are the strategy's time
+// and are not counted on their own.
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define PROFILE_SAMPLE_PERIOD 64   // power of 2
+
+// Regions, in report order; nesting is per the comments
+typedef enum
+{ PROFILE_TURN,                // play_turn()
+  PROFILE_BEGIN_OF_TURN,       //   begin_of_turn()
+  PROFILE_RESHUFFLE,           //     shuffle_discard_and_form_deck() in draw_1_card()
+  PROFILE_ATTACK_PHASE,        //   attack_phase()
+  PROFILE_ATTACK_STRATEGY_A,   //     player A's attack strategy
+  PROFILE_ATTACK_STRATEGY_B,
+  PROFILE_DEFENSE_PHASE,       //   defense_phase()
+  PROFILE_DEFENSE_STRATEGY_A,  //     player A's defense strategy
+  PROFILE_DEFENSE_STRATEGY_B,
+  PROFILE_RESOLVE_COMBAT,      //   resolve_combat()
+  PROFILE_END_OF_TURN,         //   end_of_turn()
+  PROFILE_REGION_COUNT
+} ProfileRegion;
+
+typedef struct
+{ uint64_t turns;                          // all turns played with --profile
+  uint64_t samples[PROFILE_REGION_COUNT];  // calls in timed turns
+  uint64_t ticks[PROFILE_REGION_COUNT];    // time of those calls
+} ProfileCounters;
+
+// One thread's counters and sampling state
+typedef struct
+{ ProfileCounters counters;
+  uint32_t turn_seq;
+  uint8_t depth;      // strategy calls in progress
+  bool timing;        // in a timed turn, and not inside a strategy
+} ProfileThread;
+
+extern _Thread_local ProfileThread profile_thread;
+extern bool profile_enabled;
+
+// Turn counting on (--profile) and mark the start of the clock calibration
+void profile_start(void);
+// Fold this thread's counters into the totals (a worker does it once it is
+// done) and clear them
+void profile_thread_flush(void);
+// The report: ns per turn and per region; nothing unless profile_start() ran
+void profile_report(FILE* out);
+
+#ifdef ORACLE_PROFILE
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+static inline uint64_t profile_ticks(void)
+{ return __rdtsc();
+}
+#else
+#include <time.h>
+static inline uint64_t profile_ticks(void)
+{ struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+#endif
+
+typedef struct
+{ uint8_t region;
+  bool strategy;
+  uint64_t start;         // 0: not timed
+} ProfileScope;
+
+static inline ProfileScope profile_scope_begin(ProfileRegion region, bool strategy)
+{ ProfileThread* t = &profile_thread;
+  ProfileScope s = {(uint8_t)region, strategy, 0};
+  if(strategy) t->depth++;
+  if(t->timing)
+  { s.start = profile_ticks();
+    if(strategy) t->timing = false;
+  }
+  return s;
+}
+
+static inline void profile_scope_end(ProfileScope* s)
+{ ProfileThread* t = &profile_thread;
+  if(s->strategy) t->depth--;
+  if(s->start != 0)
+  { t->counters.ticks[s->region] += profile_ticks() - s->start;
+    t->counters.samples[s->region]++;
+    if(s->strategy) t->timing = true;
+  }
+}
+
+// Count the turn and decide whether it is timed; a turn played inside a
+// strategy is not counted at all
+static inline void profile_turn_begin(void)
+{ ProfileThread* t = &profile_thread;
+  if(!profile_enabled || t->depth > 0) return;
+  t->counters.turns++;
+  t->timing = (++t->turn_seq & (PROFILE_SAMPLE_PERIOD - 1)) == 0;
+}
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+// Time the rest of the enclosing block as `region`
+#define PROFILE_SCOPE(region) \
+  __attribute__((cleanup(profile_scope_end))) ProfileScope PROFILE_CONCAT(profile_scope_, __LINE__) = \
+    profile_scope_begin(region, false)
+// The same, for a strategy call: what it does in the engine is its own time
+#define PROFILE_STRATEGY_SCOPE(region) \
+  __attribute__((cleanup(profile_scope_end))) ProfileScope PROFILE_CONCAT(profile_scope_, __LINE__) = \
+    profile_scope_begin(region, true)
+// Start of play_turn(), before its PROFILE_SCOPE(PROFILE_TURN)
+#define PROFILE_TURN_BEGIN() profile_turn_begin()
+
+#else
+
+#define PROFILE_SCOPE(region) ((void)0)
+#define PROFILE_STRATEGY_SCOPE(region) ((void)0)
+#define PROFILE_TURN_BEGIN() ((void)0)
+
+#endif // ORACLE_PROFILE
+
+#endif // PROFILE_H
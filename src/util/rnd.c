@@ -1,8 +1,11 @@
 #include <stdint.h>
+#include <stdlib.h>
 
 #include "rnd.h"
 #include "../core/game_context.h"
 #include "mtwister.h"
+#include "xoshiro.h"
+#include "prng_seed.h"
 
 // Global variables (keep to a minimum)
 //MTRand MTwister_rand_struct;
@@ -13,6 +16,87 @@
 //uint8_t d12() { return dn(12);}
 //uint8_t d20() { return dn(20);}
 
+static const char* const RND_BACKEND_NAMES[] = {"mt19937", "xoshiro256**"};
+
+bool RND_init(RndState* rs, RndBackend backend, uint32_t seed)
+{ rs->backend = backend;
+  rs->seed = seed;
+  rs->xo = seedXoshiro(seed);
+  rs->mt = NULL;
+
+  if(backend == RND_BACKEND_MT19937)
+  { rs->mt = (MTRand*)malloc(sizeof(MTRand));
+    if(rs->mt == NULL) return false;
+    *rs->mt = seedRand(seed);
+  }
+
+  return true;
+} // RND_init
+
+void RND_release(RndState* rs)
+{ free(rs->mt);
+  rs->mt = NULL;
+}
+
+// Restart the generator from a new seed, keeping the backend (no allocation):
+// one state can replay many independently seeded games or batches
+void RND_reseed(RndState* rs, uint32_t seed)
+{ rs->seed = seed;
+  rs->xo = seedXoshiro(seed);
+  if(rs->backend == RND_BACKEND_MT19937)
+    *rs->mt = seedRand(seed);
+} // RND_reseed
+
+// Move a freshly initialized state to the start of stream stream_id.
+// xoshiro256** streams are 2^128 draws apart (stream_id jumps, each O(1));
+// MT19937 has no cheap jump, so its streams are reseeded from a derived seed.
+// Stream 0 is the state itself.
+void RND_split(RndState* rs, uint32_t stream_id)
+{ if(stream_id == 0) return;
+
+  if(rs->backend == RND_BACKEND_MT19937)
+    *rs->mt = seedRand(derive_stream_seed(rs->seed, stream_id));
+  else
+  { rs->xo = seedXoshiro(rs->seed);
+    for(uint32_t i = 0; i < stream_id; i++)
+      jumpXoshiro(&rs->xo);
+  }
+} // RND_split
+
+const char* RND_backend_name(RndBackend backend)
+{ return (backend < RND_BACKEND_COUNT) ? RND_BACKEND_NAMES[backend] : "unknown";
+}
+
+uint32_t RND_next32(RndState* rs)
+{ if(rs->backend == RND_BACKEND_MT19937)
+    return genRandLong(rs->mt);
+  return (uint32_t)(nextXoshiro(&rs->xo) >> 32);
+}
+
+// return a pseudo-random double in [0, 1]
+double RND_uniform(GameContext* ctx)
+{ if(ctx->rng.backend == RND_BACKEND_MT19937)
+    return genRand(ctx->rng.mt);
+  return (double)(nextXoshiro(&ctx->rng.xo) >> 11) * 0x1.0p-53;
+}
+
+// Lemire's multiply-shift: map a 32-bit draw x to [0, n) without division,
+// redrawing (rarely, when the low word falls under 2^32 mod n) to stay unbiased
+static inline uint8_t lemire_bounded(uint32_t x, uint8_t n, Xoshiro256* xo)
+{ uint64_t m = (uint64_t)x * n;
+  uint32_t low = (uint32_t)m;
+
+  if(low < n)
+  { uint32_t threshold = (uint32_t)(-(uint32_t)n) % n;
+    while(low < threshold)
+    { m = (uint64_t)(uint32_t)(nextXoshiro(xo) >> 32) * n;
+      low = (uint32_t)m;
+    }
+  }
+
+  return (uint8_t)(m >> 32);
+}
+
 // return a pseudo-random integer number between 1 and n
 uint8_t RND_dn(uint8_t n, GameContext* ctx)
 { return RND_randn(n, ctx) + 1;
@@ -20,9 +104,32 @@ uint8_t RND_dn(uint8_t n, GameContext* ctx)
 
 // randn will return a pseudo-random integer number between 0 and n-1
 uint8_t RND_randn(uint8_t n, GameContext* ctx)
-{ return (uint8_t)genRandLong(&ctx->rng) % n;
+{ if(ctx->rng.backend == RND_BACKEND_MT19937)
+    return (uint8_t)genRandLong(ctx->rng.mt) % n;  // legacy mapping, kept for seed compatibility
+  return lemire_bounded((uint32_t)(nextXoshiro(&ctx->rng.xo) >> 32), n, &ctx->rng.xo);
 } // randn
 
+// Roll count dice at once: rolls[i] in [1, sides[i]]. Draws happen in index
+// order, so MT19937 results equal count successive RND_dn() calls; xoshiro256**
+// gets two dice out of every 64-bit output.
+void RND_dn_batch(const uint8_t sides[], uint8_t rolls[], uint8_t count, GameContext* ctx)
+{ if(ctx->rng.backend == RND_BACKEND_MT19937)
+  { for(uint8_t i = 0; i < count; i++)
+      rolls[i] = (uint8_t)genRandLong(ctx->rng.mt) % sides[i] + 1;
+    return;
+  }
+
+  Xoshiro256* xo = &ctx->rng.xo;
+  uint8_t i = 0;
+  for(; i + 1 < count; i += 2)
+  { uint64_t x = nextXoshiro(xo);
+    rolls[i] = lemire_bounded((uint32_t)(x >> 32), sides[i], xo) + 1;
+    rolls[i + 1] = lemire_bounded((uint32_t)x, sides[i + 1], xo) + 1;
+  }
+  if(i < count)
+    rolls[i] = lemire_bounded((uint32_t)(nextXoshiro(xo) >> 32), sides[i], xo) + 1;
+} // RND_dn_batch
+
 // A function to generate a random permutation of arr[]
 /* to use this:
      int arr[] = {1, 2, 3, 4, 5, 6, 7, 8};
@@ -1,10 +1,43 @@
 #ifndef __RND_H
 #define __RND_H
 
-#include "../core/game_context.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include "mtwister.h"
+#include "xoshiro.h"
 
+// Selectable PRNG backends. MT19937 is the default and reproduces every
+// historical seed bit for bit (including the legacy "% n" dice mapping);
+// xoshiro256** is the small-state, splittable backend for parallel work.
+typedef enum
+{ RND_BACKEND_MT19937 = 0,
+  RND_BACKEND_XOSHIRO256,
+  RND_BACKEND_COUNT
+} RndBackend;
+
+typedef struct
+{ RndBackend backend;
+  uint32_t seed;       // master seed, kept so MT19937 streams can be re-derived
+  Xoshiro256 xo;       // xoshiro256** state (32 bytes)
+  MTRand* mt;          // MT19937 state (~2.5 KB), heap-allocated only when selected
+} RndState;
+
+typedef struct GameContext GameContext;
+
+// Generator state management
+bool RND_init(RndState* rs, RndBackend backend, uint32_t seed);
+void RND_release(RndState* rs);
+void RND_reseed(RndState* rs, uint32_t seed);
+void RND_split(RndState* rs, uint32_t stream_id);
+const char* RND_backend_name(RndBackend backend);
+
+// Raw and bounded draws
+uint32_t RND_next32(RndState* rs);
+double RND_uniform(GameContext* ctx);
 uint8_t RND_randn(uint8_t n, GameContext* ctx);
 uint8_t RND_dn(uint8_t n, GameContext* ctx);
+void RND_dn_batch(const uint8_t sides[], uint8_t rolls[], uint8_t count, GameContext* ctx);
+
 void RND_swap(uint8_t*, uint8_t*);
 void RND_partial_shuffle(uint8_t A[], uint8_t n, uint8_t k, GameContext* ctx);
 
@@ -0,0 +1,75 @@
+/* An implementation of the xoshiro256** 1.0 generator, after the public
+   domain reference code by David Blackman and Sebastiano Vigna (2018).
+
+   https://prng.di.unimi.it/
+*/
+
+#include <stdint.h>
+#include "xoshiro.h"
+
+static inline uint64_t rotl(const uint64_t x, int k)
+{ return (x << k) | (x >> (64 - k));
+}
+
+/* splitmix64, as recommended by the authors to expand a 64-bit seed
+   into the 256-bit state (never yields the all-zero state) */
+static uint64_t splitmix64(uint64_t* x)
+{ return mix64(*x += 0x9E3779B97F4A7C15ULL);
+}
+
+/**
+  Creates a new random number generator from a given seed.
+*/
+Xoshiro256 seedXoshiro(uint64_t seed)
+{ Xoshiro256 rand;
+  for(int i = 0; i < 4; i++)
+    rand.s[i] = splitmix64(&seed);
+  return rand;
+}
+
+/**
+   Generates a pseudo-random 64-bit value.
+*/
+uint64_t nextXoshiro(Xoshiro256* rand)
+{ uint64_t* s = rand->s;
+  const uint64_t result = rotl(s[1] * 5, 7) * 9;
+  const uint64_t t = s[1] << 17;
+
+  s[2] ^= s[0];
+  s[3] ^= s[1];
+  s[1] ^= s[2];
+  s[0] ^= s[3];
+  s[2] ^= t;
+  s[3] = rotl(s[3], 45);
+
+  return result;
+}
+
+/**
+   Advances the generator by 2^128 steps in constant time. Calling it k
+   times on a copy of a seeded state gives the start of stream k.
+*/
+void jumpXoshiro(Xoshiro256* rand)
+{ static const uint64_t JUMP[] =
+  { 0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL,
+    0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL
+  };
+
+  uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  for(int i = 0; i < 4; i++)
+  { for(int b = 0; b < 64; b++)
+    { if(JUMP[i] & (UINT64_C(1) << b))
+      { s0 ^= rand->s[0];
+        s1 ^= rand->s[1];
+        s2 ^= rand->s[2];
+        s3 ^= rand->s[3];
+      }
+      nextXoshiro(rand);
+    }
+  }
+
+  rand->s[0] = s0;
+  rand->s[1] = s1;
+  rand->s[2] = s2;
+  rand->s[3] = s3;
+}
@@ -0,0 +1,25 @@
+#ifndef __XOSHIRO_H
+#define __XOSHIRO_H
+
+#include <stdint.h>
+
+/* xoshiro256** 1.0 (Blackman & Vigna): 32 bytes of state, period 2^256 - 1,
+   with a jump function equivalent to 2^128 calls of nextXoshiro(), used to
+   carve the sequence into non-overlapping streams. */
+typedef struct tagXoshiro256
+{ uint64_t s[4];
+} Xoshiro256;
+
+Xoshiro256 seedXoshiro(uint64_t seed);
+uint64_t nextXoshiro(Xoshiro256* rand);
+void jumpXoshiro(Xoshiro256* rand);
+
+/* The splitmix64 finalizer: a cheap bijective 64-bit mixer. It seeds the
+   xoshiro state, and derives seeds (prng_seed.c) and Zobrist keys. */
+static inline uint64_t mix64(uint64_t z)
+{ z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+#endif /* #ifndef __XOSHIRO_H */
@@ -0,0 +1,294 @@
+// bench_ai.c
+// Benchmark: AI decision speed and quality on the standard position set --
+// every agent's attack or defense decision on each position at a fixed
+// budget, with latency percentiles, search work per second, and agreement
+// with the positions' reference moves. --generate builds the position set.
+
+#include "../src/actions/action.h"
+#include "../src/actions/action_trace.h"
+#include "../src/ai_strat/ai_strat_ismcts1.h"
+#include "../src/ai_strat/ai_strat_simplemc1.h"
+#include "../src/ai_strat/ai_strategy.h"
+#include "../src/core/combo_bonus.h"
+#include "../src/core/game_constants.h"
+#include "../src/core/game_context.h"
+#include "../src/core/game_snapshot.h"
+#include "../src/core/game_state.h"
+#include "../src/core/turn_logic.h"
+#include "../src/core/zobrist.h"
+#include "../src/util/prng_seed.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define DEFAULT_POSITIONS "testsrc/bench_positions/standard.snap"
+#define DEFAULT_AGENTS "rand,simplemc,ismcts"
+#define DEFAULT_BUDGET 1000
+#define MAX_BENCH_AGENTS 8
+#define BENCH_SEED 2024
+
+// Position set: POSITIONS_PER_PHASE attack positions, then as many defense
+// ones, from games between Simple MC agents at GENERATE_BUDGET playouts.
+// Each position's reference move is ISMCTS's at REFERENCE_ITERATIONS.
+#define POSITIONS_PER_PHASE 100
+#define GENERATE_BUDGET 200
+#define REFERENCE_ITERATIONS 10000
+
+// The reference move is kept in the position's index tag, action_encode()d
+// (at most ACTION_TRACE_MAX_ACTION_BYTES bytes), low byte first
+static uint64_t move_tag(const Action* move)
+{ uint8_t bytes[8] = {0};
+  uint32_t n = action_encode(move, bytes);
+  uint64_t tag = 0;
+  for(uint32_t i = 0; i < n; i++)
+    tag |= (uint64_t)bytes[i] << 8 * i;
+  return tag;
+}
+
+static bool tag_move(uint64_t tag, Action* move)
+{ uint8_t bytes[8];
+  for(int i = 0; i < 8; i++)
+    bytes[i] = (uint8_t)(tag >> 8 * i);
+  return action_decode(bytes, sizeof(bytes), move) > 0;
+}
+
+static double now_ms(void)
+{ struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e3 + ts.tv_nsec * 1e-6;
+}
+
+static uint16_t count_legal_moves(const struct gamestate* gstate)
+{ static ActionList list;
+  list.options = ACTIONS_ALL;
+  generate_legal_actions(gstate, gstate->player_to_move, &list);
+  return list.count;
+}
+
+// One decision of agent `type` at position, with its budget in playouts or
+// iterations; work gets the search's playouts or iterations (0 for agents
+// that report none). Agents without a search API of their own are played
+// through their strategy functions, and their first action is read back from
+// an action trace (no action: a pass).
+static void decide(AIStrategyType type, const struct gamestate* position, uint32_t budget,
+                   GameContext* ctx, Action* move, uint64_t* work)
+{ *work = 0;
+  move->type = ACTION_PASS;
+  move->num_cards = 0;
+
+  if(type == AI_STRATEGY_SIMPLE_MC)
+  { SimpleMCParams params = {budget, 0};
+    SimpleMCReport report;
+    if(simplemc_choose_move(position, &params, ctx, move, &report))
+      *work = report.playouts;
+    return;
+  }
+  if(type == AI_STRATEGY_ISMCTS)
+  { ISMCTSParams params = {budget, 0, ISMCTS_DEFAULT_EXPLORATION, 1, AI_PARALLEL_ROOT};
+    ISMCTSReport report;
+    if(ismcts_choose_move(position, &params, ctx, move, &report))
+      *work = report.iterations;
+    return;
+  }
+
+  StrategySet strategies;
+  set_player_strategy_by_type(&strategies, position->player_to_move, type);
+  struct gamestate g;
+  clone_gamestate(&g, position);
+  uint8_t bytes[256];
+  ActionTrace trace;
+  action_trace_record(&trace, bytes, sizeof(bytes));
+  action_trace_start(&trace, &g);
+  action_trace_begin_phase(&trace, &g);
+  ctx->action_trace = &trace;
+  if(g.turn_phase == ATTACK)
+    strategies.attack_strategy[g.player_to_move](&g, ctx);
+  else
+    strategies.defense_strategy[g.player_to_move](&g, ctx);
+  ctx->action_trace = NULL;
+  if(!trace.failed && bytes[0] > 0)
+    action_decode(&bytes[1], trace.length - 1, move);
+} // decide
+
+// Position generation: both seats capture the first decision of their phase
+// with a real choice at or after the game's target turn, then play Simple MC
+static struct
+{ struct gamestate positions[2][POSITIONS_PER_PHASE];
+  uint32_t count[2];
+  uint16_t target_turn;
+  bool taken[2];
+} capture;
+
+static void capture_position(struct gamestate* gstate)
+{ TurnPhase phase = (TurnPhase)gstate->turn_phase;
+  if(capture.taken[phase] || capture.count[phase] == POSITIONS_PER_PHASE ||
+     gstate->turn < capture.target_turn || count_legal_moves(gstate) < 2)
+    return;
+  clone_gamestate(&capture.positions[phase][capture.count[phase]++], gstate);
+  capture.taken[phase] = true;
+}
+
+static void capture_attack(struct gamestate* gstate, GameContext* ctx)
+{ capture_position(gstate);
+  simplemc_attack_strategy(gstate, ctx);
+}
+
+static void capture_defense(struct gamestate* gstate, GameContext* ctx)
+{ capture_position(gstate);
+  simplemc_defense_strategy(gstate, ctx);
+}
+
+static int generate(const char* path)
+{ config_t cfg = {0};
+  cfg.prng_seed = BENCH_SEED;
+  cfg.prng_backend = RND_BACKEND_XOSHIRO256;
+  cfg.ai_budget = GENERATE_BUDGET;
+  GameContext* ctx = create_game_context(&cfg);
+  StrategySet strategies;
+  set_player_strategy(&strategies, PLAYER_A, capture_attack, capture_defense);
+  set_player_strategy(&strategies, PLAYER_B, capture_attack, capture_defense);
+
+  // Target turns spread the positions over the opening, middle and end game
+  uint64_t games = 0;
+  while(capture.count[ATTACK] < POSITIONS_PER_PHASE || capture.count[DEFENSE] < POSITIONS_PER_PHASE)
+  { struct gamestate g;
+    RND_reseed(&ctx->rng, derive_game_seed(BENCH_SEED, games++, GAME_STREAM_CHANCE));
+    capture.target_turn = (uint16_t)(1 + RND_randn(40, ctx));
+    capture.taken[ATTACK] = capture.taken[DEFENSE] = false;
+    setup_game(INITIAL_CASH_DEFAULT, &g, ctx);
+    g.turn = 0;
+    do
+      play_turn(NULL, &g, &strategies, ctx);
+    while(g.turn < MAX_NUMBER_OF_TURNS && !g.someone_has_zero_energy);
+  }
+  printf("%d + %d positions from %lu games; reference moves at %d ISMCTS iterations...\n",
+         POSITIONS_PER_PHASE, POSITIONS_PER_PHASE, (unsigned long)games, REFERENCE_ITERATIONS);
+
+  GameSnapshotWriter* writer = game_snapshot_file_create(path, RND_BACKEND_COUNT);
+  bool ok = writer != NULL;
+  ISMCTSParams params = {REFERENCE_ITERATIONS, 0, ISMCTS_DEFAULT_EXPLORATION, 1, AI_PARALLEL_ROOT};
+  for(int phase = ATTACK; phase <= DEFENSE && ok; phase++)
+    for(uint32_t i = 0; i < POSITIONS_PER_PHASE && ok; i++)
+    { const struct gamestate* position = &capture.positions[phase][i];
+      Action best;
+      RND_reseed(&ctx->rng, derive_game_seed(BENCH_SEED, phase * POSITIONS_PER_PHASE + i,
+                                             GAME_STREAM_AGENT_0));
+      ok = ismcts_choose_move(position, &params, ctx, &best, NULL) &&
+           game_snapshot_file_add(writer, position, NULL, move_tag(&best));
+    }
+  ok = game_snapshot_file_close(writer) && ok;
+  destroy_game_context(ctx);
+  if(!ok)
+  { fprintf(stderr, "Failed to write %s\n", path);
+    return 1;
+  }
+  printf("Wrote %s\n", path);
+  return 0;
+} // generate
+
+static int compare_doubles(const void* a, const void* b)
+{ double x = *(const double*)a, y = *(const double*)b;
+  return (x > y) - (x < y);
+}
+
+// Nearest-rank percentile of n sorted values
+static double percentile(const double* sorted, uint32_t n, double p)
+{ uint32_t rank = (uint32_t)(p / 100.0 * n + 0.999999);
+  return sorted[rank == 0 ? 0 : rank - 1];
+}
+
+static void bench_agent(const char* name, AIStrategyType type, const GameSnapshotReader* reader,
+                        uint32_t budget, GameContext* ctx)
+{ double* latency = (double*)malloc(reader->num_snapshots * sizeof(double));
+  for(int phase = ATTACK; phase <= DEFENSE; phase++)
+  { uint32_t n = 0, agree = 0;
+    uint64_t work = 0;
+    double total_ms = 0.0;
+    for(uint64_t k = 0; k < reader->num_snapshots; k++)
+    { struct gamestate position;
+      Action reference, move;
+      if(reader->index[k].turn_phase != phase ||
+         !game_snapshot_load(reader, k, &position, NULL) || !tag_move(reader->index[k].tag, &reference))
+        continue;
+
+      uint64_t decision_work;
+      RND_reseed(&ctx->rng, derive_game_seed(BENCH_SEED, k, GAME_STREAM_AGENT_0));
+      double start = now_ms();
+      decide(type, &position, budget, ctx, &move, &decision_work);
+      latency[n] = now_ms() - start;
+      total_ms += latency[n++];
+      work += decision_work;
+      agree += action_key(&move) == action_key(&reference);
+    }
+    if(n == 0) continue;
+
+    qsort(latency, n, sizeof(double), compare_doubles);
+    char rate[32] = "-";
+    if(work > 0)
+      snprintf(rate, sizeof(rate), "%.0f", work / (total_ms * 1e-3));
+    printf("%-10s %-7s %5u %9.3f %9.3f %9.3f %9.3f %12s %7.1f%%\n", name,
+           phase == ATTACK ? "attack" : "defense", n, percentile(latency, n, 50),
+           percentile(latency, n, 90), percentile(latency, n, 99), latency[n - 1], rate,
+           100.0 * agree / n);
+  }
+  free(latency);
+} // bench_agent
+
+int main(int argc, char** argv)
+{ if(!combo_bonus_init())
+  { fprintf(stderr, "Failed to build combo bonus tables\n");
+    return 1;
+  }
+  actions_init();
+  zobrist_init();
+
+  if(argc > 1 && strcmp(argv[1], "--generate") == 0)
+    return generate(argc > 2 ? argv[2] : DEFAULT_POSITIONS);
+
+  const char* path = (argc > 1) ? argv[1] : DEFAULT_POSITIONS;
+  uint32_t budget = (argc > 2) ? (uint32_t)atoi(argv[2]) : DEFAULT_BUDGET;
+  const char* agents = (argc > 3) ? argv[3] : DEFAULT_AGENTS;
+  if(budget < 1)
+  { fprintf(stderr, "Usage: %s [positions [budget [agent,agent...]]]\n"
+                    "       %s --generate [positions]\n", argv[0], argv[0]);
+    return 1;
+  }
+
+  // Agents by -A shorthand, implemented ones only
+  char list[256], names[MAX_BENCH_AGENTS][32];
+  AIStrategyType types[MAX_BENCH_AGENTS];
+  int num_agents = 0;
+  snprintf(list, sizeof(list), "%s", agents);
+  for(char* name = strtok(list, ","); name != NULL; name = strtok(NULL, ","))
+  { StrategySet probe;
+    AIStrategyType type = parse_ai_strategy_shorthand(name);
+    if(type == AI_STRATEGY_COUNT || !set_player_strategy_by_type(&probe, PLAYER_A, type) ||
+       num_agents == MAX_BENCH_AGENTS)
+    { fprintf(stderr, "Error: unknown or unimplemented AI agent '%s'\n", name);
+      return 1;
+    }
+    snprintf(names[num_agents], sizeof(names[0]), "%s", name);
+    types[num_agents++] = type;
+  }
+
+  GameSnapshotReader reader;
+  if(!game_snapshot_file_open(path, &reader)) return 1;
+
+  config_t cfg = {0};
+  cfg.prng_seed = BENCH_SEED;
+  cfg.prng_backend = RND_BACKEND_XOSHIRO256;
+  cfg.ai_budget = budget;
+  GameContext* ctx = create_game_context(&cfg);
+
+  printf("%lu positions from %s, budget %u playouts/iterations per decision\n",
+         (unsigned long)reader.num_snapshots, path, budget);
+  printf("%-10s %-7s %5s %9s %9s %9s %9s %12s %8s\n", "agent", "phase", "pos",
+         "p50 ms", "p90 ms", "p99 ms", "max ms", "work/s", "agree");
+  for(int a = 0; a < num_agents; a++)
+    bench_agent(names[a], types[a], &reader, budget, ctx);
+
+  destroy_game_context(ctx);
+  game_snapshot_reader_close(&reader);
+  return 0;
+} // main
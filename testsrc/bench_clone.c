@@ -0,0 +1,52 @@
+// bench_clone.c
+// Microbenchmark: clone_gamestate() throughput (clones per second)
+
+#include "../src/core/game_state.h"
+#include "../src/core/game_constants.h"
+#include "../src/core/game_context.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define NUM_CLONES 50000000UL
+#define NUM_TARGETS 64   // rotate through 64 destinations (16 KB, L1-resident)
+
+static double now_seconds(void)
+{ struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char** argv)
+{ unsigned long num_clones = (argc > 1) ? strtoul(argv[1], NULL, 10) : NUM_CLONES;
+
+  config_t cfg = {0};
+  cfg.prng_seed = 2024;
+  cfg.prng_backend = RND_BACKEND_XOSHIRO256;
+  GameContext* ctx = create_game_context(&cfg);
+
+  static struct gamestate root;
+  static struct gamestate targets[NUM_TARGETS];
+  setup_game(INITIAL_CASH_DEFAULT, &root, ctx);
+
+  // Touch each copy so the compiler cannot drop the memcpy
+  unsigned long checksum = 0;
+  double start = now_seconds();
+  for(unsigned long i = 0; i < num_clones; i++)
+  { struct gamestate* dst = &targets[i % NUM_TARGETS];
+    clone_gamestate(dst, &root);
+    root.turn = (uint16_t)i;
+    checksum += dst->turn;
+  }
+  double elapsed = now_seconds() - start;
+
+  printf("struct gamestate: %zu bytes, %zu-byte aligned\n",
+         sizeof(struct gamestate), _Alignof(struct gamestate));
+  printf("%lu clones in %.3f s: %.1f M clones/s, %.2f ns/clone, %.1f GB/s (checksum %lu)\n",
+         num_clones, elapsed, num_clones / elapsed * 1e-6,
+         elapsed * 1e9 / num_clones,
+         num_clones * sizeof(struct gamestate) / elapsed * 1e-9, checksum);
+
+  destroy_game_context(ctx);
+  return 0;
+}
@@ -0,0 +1,416 @@
+// bench_engine.c
+// Microbenchmarks: the engine hot paths (combo bonus, combat resolution,
+// draws and reshuffles, partial shuffles, game setup, a whole turn, a
+// heuristic agent's decision, a turn of the lockstep batch simulator) over
+// randomized inputs, in ns/op with a 95% confidence interval over repeated
+// timed batches. Build with release flags (make bench_engine); --json writes
+// the results as JSON instead of a table.
+
+#include "../src/actions/action.h"
+#include "../src/ai_strat/ai_strat_heuristic1.h"
+#include "../src/ai_strat/ai_strat_random.h"
+#include "../src/ai_strat/ai_strategy.h"
+#include "../src/core/batch_sim.h"
+#include "../src/core/card_actions.h"
+#include "../src/core/combat.h"
+#include "../src/core/combo_bonus.h"
+#include "../src/core/game_constants.h"
+#include "../src/core/game_context.h"
+#include "../src/core/game_state.h"
+#include "../src/core/turn_logic.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define DEFAULT_REPS 15
+#define MAX_REPS 1000
+#define CALIBRATE_MS 5.0   // batch doubled until it takes this long
+#define REP_MS 20.0        // target duration of one timed batch
+#define BENCH_SEED 2024
+
+// Inputs are cycled through in order; 1024 game states are 256 KB, so the
+// state benchmarks run out of L2 rather than from one hot cache line
+#define NUM_INPUTS 1024
+
+static double now_ns(void)
+{ struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Checksums go here so the compiler cannot drop the work being timed
+static volatile uint64_t sink;
+
+// ---------------------------------------------------------------------------
+// Inputs: positions from random-vs-random games, captured at the start of a
+// turn and right before combat resolution (after the defense), and random
+// champion combinations for the combo bonus
+// ---------------------------------------------------------------------------
+
+static struct gamestate turn_start[NUM_INPUTS];
+static struct gamestate pre_combat[NUM_INPUTS];
+static struct gamestate pre_draw[NUM_INPUTS];   // current player's deck not empty
+static Discard discards[NUM_INPUTS];            // not empty
+static CombatCard combo_cards[NUM_INPUTS][3];
+static uint8_t combo_indices[NUM_INPUTS][3];
+static uint8_t combo_count[NUM_INPUTS];
+static uint8_t shuffle_n[NUM_INPUTS], shuffle_k[NUM_INPUTS];
+static uint32_t num_pre_combat;
+
+static void capture_defense(struct gamestate* gstate, GameContext* ctx)
+{ random_defense_strategy(gstate, ctx);
+  if(num_pre_combat < NUM_INPUTS && RND_randn(4, ctx) == 0)
+    clone_gamestate(&pre_combat[num_pre_combat++], gstate);
+}
+
+static void make_inputs(GameContext* ctx)
+{ StrategySet strategies;
+  set_player_strategy(&strategies, PLAYER_A, random_attack_strategy, capture_defense);
+  set_player_strategy(&strategies, PLAYER_B, random_attack_strategy, capture_defense);
+
+  // One in four turns is kept, so the positions spread over many games
+  uint32_t num_turns = 0, num_draws = 0, num_discards = 0;
+  while(num_turns < NUM_INPUTS || num_pre_combat < NUM_INPUTS ||
+        num_draws < NUM_INPUTS || num_discards < NUM_INPUTS)
+  { struct gamestate g;
+    setup_game(INITIAL_CASH_DEFAULT, &g, ctx);
+    g.turn = 0;
+    do
+    { if(RND_randn(4, ctx) == 0)
+      { PlayerID player = (PlayerID)g.current_player;
+        if(num_turns < NUM_INPUTS)
+          clone_gamestate(&turn_start[num_turns++], &g);
+        if(num_draws < NUM_INPUTS && g.deck[player].size > 0)
+          clone_gamestate(&pre_draw[num_draws++], &g);
+        if(num_discards < NUM_INPUTS && g.discard[player].size > 0)
+          discards[num_discards++] = g.discard[player];
+      }
+      play_turn(NULL, &g, &strategies, ctx);
+    }
+    while(g.turn < MAX_NUMBER_OF_TURNS && !g.someone_has_zero_energy);
+  }
+
+  uint8_t champions[FULL_DECK_SIZE], num_champions = 0;
+  for(uint8_t i = 0; i < FULL_DECK_SIZE; i++)
+    if(fullDeck[i].card_type == CHAMPION_CARD)
+      champions[num_champions++] = i;
+  for(int i = 0; i < NUM_INPUTS; i++)
+  { combo_count[i] = 1 + RND_randn(3, ctx);
+    for(int j = 0; j < combo_count[i]; j++)
+    { const struct card* c = &fullDeck[champions[RND_randn(num_champions, ctx)]];
+      combo_indices[i][j] = (uint8_t)(c - fullDeck);
+      combo_cards[i][j] = (CombatCard){c->species, c->color, c->order};
+    }
+    shuffle_n[i] = 1 + RND_randn(MAX_DECK_STACK_SIZE, ctx);
+    shuffle_k[i] = 1 + RND_randn(shuffle_n[i], ctx);
+  }
+} // make_inputs
+
+// ---------------------------------------------------------------------------
+// Benchmarks: `ops` operations, cycling through the inputs. The state
+// benchmarks work on a fresh copy of their input each time, so their ns/op
+// include one clone_gamestate() (see the clone_gamestate row).
+// ---------------------------------------------------------------------------
+
+static uint64_t run_clone(uint64_t ops, GameContext* ctx)
+{ struct gamestate g;
+  uint64_t sum = 0;
+  (void)ctx;
+  for(uint64_t n = 0; n < ops; n++)
+  { clone_gamestate(&g, &turn_start[n % NUM_INPUTS]);
+    sum += g.turn;
+  }
+  return sum;
+}
+
+static uint64_t run_combo_bonus(uint64_t ops, GameContext* ctx)
+{ uint64_t sum = 0;
+  (void)ctx;
+  for(uint64_t n = 0; n < ops; n++)
+  { uint32_t i = n % NUM_INPUTS;
+    sum += calculate_combo_bonus(combo_cards[i], combo_count[i], DECK_RANDOM);
+  }
+  return sum;
+}
+
+static uint64_t run_combo_lookup(uint64_t ops, GameContext* ctx)
+{ uint64_t sum = 0;
+  (void)ctx;
+  for(uint64_t n = 0; n < ops; n++)
+  { uint32_t i = n % NUM_INPUTS;
+    sum += combo_bonus_lookup(combo_indices[i], combo_count[i], DECK_RANDOM);
+  }
+  return sum;
+}
+
+static uint64_t run_resolve_combat(uint64_t ops, GameContext* ctx)
+{ struct gamestate g;
+  uint64_t sum = 0;
+  for(uint64_t n = 0; n < ops; n++)
+  { clone_gamestate(&g, &pre_combat[n % NUM_INPUTS]);
+    resolve_combat(&g, ctx);
+    sum += g.current_energy[PLAYER_A] + g.current_energy[PLAYER_B];
+  }
+  return sum;
+}
+
+static uint64_t run_draw_1_card(uint64_t ops, GameContext* ctx)
+{ struct gamestate g;
+  uint64_t sum = 0;
+  for(uint64_t n = 0; n < ops; n++)
+  { clone_gamestate(&g, &pre_draw[n % NUM_INPUTS]);
+    draw_1_card(&g, (PlayerID)g.current_player, ctx);
+    sum += g.hand[g.current_player].size;
+  }
+  return sum;
+}
+
+static uint64_t run_reshuffle(uint64_t ops, GameContext* ctx)
+{ Discard discard;
+  struct deck_stack deck;
+  uint64_t sum = 0;
+  for(uint64_t n = 0; n < ops; n++)
+  { discard = discards[n % NUM_INPUTS];
+    DeckStk_emptyOut(&deck);
+    shuffle_discard_and_form_deck(&discard, &deck, ctx);
+    sum += deck.card_indices[deck.size - 1];
+  }
+  return sum;
+}
+
+static uint64_t run_partial_shuffle(uint64_t ops, GameContext* ctx)
+{ uint8_t cards[MAX_DECK_STACK_SIZE];
+  uint64_t sum = 0;
+  for(uint8_t i = 0; i < MAX_DECK_STACK_SIZE; i++)
+    cards[i] = i;
+  for(uint64_t n = 0; n < ops; n++)
+  { uint32_t i = n % NUM_INPUTS;
+    RND_partial_shuffle(cards, shuffle_n[i], shuffle_k[i], ctx);
+    sum += cards[0];
+  }
+  return sum;
+}
+
+static uint64_t run_setup_game(uint64_t ops, GameContext* ctx)
+{ struct gamestate g;
+  uint64_t sum = 0;
+  for(uint64_t n = 0; n < ops; n++)
+  { setup_game(INITIAL_CASH_DEFAULT, &g, ctx);
+    sum += g.hand[PLAYER_A].cards[0];
+  }
+  return sum;
+}
+
+static uint64_t run_play_turn(uint64_t ops, GameContext* ctx)
+{ StrategySet strategies;
+  struct gamestate g;
+  uint64_t sum = 0;
+  set_player_strategy(&strategies, PLAYER_A, random_attack_strategy, random_defense_strategy);
+  set_player_strategy(&strategies, PLAYER_B, random_attack_strategy, random_defense_strategy);
+  for(uint64_t n = 0; n < ops; n++)
+  { clone_gamestate(&g, &turn_start[n % NUM_INPUTS]);
+    play_turn(NULL, &g, &strategies, ctx);
+    sum += g.current_energy[PLAYER_A] + g.current_energy[PLAYER_B];
+  }
+  return sum;
+}
+
+// The attacker's decision at turn start
+static uint64_t run_heuristic_choose_move(uint64_t ops, GameContext* ctx)
+{ struct gamestate g;
+  Action best;
+  uint64_t sum = 0;
+  (void)ctx;
+  for(uint64_t n = 0; n < ops; n++)
+  { clone_gamestate(&g, &turn_start[n % NUM_INPUTS]);
+    g.player_to_move = g.current_player;
+    g.turn_phase = ATTACK;
+    heuristic_choose_move(&g, &HEURISTIC_DEFAULT_PARAMS, &best, NULL);
+    sum += best.type + best.num_cards;
+  }
+  return sum;
+}
+
+static uint64_t run_heuristic_turn(uint64_t ops, GameContext* ctx)
+{ StrategySet strategies;
+  struct gamestate g;
+  uint64_t sum = 0;
+  set_player_strategy(&strategies, PLAYER_A, heuristic_attack_strategy, heuristic_defense_strategy);
+  set_player_strategy(&strategies, PLAYER_B, heuristic_attack_strategy, heuristic_defense_strategy);
+  for(uint64_t n = 0; n < ops; n++)
+  { clone_gamestate(&g, &turn_start[n % NUM_INPUTS]);
+    play_turn(NULL, &g, &strategies, ctx);
+    sum += g.current_energy[PLAYER_A] + g.current_energy[PLAYER_B];
+  }
+  return sum;
+}
+
+// One op is a lane-turn: batch_sim_step() plays BATCH_LANES of them
+static uint64_t run_batch_sim_step(uint64_t ops, GameContext* ctx)
+{ static BatchSim bs;
+  static bool ready;
+  BatchResult results[BATCH_LANES];
+  uint64_t sum = 0;
+  (void)ctx;
+  if(!ready)
+    ready = batch_sim_init(&bs, UINT64_MAX, INITIAL_CASH_DEFAULT, BENCH_SEED, BATCH_ISA_AUTO);
+  for(uint64_t n = 0; n < ops; n += BATCH_LANES)
+    sum += batch_sim_step(&bs, results) + bs.energy[PLAYER_A][0];
+  return sum;
+}
+
+typedef struct
+{ const char* name;
+  const char* input;
+  uint64_t (*run)(uint64_t ops, GameContext* ctx);
+} EngineBench;
+
+static const EngineBench benches[] =
+{ {"clone_gamestate", "game state (baseline for the state rows)", run_clone},
+  {"calculate_combo_bonus", "1-3 random champions", run_combo_bonus},
+  {"combo_bonus_lookup", "1-3 random champions", run_combo_lookup},
+  {"resolve_combat", "state after the defense", run_resolve_combat},
+  {"draw_1_card", "state at turn start", run_draw_1_card},
+  {"shuffle_discard_and_form_deck", "discard pile", run_reshuffle},
+  {"RND_partial_shuffle", "n 1-40, k 1-n", run_partial_shuffle},
+  {"setup_game", "-", run_setup_game},
+  {"play_turn", "state at turn start, random agents", run_play_turn},
+  {"heuristic_choose_move", "state at turn start, attacker", run_heuristic_choose_move},
+  {"play_turn (heuristic)", "state at turn start, heuristic agents", run_heuristic_turn},
+  {"batch_sim_step", "per lane-turn, random agents", run_batch_sim_step},
+};
+#define NUM_BENCHES (sizeof(benches) / sizeof(benches[0]))
+
+// ---------------------------------------------------------------------------
+// Measurement
+// ---------------------------------------------------------------------------
+
+typedef struct
+{ uint64_t ops_per_rep;
+  double mean, ci95, stddev, min, median;  // ns/op
+} BenchResult;
+
+static int compare_doubles(const void* a, const void* b)
+{ double x = *(const double*)a, y = *(const double*)b;
+  return (x > y) - (x < y);
+}
+
+// Two-sided 95% Student t quantile for df degrees of freedom
+static double t95(int df)
+{ static const double table[30] =
+  { 12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+    2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+    2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+  };
+  return df < 1 ? 0.0 : df <= 30 ? table[df - 1] : 1.960;
+}
+
+// Warm up and size the batch (doubling until it takes CALIBRATE_MS, then
+// scaled to REP_MS), run one untimed batch, then time `reps` batches
+static void measure(const EngineBench* bench, int reps, GameContext* ctx, BenchResult* r)
+{ uint64_t ops = 1;
+  double elapsed;
+  for(;;)
+  { double start = now_ns();
+    sink += bench->run(ops, ctx);
+    elapsed = now_ns() - start;
+    if(elapsed >= CALIBRATE_MS * 1e6) break;
+    ops *= 2;
+  }
+  r->ops_per_rep = (uint64_t)fmax(1.0, ops * (REP_MS * 1e6 / elapsed));
+  sink += bench->run(r->ops_per_rep, ctx);
+
+  double ns_per_op[MAX_REPS];
+  double sum = 0.0;
+  for(int i = 0; i < reps; i++)
+  { double start = now_ns();
+    sink += bench->run(r->ops_per_rep, ctx);
+    ns_per_op[i] = (now_ns() - start) / r->ops_per_rep;
+    sum += ns_per_op[i];
+  }
+  r->mean = sum / reps;
+  double ss = 0.0;
+  for(int i = 0; i < reps; i++)
+    ss += (ns_per_op[i] - r->mean) * (ns_per_op[i] - r->mean);
+  r->stddev = reps > 1 ? sqrt(ss / (reps - 1)) : 0.0;
+  r->ci95 = t95(reps - 1) * r->stddev / sqrt(reps);
+  qsort(ns_per_op, reps, sizeof(double), compare_doubles);
+  r->min = ns_per_op[0];
+  r->median = reps % 2 ? ns_per_op[reps / 2] : 0.5 * (ns_per_op[reps / 2 - 1] + ns_per_op[reps / 2]);
+} // measure
+
+static bool selected(const char* name, char** filters, int num_filters)
+{ if(num_filters == 0) return true;
+  for(int i = 0; i < num_filters; i++)
+    if(strstr(name, filters[i]) != NULL) return true;
+  return false;
+}
+
+int main(int argc, char** argv)
+{ bool json = false;
+  int reps = DEFAULT_REPS;
+  char* filters[NUM_BENCHES + 8];
+  int num_filters = 0;
+
+  for(int i = 1; i < argc; i++)
+  { if(strcmp(argv[i], "--json") == 0)
+      json = true;
+    else if(strncmp(argv[i], "--reps=", 7) == 0)
+      reps = atoi(argv[i] + 7);
+    else if(argv[i][0] != '-' && num_filters < (int)(sizeof(filters) / sizeof(filters[0])))
+      filters[num_filters++] = argv[i];
+    else
+      reps = 0;
+  }
+  if(reps < 2 || reps > MAX_REPS)
+  { fprintf(stderr, "Usage: %s [--json] [--reps=N (2-%d)] [benchmark name filter...]\n",
+            argv[0], MAX_REPS);
+    return 1;
+  }
+
+  if(!combo_bonus_init())
+  { printf("Failed to build combo bonus tables\n");
+    return 1;
+  }
+  actions_init();
+  config_t cfg = {0};
+  cfg.prng_seed = BENCH_SEED;
+  cfg.prng_backend = RND_BACKEND_XOSHIRO256;
+  GameContext* ctx = create_game_context(&cfg);
+  make_inputs(ctx);
+
+  if(json)
+    printf("{\n  \"reps\": %d,\n  \"rep_ms\": %.1f,\n  \"prng\": \"%s\",\n  \"results\": [", reps,
+           REP_MS, RND_backend_name(cfg.prng_backend));
+  else
+  { printf("%d timed batches of ~%.0f ms per benchmark, %s PRNG\n", reps, REP_MS,
+           RND_backend_name(cfg.prng_backend));
+    printf("%-30s %12s %10s %10s %10s  %s\n", "benchmark", "ns/op", "+/- 95%", "min",
+           "median", "input");
+  }
+
+  bool first = true;
+  for(size_t b = 0; b < NUM_BENCHES; b++)
+  { if(!selected(benches[b].name, filters, num_filters)) continue;
+    BenchResult r;
+    measure(&benches[b], reps, ctx, &r);
+    if(json)
+    { printf("%s\n    {\"name\": \"%s\", \"ns_per_op\": %.4f, \"ci95\": %.4f, \"stddev\": %.4f, "
+             "\"min\": %.4f, \"median\": %.4f, \"ops_per_rep\": %lu}", first ? "" : ",",
+             benches[b].name, r.mean, r.ci95, r.stddev, r.min, r.median,
+             (unsigned long)r.ops_per_rep);
+      first = false;
+    }
+    else
+      printf("%-30s %12.2f %10.2f %10.2f %10.2f  %s\n", benches[b].name, r.mean, r.ci95, r.min,
+             r.median, benches[b].input);
+    fflush(stdout);
+  }
+  if(json)
+    printf("\n  ]\n}\n");
+
+  destroy_game_context(ctx);
+  return 0;
+} // main
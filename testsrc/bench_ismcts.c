@@ -0,0 +1,102 @@
+// bench_ismcts.c
+// Benchmark: root- and tree-parallel ISMCTS on 1..N threads -- iterations per
+// second and win rate against the random strategy at a fixed time per move
+
+#include "../src/actions/action.h"
+#include "../src/ai_strat/ai_strat_ismcts1.h"
+#include "../src/ai_strat/ai_strat_random.h"
+#include "../src/ai_strat/ai_strategy.h"
+#include "../src/core/combo_bonus.h"
+#include "../src/core/game_constants.h"
+#include "../src/core/game_context.h"
+#include "../src/core/game_state.h"
+#include "../src/core/turn_logic.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define DEFAULT_GAMES 10
+#define DEFAULT_MS_PER_MOVE 5
+#define MAX_DEFAULT_THREADS 8
+
+// The strategy functions take no parameters, so the benchmark's search
+// settings and running totals live here
+static ISMCTSParams bench_params;
+static uint64_t total_iterations;
+static double total_ms;
+
+static void bench_play(struct gamestate* gstate, GameContext* ctx)
+{ ISMCTSReport report;
+  Action best;
+
+  if(!ismcts_choose_move(gstate, &bench_params, ctx, &best, &report)) return;
+  apply_action(gstate, gstate->player_to_move, &best, ctx);
+  total_iterations += report.iterations;
+  total_ms += report.elapsed_ms;
+}
+
+// Games won by ISMCTS, alternating seats
+static int play_games(int games, GameContext* ctx)
+{ StrategySet strategies;
+  struct gamestate g;
+  int wins = 0;
+
+  for(int i = 0; i < games; i++)
+  { PlayerID agent = (PlayerID)(i % 2);
+    set_player_strategy(&strategies, agent, bench_play, bench_play);
+    set_player_strategy(&strategies, 1 - agent, random_attack_strategy, random_defense_strategy);
+    setup_game(INITIAL_CASH_DEFAULT, &g, ctx);
+    g.turn = 0;
+    do
+      play_turn(NULL, &g, &strategies, ctx);
+    while(g.turn < MAX_NUMBER_OF_TURNS && !g.someone_has_zero_energy);
+    wins += g.someone_has_zero_energy &&
+            g.game_state == (agent == PLAYER_A ? PLAYER_A_WINS : PLAYER_B_WINS);
+  }
+  return wins;
+}
+
+int main(int argc, char** argv)
+{ long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+  int max_threads = (argc > 1) ? atoi(argv[1]) :
+                    (cpus < 1 ? 1 : cpus > MAX_DEFAULT_THREADS ? MAX_DEFAULT_THREADS : (int)cpus);
+  int games = (argc > 2) ? atoi(argv[2]) : DEFAULT_GAMES;
+  uint32_t ms_per_move = (argc > 3) ? (uint32_t)atoi(argv[3]) : DEFAULT_MS_PER_MOVE;
+  if(max_threads < 1 || max_threads > MAX_AI_SEARCH_THREADS || games < 1 || ms_per_move < 1)
+  { fprintf(stderr, "Usage: %s [max_threads (1-%d) [games [ms_per_move]]]\n",
+            argv[0], MAX_AI_SEARCH_THREADS);
+    return 1;
+  }
+
+  if(!combo_bonus_init())
+  { printf("Failed to build combo bonus tables\n");
+    return 1;
+  }
+  actions_init();
+  config_t cfg = {0};
+  cfg.prng_seed = 2024;
+  cfg.prng_backend = RND_BACKEND_XOSHIRO256;
+  GameContext* ctx = create_game_context(&cfg);
+
+  printf("ISMCTS vs random: %d games per row, %u ms per move, %ld CPU(s) online\n",
+         games, ms_per_move, cpus);
+  printf("%-6s %7s %12s %10s %8s\n", "mode", "threads", "iter/s", "iter/move", "win %");
+
+  for(int mode = AI_PARALLEL_ROOT; mode <= AI_PARALLEL_TREE; mode++)
+  { for(int threads = 1; threads <= max_threads; threads++)
+    { bench_params = (ISMCTSParams){UINT32_MAX, ms_per_move, ISMCTS_DEFAULT_EXPLORATION,
+                                    (uint32_t)threads, (ai_parallel_t)mode};
+      total_iterations = 0;
+      total_ms = 0.0;
+      int wins = play_games(games, ctx);
+      double moves = total_ms / ms_per_move;
+      printf("%-6s %7d %12.0f %10.0f %7.1f%%\n",
+             mode == AI_PARALLEL_ROOT ? "root" : "tree", threads,
+             total_ms > 0 ? total_iterations / (total_ms * 1e-3) : 0.0,
+             moves > 0 ? total_iterations / moves : 0.0, 100.0 * wins / games);
+    }
+  }
+
+  destroy_game_context(ctx);
+  return 0;
+}
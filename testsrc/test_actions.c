@@ -0,0 +1,320 @@
+// test_actions.c
+// Test suite for the engine action layer (actions/action.c): card equivalence
+// classes, legal action generation in full and distinct mode, validation
+// error codes, card conservation through apply_action and list overflow.
+
+#include "../src/actions/action.h"
+#include "../src/ai_strat/ai_strat_lib_search.h"
+#include "../src/core/combo_bonus.h"
+#include "../src/core/game_constants.h"
+#include "../src/core/game_context.h"
+#include "../src/core/game_state.h"
+#include "../src/core/turn_logic.h"
+#include "../src/util/rnd.h"
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_PASS "\033[32m✓ PASS\033[0m"
+#define TEST_FAIL "\033[31m✗ FAIL\033[0m"
+
+#define FIRST_DRAW2 102
+#define FIRST_DRAW3 111
+#define FIRST_CASH  117
+
+typedef struct
+{ const char* name;
+  int passed;
+  int failed;
+} TestSuite;
+
+void print_test_result(const char* test_name, int expected, int actual)
+{ if(expected == actual)
+  { printf("  %s: %s (expected %d, got %d)\n",
+           TEST_PASS, test_name, expected, actual);
+  }
+  else
+  { printf("  %s: %s (expected %d, got %d)\n",
+           TEST_FAIL, test_name, expected, actual);
+  }
+}
+
+static void check(TestSuite* suite, const char* name, int ok)
+{ print_test_result(name, 1, ok);
+  suite->passed += ok;
+  suite->failed += !ok;
+}
+
+// A fresh game at player A's first attack decision
+static void start_game(struct gamestate* g, GameContext* ctx)
+{ setup_game(INITIAL_CASH_DEFAULT, g, ctx);
+  g->turn = 0;
+  begin_of_turn(g, ctx);
+}
+
+// Every dealt card is in exactly one pile and 80 cards are in play
+static bool cards_conserved(const struct gamestate* g)
+{ int seen[FULL_DECK_SIZE] = {0};
+  int total = 0;
+  for(int p = 0; p < 2; p++)
+  { for(uint8_t i = 0; i < g->deck[p].size; i++, total++)
+      seen[g->deck[p].card_indices[i]]++;
+    for(uint8_t i = 0; i < g->hand[p].size; i++, total++)
+      seen[g->hand[p].cards[i]]++;
+    for(uint8_t i = 0; i < g->discard[p].size; i++, total++)
+      seen[g->discard[p].cards[i]]++;
+    for(uint8_t i = 0; i < g->combat_zone[p].size; i++, total++)
+      seen[g->combat_zone[p].cards[i]]++;
+  }
+  for(int c = 0; c < FULL_DECK_SIZE; c++)
+    if(seen[c] > 1) return false;
+  return total == 2 * MAX_DECK_STACK_SIZE;
+}
+
+static bool list_has_key(const ActionList* list, uint64_t key)
+{ for(uint16_t i = 0; i < list->count; i++)
+    if(action_key(&list->actions[i]) == key) return true;
+  return false;
+}
+
+static uint16_t binomial(uint8_t n, uint8_t k)
+{ if(k > n) return 0;
+  uint32_t r = 1;
+  for(uint8_t i = 1; i <= k; i++)
+    r = r * (n - k + i) / i;
+  return (uint16_t)r;
+}
+
+static uint8_t champions_in_discard(const struct gamestate* g, PlayerID p)
+{ uint8_t n = 0;
+  for(uint8_t i = 0; i < g->discard[p].size; i++)
+    n += fullDeck[g->discard[p].cards[i]].card_type == CHAMPION_CARD;
+  return n;
+}
+
+void test_card_classes(TestSuite* suite)
+{ printf("\n=== CARD EQUIVALENCE CLASSES ===\n");
+
+  bool draw2 = true, draw3 = true, cash = true, canonical = true;
+  for(uint8_t c = FIRST_DRAW2; c < FIRST_DRAW3; c++)
+    draw2 &= card_class(c) == FIRST_DRAW2;
+  for(uint8_t c = FIRST_DRAW3; c < FIRST_CASH; c++)
+    draw3 &= card_class(c) == FIRST_DRAW3;
+  for(uint8_t c = FIRST_CASH; c < FULL_DECK_SIZE; c++)
+    cash &= card_class(c) == FIRST_CASH;
+  for(uint8_t c = 0; c < FULL_DECK_SIZE; c++)
+    canonical &= card_class(c) <= c && card_class(card_class(c)) == card_class(c);
+
+  check(suite, "All draw2 cards share one class", draw2);
+  check(suite, "All draw3 cards share one class", draw3);
+  check(suite, "All cash cards share one class", cash);
+  check(suite, "Class is the lowest equivalent index", canonical);
+  check(suite, "Champions of different power differ", card_class(0) != card_class(1));
+}
+
+// Plays random games through the full action list and checks every decision
+void test_generation(TestSuite* suite, GameContext* ctx)
+{ printf("\n=== LEGAL ACTION GENERATION ===\n");
+
+  static ActionList full, distinct, singles;
+  full.options = ACTIONS_ALL;
+  distinct.options = ACTIONS_DISTINCT;
+  singles.options = ACTIONS_SINGLES_ONLY | ACTIONS_NO_RECALL | ACTIONS_AUTO_EXCHANGE;
+
+  bool valid = true, subset = true, unique = true, single_prefix = true;
+  bool recall_count = true, conserved = true, no_overflow = true;
+  int decisions = 0, recalls_played = 0;
+
+  for(int game = 0; game < 40; game++)
+  { struct gamestate g;
+    start_game(&g, ctx);
+
+    for(int step = 0; step < 400 && g.game_state == ACTIVE; step++, decisions++)
+    { PlayerID p = g.player_to_move;
+      generate_legal_actions(&g, p, &full);
+      generate_legal_actions(&g, p, &distinct);
+      generate_legal_actions(&g, p, &singles);
+      no_overflow &= !full.overflow && !distinct.overflow;
+
+      for(uint16_t i = 0; i < full.count; i++)
+      { valid &= validate_action(&g, p, &full.actions[i]) == ACTION_OK;
+        subset &= list_has_key(&distinct, action_key(&full.actions[i]));
+      }
+      for(uint16_t i = 0; i < distinct.count; i++)
+      { for(uint16_t j = i + 1; j < distinct.count; j++)
+          unique &= action_key(&distinct.actions[i]) != action_key(&distinct.actions[j]);
+      }
+
+      // Singles-only: pass plus one action per affordable card in the hand
+      single_prefix &= singles.count == singles.num_single + 1;
+      for(uint16_t i = 1; i < singles.count; i++)
+      { const Action* a = &singles.actions[i];
+        single_prefix &= (a->type == ACTION_CHAMPIONS && a->num_cards == 1) ||
+                         a->type == ACTION_DRAW || a->type == ACTION_CASH;
+      }
+
+      // Each affordable draw/recall card offers C(champions in discard, choose_num) recalls
+      if(p == g.current_player)
+      { uint8_t k = champions_in_discard(&g, p);
+        for(uint8_t h = 0; h < g.hand[p].size; h++)
+        { uint8_t c = g.hand[p].cards[h];
+          if(fullDeck[c].card_type != DRAW_CARD ||
+             fullDeck[c].cost > g.current_cash_balance[p]) continue;
+          uint16_t n = 0;
+          for(uint16_t i = 0; i < full.count; i++)
+            n += full.actions[i].type == ACTION_RECALL && full.actions[i].card == c;
+          recall_count &= n == binomial(k, fullDeck[c].choose_num);
+        }
+      }
+
+      const Action* a = &full.actions[RND_randn(full.count > 255 ? 255 : full.count, ctx)];
+      recalls_played += a->type == ACTION_RECALL;
+      do_move(&g, a, ctx);
+      conserved &= cards_conserved(&g);
+    }
+  }
+
+  printf("  (%d decisions, %d recalls played)\n", decisions, recalls_played);
+  check(suite, "Every generated action validates", valid);
+  check(suite, "Distinct list covers every action up to equivalence", subset);
+  check(suite, "Distinct list has no equivalent duplicates", unique);
+  check(suite, "Singles-only list is pass plus single-card actions", single_prefix);
+  check(suite, "Recall actions enumerate all champion choices", recall_count);
+  check(suite, "Recall actions were exercised", recalls_played > 0);
+  check(suite, "Cards conserved through apply_action", conserved);
+  check(suite, "No overflow in ordinary play", no_overflow);
+}
+
+void test_validation(TestSuite* suite, GameContext* ctx)
+{ printf("\n=== VALIDATION ===\n");
+
+  struct gamestate g;
+  start_game(&g, ctx);
+  PlayerID a = g.current_player;
+  PlayerID d = 1 - a;
+
+  Hand_clear(&g.hand[a]);
+  Hand_add(&g.hand[a], 0);             // cost 0 champion
+  Hand_add(&g.hand[a], 3);             // cost 1 champion
+  Hand_add(&g.hand[a], 98);            // expensive champion
+  Hand_add(&g.hand[a], FIRST_DRAW3);
+  Hand_add(&g.hand[a], FIRST_CASH);
+  Discard_clear(&g.discard[a]);
+  Discard_add(&g.discard[a], 5);
+  Discard_add(&g.discard[a], 6);
+  g.current_cash_balance[a] = 3;
+
+  Action pass = {ACTION_PASS, 0, 0, {0}};
+  Action one = {ACTION_CHAMPIONS, 0, 1, {0}};
+  Action dup = {ACTION_CHAMPIONS, 0, 2, {0, 0}};
+  Action missing = {ACTION_CHAMPIONS, 0, 1, {1}};
+  Action not_champion = {ACTION_CHAMPIONS, 0, 1, {FIRST_DRAW3}};
+  Action too_many = {ACTION_CHAMPIONS, 0, 4, {0}};
+  Action recall = {ACTION_RECALL, FIRST_DRAW3, 2, {5, 6}};
+  Action short_recall = {ACTION_RECALL, FIRST_DRAW3, 1, {5}};
+  Action recall_missing = {ACTION_RECALL, FIRST_DRAW3, 2, {5, 7}};
+  Action cash = {ACTION_CASH, FIRST_CASH, 1, {0}};
+  Action cash_draw = {ACTION_CASH, FIRST_CASH, 1, {FIRST_DRAW3}};
+  Action bad_type = {ACTION_TYPE_COUNT, 0, 0, {0}};
+
+  g.current_cash_balance[a] = 40;
+  Action expensive = {ACTION_CHAMPIONS, 0, 2, {3, 98}};
+  check(suite, "Affordable pair accepted", validate_action(&g, a, &expensive) == ACTION_OK);
+  g.current_cash_balance[a] = fullDeck[98].cost;
+  check(suite, "Unaffordable pair rejected", validate_action(&g, a, &expensive) == ACTION_ERR_COST);
+  g.current_cash_balance[a] = 3;
+
+  check(suite, "Pass accepted", validate_action(&g, a, &pass) == ACTION_OK);
+  check(suite, "Single champion accepted", validate_action(&g, a, &one) == ACTION_OK);
+  check(suite, "Duplicate champion rejected", validate_action(&g, a, &dup) == ACTION_ERR_DUPLICATE);
+  check(suite, "Card not in hand rejected", validate_action(&g, a, &missing) == ACTION_ERR_NOT_IN_HAND);
+  check(suite, "Draw card as champion rejected",
+        validate_action(&g, a, &not_champion) == ACTION_ERR_CARD_TYPE);
+  check(suite, "Four champions rejected", validate_action(&g, a, &too_many) == ACTION_ERR_CARD_COUNT);
+  check(suite, "Recall accepted", validate_action(&g, a, &recall) == ACTION_OK);
+  check(suite, "Recall needs choose_num champions",
+        validate_action(&g, a, &short_recall) == ACTION_ERR_CARD_COUNT);
+  check(suite, "Recall outside discard rejected",
+        validate_action(&g, a, &recall_missing) == ACTION_ERR_NOT_IN_DISCARD);
+  check(suite, "Cash exchange accepted", validate_action(&g, a, &cash) == ACTION_OK);
+  check(suite, "Cash exchange of a draw card rejected",
+        validate_action(&g, a, &cash_draw) == ACTION_ERR_CARD_TYPE);
+  check(suite, "Unknown type rejected", validate_action(&g, a, &bad_type) == ACTION_ERR_TYPE);
+
+  Hand_clear(&g.hand[d]);
+  Hand_add(&g.hand[d], FIRST_DRAW2);
+  Action defender_draw = {ACTION_DRAW, FIRST_DRAW2, 0, {0}};
+  check(suite, "Defender cannot play draw cards",
+        validate_action(&g, d, &defender_draw) == ACTION_ERR_TYPE);
+
+  g.game_state = DRAW;
+  check(suite, "Finished game rejects actions", validate_action(&g, a, &pass) == ACTION_ERR_GAME_OVER);
+}
+
+void test_overflow(TestSuite* suite, GameContext* ctx)
+{ printf("\n=== OVERFLOW ===\n");
+
+  static ActionList list;
+  struct gamestate g;
+  start_game(&g, ctx);
+  PlayerID a = g.current_player;
+
+  // Two draw3 cards choosing 2 of 40 champions: 2 * 780 recall actions
+  Hand_clear(&g.hand[a]);
+  Hand_add(&g.hand[a], FIRST_DRAW3);
+  Hand_add(&g.hand[a], FIRST_DRAW3 + 1);
+  Discard_clear(&g.discard[a]);
+  for(uint8_t c = 0; c < 40; c++)
+    Discard_add(&g.discard[a], c);
+  g.current_cash_balance[a] = 10;
+
+  list.options = ACTIONS_ALL;
+  generate_legal_actions(&g, a, &list);
+  check(suite, "Full recall list overflows", list.overflow && list.count == MAX_LEGAL_ACTIONS);
+
+  list.options = ACTIONS_DISTINCT;
+  generate_legal_actions(&g, a, &list);
+  check(suite, "Distinct recall list fits", !list.overflow && list.count == 1 + 1 + 780);
+
+  list.options = ACTIONS_NO_RECALL;
+  generate_legal_actions(&g, a, &list);
+  check(suite, "No-recall list is pass and two draws", !list.overflow && list.count == 3);
+}
+
+int main(void)
+{ TestSuite suite = {"Action Tests", 0, 0};
+
+  printf("\n");
+  printf("╔════════════════════════════════════════════╗\n");
+  printf("║  ORACLE ACTION LAYER TEST SUITE            ║\n");
+  printf("╚════════════════════════════════════════════╝\n");
+
+  if(!combo_bonus_init())
+  { printf("Failed to build combo bonus tables\n");
+    return 1;
+  }
+  actions_init();
+
+  config_t cfg = {0};
+  cfg.prng_seed = 2024;
+  cfg.prng_backend = RND_BACKEND_XOSHIRO256;
+  GameContext* ctx = create_game_context(&cfg);
+
+  test_card_classes(&suite);
+  test_generation(&suite, ctx);
+  test_validation(&suite, ctx);
+  test_overflow(&suite, ctx);
+
+  destroy_game_context(ctx);
+
+  printf("\n");
+  printf("╔════════════════════════════════════════════╗\n");
+  printf("║  TEST SUMMARY                              ║\n");
+  printf("╠════════════════════════════════════════════╣\n");
+  printf("║  Passed: %-3d                               ║\n", suite.passed);
+  printf("║  Failed: %-3d                               ║\n", suite.failed);
+  printf("║  Total:  %-3d                               ║\n",
+         suite.passed + suite.failed);
+  printf("╚════════════════════════════════════════════╝\n");
+
+  return suite.failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,213 @@
+// test_batch_sim.c
+// Test suite for the lockstep batch simulator (batch_sim.h): card
+// conservation in every lane, the same games from every instruction set's
+// kernels for the same seed, and run_simulation()'s random-vs-random
+// statistics the same with and without config.batch.
+
+#include "../src/ai_strat/ai_strategy.h"
+#include "../src/core/batch_sim.h"
+#include "../src/core/combo_bonus.h"
+#include "../src/core/game_constants.h"
+#include "../src/core/game_context.h"
+#include "../src/roles/stda/stda_auto.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_PASS "\033[32m✓ PASS\033[0m"
+#define TEST_FAIL "\033[31m✗ FAIL\033[0m"
+
+#define ISA_GAMES 2000
+#define STAT_GAMES 20000
+
+typedef struct
+{ const char* name;
+  int passed;
+  int failed;
+} TestSuite;
+
+void print_test_result(const char* test_name, int expected, int actual)
+{ if(expected == actual)
+  { printf("  %s: %s (expected %d, got %d)\n",
+           TEST_PASS, test_name, expected, actual);
+  }
+  else
+  { printf("  %s: %s (expected %d, got %d)\n",
+           TEST_FAIL, test_name, expected, actual);
+  }
+}
+
+static void check(TestSuite* suite, const char* name, int ok)
+{ print_test_result(name, 1, ok);
+  suite->passed += ok;
+  suite->failed += !ok;
+}
+
+typedef struct
+{ double turn_mean, turn_var;
+  double a_win_rate;
+  uint64_t games, draws;
+} GameStats;
+
+static void stats_add(GameStats* s, uint16_t turns, uint8_t game_state)
+{ s->games++;
+  s->turn_mean += turns;
+  s->turn_var += (double)turns * turns;
+  s->a_win_rate += game_state == PLAYER_A_WINS;
+  s->draws += game_state == DRAW;
+}
+
+// Each lane's deck, every card exactly once across the two players' piles
+// (combat zones are empty between turns)
+static int lane_cards_conserved(const BatchSim* bs, int l)
+{ uint8_t seen[FULL_DECK_SIZE] = {0};
+  int total = 0, ok = 1;
+  for(int p = 0; p < 2; p++)
+  { for(int k = 0; k < bs->hand_size[p][l]; k++, total++)
+      ok &= seen[bs->hand[p][k][l]]++ == 0;
+    for(int k = 0; k < bs->deck_size[p][l]; k++, total++)
+      ok &= seen[bs->deck[p][k][l]]++ == 0;
+    for(int k = 0; k < bs->discard_size[p][l]; k++, total++)
+      ok &= seen[bs->discard[p][k][l]]++ == 0;
+    ok &= bs->combat_size[p][l] == 0;
+    ok &= bs->hand_size[p][l] <= BATCH_HAND_SLOTS;
+  }
+  return ok && total == 2 * MAX_DECK_STACK_SIZE;
+}
+
+void test_conservation(TestSuite* suite)
+{ printf("\n=== CARD CONSERVATION ===\n");
+
+  BatchSim bs;
+  BatchResult results[BATCH_LANES];
+  batch_sim_init(&bs, 500, INITIAL_CASH_DEFAULT, 7, BATCH_ISA_AUTO);
+  int ok = 1, cash_ok = 1;
+  uint64_t finished = 0, steps = 0;
+  while(!batch_sim_done(&bs))
+  { finished += batch_sim_step(&bs, results);
+    steps++;
+    for(int l = 0; l < BATCH_LANES; l++)
+    { if(!bs.active[l]) continue;
+      ok &= lane_cards_conserved(&bs, l);
+      cash_ok &= bs.cash[PLAYER_A][l] >= 0 && bs.cash[PLAYER_B][l] >= 0;
+    }
+  }
+  printf("  %lu games in %lu steps (%s kernels)\n", (unsigned long)finished,
+         (unsigned long)steps, bs.kernels->name);
+  check(suite, "Every lane holds its 80 cards once each after every turn", ok);
+  check(suite, "Cash never negative", cash_ok);
+  check(suite, "Every game played and reported", finished == 500);
+}
+
+// Results in order, to compare runs: turns and outcome of each game
+static uint64_t run_digest(BatchIsa isa, uint64_t seed, GameStats* s)
+{ BatchSim bs;
+  BatchResult results[BATCH_LANES];
+  memset(s, 0, sizeof(*s));
+  batch_sim_init(&bs, ISA_GAMES, INITIAL_CASH_DEFAULT, seed, isa);
+  uint64_t digest = 14695981039346656037ULL;
+  while(!batch_sim_done(&bs))
+  { uint32_t n = batch_sim_step(&bs, results);
+    for(uint32_t i = 0; i < n; i++)
+    { stats_add(s, results[i].turns, results[i].game_state);
+      digest = (digest ^ ((uint64_t)results[i].turns << 8 | results[i].game_state)) *
+               1099511628211ULL;
+    }
+  }
+  return digest;
+}
+
+void test_isa_equivalence(TestSuite* suite)
+{ printf("\n=== KERNELS PER INSTRUCTION SET ===\n");
+
+  static const char* const names[BATCH_ISA_COUNT] = {"auto", "scalar", "avx2", "avx512"};
+  GameStats s;
+  uint64_t reference = run_digest(BATCH_ISA_SCALAR, 99, &s);
+  check(suite, "Scalar kernels supported", batch_sim_isa_supported(BATCH_ISA_SCALAR));
+  check(suite, "Scalar run plays every game", s.games == ISA_GAMES);
+  for(int isa = BATCH_ISA_AVX2; isa < BATCH_ISA_COUNT; isa++)
+  { char name[64];
+    if(!batch_sim_isa_supported(isa))
+    { printf("  %s: not supported on this CPU, skipped\n", names[isa]);
+      continue;
+    }
+    snprintf(name, sizeof(name), "%s plays the scalar games for the same seed", names[isa]);
+    check(suite, name, run_digest(isa, 99, &s) == reference);
+  }
+  check(suite, "A different seed plays different games",
+        run_digest(BATCH_ISA_SCALAR, 100, &s) != reference);
+}
+
+// run_simulation() of random vs random, by the engine or (cfg->batch) by the
+// batch simulator
+static GameStats simulated_games(config_t* cfg, StrategySet* strategies)
+{ GameContext* ctx = create_game_context(cfg);
+  struct gamestats gstats;
+  memset(&gstats, 0, sizeof(gstats));
+  run_simulation(STAT_GAMES, 0, INITIAL_CASH_DEFAULT, &gstats, strategies, ctx);
+  destroy_game_context(ctx);
+
+  GameStats s = {0};
+  s.games = gstats.simnum;
+  s.draws = gstats.cumul_number_of_draws;
+  s.turn_mean = gstats.turn_mean;
+  s.turn_var = gstats.simnum > 0 ? gstats.turn_m2 / gstats.simnum : 0.0;
+  s.a_win_rate = gstats.simnum > 0 ? (double)gstats.cumul_player_wins[PLAYER_A] / gstats.simnum : 0.0;
+  return s;
+}
+
+void test_statistics(TestSuite* suite, config_t* cfg, StrategySet* strategies)
+{ printf("\n=== RANDOM GAMES, ENGINE VS BATCH ===\n");
+
+  cfg->batch = false;
+  GameStats engine = simulated_games(cfg, strategies);
+  cfg->batch = true;
+  GameStats batch = simulated_games(cfg, strategies);
+  cfg->batch = false;
+
+  double turn_se = sqrt((engine.turn_var + batch.turn_var) / STAT_GAMES);
+  double win_se = sqrt((engine.a_win_rate * (1 - engine.a_win_rate) +
+                        batch.a_win_rate * (1 - batch.a_win_rate)) / STAT_GAMES);
+  printf("  engine: %.2f turns (sd %.2f), A wins %.1f%%; batch: %.2f turns (sd %.2f), "
+         "A wins %.1f%% (%d games each)\n", engine.turn_mean, sqrt(engine.turn_var),
+         100.0 * engine.a_win_rate, batch.turn_mean, sqrt(batch.turn_var),
+         100.0 * batch.a_win_rate, STAT_GAMES);
+  check(suite, "Batch recorded every game", batch.games == STAT_GAMES);
+  check(suite, "Game length matches (4 SE)", fabs(engine.turn_mean - batch.turn_mean) < 4 * turn_se);
+  check(suite, "Player A win rate matches (4 SE)",
+        fabs(engine.a_win_rate - batch.a_win_rate) < 4 * win_se);
+  // Sample variances of ~normal lengths: SE of the ratio ~ sqrt(4 / n)
+  double ratio = batch.turn_var / engine.turn_var;
+  check(suite, "Game length spread matches", fabs(ratio - 1.0) < 4 * sqrt(4.0 / STAT_GAMES));
+}
+
+int main(void)
+{ TestSuite suite = {"Batch Simulator Tests", 0, 0};
+
+  printf("\n=== ORACLE BATCH SIMULATOR TEST SUITE ===\n");
+
+  if(!combo_bonus_init())
+  { printf("Failed to build combo bonus tables\n");
+    return 1;
+  }
+  // The xoshiro backend: the legacy MT mapping of RND_randn() is biased, which
+  // shows in the engine's game lengths
+  config_t cfg = {0};
+  cfg.prng_seed = 2024;
+  cfg.prng_backend = RND_BACKEND_XOSHIRO256;
+  StrategySet* strategies = create_strategy_set();
+  set_player_strategy_by_type(strategies, PLAYER_A, AI_STRATEGY_RANDOM);
+  set_player_strategy_by_type(strategies, PLAYER_B, AI_STRATEGY_RANDOM);
+
+  test_conservation(&suite);
+  test_isa_equivalence(&suite);
+  test_statistics(&suite, &cfg, strategies);
+
+  free_strategy_set(strategies);
+
+  printf("\n=== TEST SUMMARY ===\n");
+  printf("Passed: %d, Failed: %d, Total: %d\n",
+         suite.passed, suite.failed, suite.passed + suite.failed);
+
+  return suite.failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,152 @@
+// test_card_catalog.c
+// Test suite for the generated card catalog (card_catalog.h): the catalog is
+// up to date with fullDeck's base fields, its PMFs agree with its means and
+// variances, fullDeck's float literals agree with it, and the pair synergies
+// are the combo bonuses.
+
+#include "../src/core/card_catalog.h"
+#include "../src/core/combo_bonus.h"
+#include "../src/core/game_constants.h"
+#include <math.h>
+#include <stdio.h>
+
+#define TEST_PASS "\033[32m✓ PASS\033[0m"
+#define TEST_FAIL "\033[31m✗ FAIL\033[0m"
+
+typedef struct
+{ const char* name;
+  int passed;
+  int failed;
+} TestSuite;
+
+void print_test_result(const char* test_name, int expected, int actual)
+{ if(expected == actual)
+  { printf("  %s: %s (expected %d, got %d)\n",
+           TEST_PASS, test_name, expected, actual);
+  }
+  else
+  { printf("  %s: %s (expected %d, got %d)\n",
+           TEST_FAIL, test_name, expected, actual);
+  }
+}
+
+static void check(TestSuite* suite, const char* name, int ok)
+{ print_test_result(name, 1, ok);
+  suite->passed += ok;
+  suite->failed += !ok;
+}
+
+void test_base_fields(TestSuite* suite)
+{ printf("\n=== CATALOG VS BASE FIELDS ===\n");
+
+  int means_ok = 1, cost_ok = 1, others_ok = 1;
+  for(int i = 0; i < FULL_DECK_SIZE; i++)
+  { const struct card* c = &fullDeck[i];
+    if(c->card_type != CHAMPION_CARD)
+    { others_ok &= card_attack_mean[i] == 0.0f && card_defense_mean[i] == 0.0f &&
+                   card_dice_var[i] == 0.0f;
+      continue;
+    }
+    int n = c->defense_dice;
+    means_ok &= card_defense_mean[i] == (n + 1) / 2.0f;
+    means_ok &= card_attack_mean[i] == c->attack_base + (n + 1) / 2.0f;
+    means_ok &= card_dice_var[i] == (n * n - 1) / 12.0f;
+    float cost = c->cost > 0 ? c->cost : 0.25f;
+    cost_ok &= fabsf(card_attack_per_cost[i] * cost - card_attack_mean[i]) < 1e-4f;
+    cost_ok &= fabsf(card_defense_per_cost[i] * cost - card_defense_mean[i]) < 1e-4f;
+  }
+  check(suite, "Champion means and V[Dn] from the dice and base", means_ok);
+  check(suite, "Per-cost metrics times cost give the means", cost_ok);
+  check(suite, "Draw and cash cards have no dice", others_ok);
+}
+
+void test_pmfs(TestSuite* suite)
+{ printf("\n=== DICE PMFS ===\n");
+
+  int sum_ok = 1, moments_ok = 1, empty_ok = 1;
+  for(int i = 0; i < FULL_DECK_SIZE; i++)
+  { double sum[2] = {0}, mean[2] = {0}, sq[2] = {0};
+    for(int x = 0; x < CARD_PMF_SIZE; x++)
+    { const float p[2] = {card_attack_pmf[i][x], card_defense_pmf[i][x]};
+      for(int k = 0; k < 2; k++)
+      { sum[k] += p[k];
+        mean[k] += p[k] * x;
+        sq[k] += p[k] * x * x;
+      }
+    }
+    if(fullDeck[i].card_type != CHAMPION_CARD)
+    { empty_ok &= sum[0] == 0.0 && sum[1] == 0.0;
+      continue;
+    }
+    const float expected_mean[2] = {card_attack_mean[i], card_defense_mean[i]};
+    for(int k = 0; k < 2; k++)
+    { sum_ok &= fabs(sum[k] - 1.0) < 1e-5;
+      moments_ok &= fabs(mean[k] - expected_mean[k]) < 1e-4;
+      moments_ok &= fabs(sq[k] - mean[k] * mean[k] - card_dice_var[i]) < 1e-3;
+    }
+  }
+  check(suite, "Champion PMFs sum to 1", sum_ok);
+  check(suite, "PMF means and variances match the catalog", moments_ok);
+  check(suite, "Draw and cash cards have empty PMFs", empty_ok);
+}
+
+void test_literals(TestSuite* suite)
+{ printf("\n=== FULLDECK LITERALS ===\n");
+
+  int ok = 1, rounded = 0;
+  for(int i = 0; i < FULL_DECK_SIZE; i++)
+  { const struct card* c = &fullDeck[i];
+    const float pairs[5][2] =
+    { {c->expected_attack, card_attack_mean[i]},
+      {c->expected_defense, card_defense_mean[i]},
+      {c->attack_efficiency, card_attack_per_cost[i]},
+      {c->defense_efficiency, card_defense_per_cost[i]},
+      {c->power, card_power[i]}
+    };
+    for(int k = 0; k < 5; k++)
+    { ok &= fabsf(pairs[k][0] - pairs[k][1]) <= 0.0051f;
+      rounded += pairs[k][0] != pairs[k][1];
+    }
+  }
+  printf("  %d literals rounded to 2 decimals\n", rounded);
+  check(suite, "Every literal within its rounding of the catalog", ok);
+}
+
+void test_synergy(TestSuite* suite)
+{ printf("\n=== PAIR SYNERGY ===\n");
+
+  int lookup_ok = 1, symmetric_ok = 1, some = 0;
+  for(uint8_t i = 0; i < CARD_CATALOG_CHAMPIONS; i++)
+    for(uint8_t j = 0; j < CARD_CATALOG_CHAMPIONS; j++)
+    { uint8_t pair[2] = {i, j};
+      lookup_ok &= card_pair_synergy[0][i][j] == combo_bonus_lookup(pair, 2, DECK_RANDOM);
+      lookup_ok &= card_pair_synergy[1][i][j] == combo_bonus_lookup(pair, 2, DECK_MONOCHROME);
+      symmetric_ok &= card_pair_synergy[0][i][j] == card_pair_synergy[0][j][i] &&
+                      card_pair_synergy[1][i][j] == card_pair_synergy[1][j][i];
+      some += card_pair_synergy[0][i][j] > 0;
+    }
+  check(suite, "Synergy is the pair's combo bonus under both rules", lookup_ok);
+  check(suite, "Synergy is symmetric", symmetric_ok);
+  check(suite, "Some pairs have a bonus", some > 0);
+}
+
+int main(void)
+{ TestSuite suite = {"Card Catalog Tests", 0, 0};
+
+  printf("\n=== ORACLE CARD CATALOG TEST SUITE ===\n");
+
+  if(!combo_bonus_init())
+  { printf("Failed to build combo bonus tables\n");
+    return 1;
+  }
+  test_base_fields(&suite);
+  test_pmfs(&suite);
+  test_literals(&suite);
+  test_synergy(&suite);
+
+  printf("\n=== TEST SUMMARY ===\n");
+  printf("Passed: %d, Failed: %d, Total: %d\n",
+         suite.passed, suite.failed, suite.passed + suite.failed);
+
+  return suite.failed > 0 ? 1 : 0;
+}
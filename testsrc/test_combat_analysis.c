@@ -0,0 +1,229 @@
+// test_combat_analysis.c
+// Test suite for the exact combat outcome distribution (core/combat_analysis.c):
+// every cached query is checked against brute-force enumeration of all dice
+// faces, with combo bonuses taken from the reference calculate_combo_bonus().
+
+#include "../src/core/combat_analysis.h"
+#include "../src/core/combo_bonus.h"
+#include "../src/core/game_constants.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_PASS "\033[32m✓ PASS\033[0m"
+#define TEST_FAIL "\033[31m✗ FAIL\033[0m"
+
+#define EPSILON 1e-9
+#define MAX_BRUTE_OUTCOMES 2000000L
+#define MAX_DIFF 128   // |total_attack - total_defense| stays well below this
+
+typedef struct
+{ const char* name;
+  int passed;
+  int failed;
+} TestSuite;
+
+void print_test_result(const char* test_name, int expected, int actual)
+{ if(expected == actual)
+  { printf("  %s: %s (expected %d, got %d)\n",
+           TEST_PASS, test_name, expected, actual);
+  }
+  else
+  { printf("  %s: %s (expected %d, got %d)\n",
+           TEST_FAIL, test_name, expected, actual);
+  }
+}
+
+static void check(TestSuite* suite, const char* name, int ok)
+{ print_test_result(name, 1, ok);
+  suite->passed += ok;
+  suite->failed += !ok;
+}
+
+static int reference_combo(const uint8_t* idx, int n)
+{ CombatCard cards[3];
+  for(int k = 0; k < n; k++)
+    cards[k] = (CombatCard)
+  { fullDeck[idx[k]].species, fullDeck[idx[k]].color, fullDeck[idx[k]].order
+  };
+  return calculate_combo_bonus(cards, n, DECK_RANDOM);
+}
+
+// Distribution of total_attack - total_defense by rolling every face of every die
+static void brute_force_pmf(const uint8_t* att, int na, const uint8_t* def, int nd,
+                            double pmf[2 * MAX_DIFF + 1])
+{ uint8_t sides[6];
+  int faces[6];
+  int n = na + nd;
+  double outcomes = 1.0;
+  int constant = reference_combo(att, na) - reference_combo(def, nd);
+
+  for(int i = 0; i < na; i++)
+  { sides[i] = fullDeck[att[i]].defense_dice;
+    constant += fullDeck[att[i]].attack_base;
+  }
+  for(int i = 0; i < nd; i++)
+    sides[na + i] = fullDeck[def[i]].defense_dice;
+  for(int i = 0; i < n; i++)
+  { faces[i] = 1;
+    outcomes *= sides[i];
+  }
+
+  memset(pmf, 0, (2 * MAX_DIFF + 1) * sizeof(double));
+  for(;;)
+  { int diff = constant;
+    for(int i = 0; i < n; i++)
+      diff += (i < na) ? faces[i] : -faces[i];
+    pmf[diff + MAX_DIFF] += 1.0 / outcomes;
+
+    // Odometer over all dice faces
+    int i = 0;
+    while(i < n && faces[i] == sides[i])
+      faces[i++] = 1;
+    if(i == n) break;
+    faces[i]++;
+  }
+}
+
+static long num_outcomes(const uint8_t* cards, int n)
+{ long total = 1;
+  for(int i = 0; i < n; i++)
+    total *= fullDeck[cards[i]].defense_dice;
+  return total;
+}
+
+void test_against_enumeration(TestSuite* suite)
+{ printf("\n=== EXACT QUERIES vs BRUTE-FORCE ENUMERATION ===\n");
+
+  uint8_t champions[FULL_DECK_SIZE];
+  int num_champions = 0;
+  for(int i = 0; i < FULL_DECK_SIZE; i++)
+  { if(fullDeck[i].card_type == CHAMPION_CARD)
+      champions[num_champions++] = (uint8_t)i;
+  }
+
+  int pmf_ok = 1, damage_ok = 1, variance_ok = 1, kill_ok = 1, loss_ok = 1;
+  int cases = 0;
+  uint32_t lcg = 12345;
+
+  while(cases < 400)
+  { uint8_t att[3], def[3];
+    lcg = lcg * 1664525u + 1013904223u;
+    int na = 1 + (lcg >> 8) % 3;
+    int nd = (lcg >> 12) % 4;
+    for(int i = 0; i < 3; i++)
+    { lcg = lcg * 1664525u + 1013904223u;
+      att[i] = champions[(lcg >> 8) % num_champions];
+      def[i] = champions[(lcg >> 20) % num_champions];
+    }
+    if(num_outcomes(att, na) * num_outcomes(def, nd) > MAX_BRUTE_OUTCOMES)
+      continue;
+    cases++;
+
+    double pmf[2 * MAX_DIFF + 1];
+    brute_force_pmf(att, na, def, nd, pmf);
+
+    CombatOutcome co;
+    if(!combat_outcome(att, (uint8_t)na, def, (uint8_t)nd, DECK_RANDOM, &co))
+    { pmf_ok = 0;
+      continue;
+    }
+
+    double m1 = 0.0, m2 = 0.0;
+    for(int d = -MAX_DIFF; d <= MAX_DIFF; d++)
+    { double p = pmf[d + MAX_DIFF];
+      pmf_ok &= fabs(combat_prob_diff(&co, (int16_t)d) - p) < EPSILON;
+      if(d > 0)
+      { m1 += d * p;
+        m2 += (double)d * d * p;
+      }
+    }
+    damage_ok &= fabs(combat_expected_damage(&co) - m1) < EPSILON;
+    variance_ok &= fabs(combat_damage_variance(&co) - (m2 - m1 * m1)) < 1e-7;
+
+    for(uint8_t energy = 0; energy <= 20; energy += 5)
+    { double kill = 0.0, loss = 0.0;
+      double loss_pmf[21] = {0}, got_pmf[21];
+      for(int d = -MAX_DIFF; d <= MAX_DIFF; d++)
+      { double p = pmf[d + MAX_DIFF];
+        int damage = d > 0 ? d : 0;
+        int lost = damage < energy ? damage : energy;
+        kill += (damage >= energy) ? p : 0.0;
+        loss += lost * p;
+        loss_pmf[lost] += p;
+      }
+      kill_ok &= fabs(combat_kill_probability(&co, energy) - kill) < EPSILON;
+      loss_ok &= fabs(combat_expected_energy_loss(&co, energy) - loss) < EPSILON;
+      combat_energy_loss_pmf(&co, energy, got_pmf);
+      for(int j = 0; j <= energy; j++)
+        loss_ok &= fabs(got_pmf[j] - loss_pmf[j]) < EPSILON;
+    }
+  }
+
+  check(suite, "P(attack - defense = d) matches enumeration", pmf_ok);
+  check(suite, "Expected damage matches enumeration", damage_ok);
+  check(suite, "Damage variance matches enumeration", variance_ok);
+  check(suite, "Kill probability matches enumeration", kill_ok);
+  check(suite, "Energy loss mean and PMF match enumeration", loss_ok);
+}
+
+void test_edge_cases(TestSuite* suite)
+{ printf("\n=== EDGE CASES ===\n");
+
+  uint8_t champion = 0;
+  while(fullDeck[champion].card_type != CHAMPION_CARD)
+    champion++;
+  uint8_t non_champion = 0;
+  while(fullDeck[non_champion].card_type == CHAMPION_CARD)
+    non_champion++;
+
+  CombatOutcome co;
+  uint8_t four[4] = {champion, champion, champion, champion};
+  check(suite, "Rejects more than 3 cards per side",
+        !combat_outcome(four, 4, four, 0, DECK_RANDOM, &co));
+  check(suite, "Rejects non-champion cards",
+        !combat_outcome(&non_champion, 1, four, 0, DECK_RANDOM, &co));
+
+  // Undefended attack always hits for at least base + 1
+  check(suite, "Undefended attack",
+        combat_outcome(&champion, 1, four, 0, DECK_RANDOM, &co) &&
+        fabs(combat_kill_probability(&co, fullDeck[champion].attack_base + 1) - 1.0)
+        < EPSILON);
+  check(suite, "Zero energy is always a kill",
+        combat_kill_probability(&co, 0) == 1.0);
+}
+
+int main(void)
+{ TestSuite suite = {"Combat Analysis Tests", 0, 0};
+
+  printf("\n");
+  printf("╔════════════════════════════════════════════╗\n");
+  printf("║  ORACLE COMBAT ANALYSIS TEST SUITE         ║\n");
+  printf("╚════════════════════════════════════════════╝\n");
+
+  if(!combo_bonus_init())
+  { printf("Failed to build combo bonus tables\n");
+    return 1;
+  }
+  if(!combat_analysis_init())
+  { printf("Failed to build combat analysis tables\n");
+    return 1;
+  }
+
+  test_against_enumeration(&suite);
+  test_edge_cases(&suite);
+
+  combat_analysis_free();
+
+  printf("\n");
+  printf("╔════════════════════════════════════════════╗\n");
+  printf("║  TEST SUMMARY                              ║\n");
+  printf("╠════════════════════════════════════════════╣\n");
+  printf("║  Passed: %-3d                               ║\n", suite.passed);
+  printf("║  Failed: %-3d                               ║\n", suite.failed);
+  printf("║  Total:  %-3d                               ║\n",
+         suite.passed + suite.failed);
+  printf("╚════════════════════════════════════════════╝\n");
+
+  return suite.failed > 0 ? 1 : 0;
+}
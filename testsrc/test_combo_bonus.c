@@ -295,6 +295,63 @@ void test_main_function(TestSuite *suite)
   suite->failed += (bonus != 0);
 }
 
+// Exhaustive check of the lookup table against calculate_combo_bonus() for
+// every ordered pair and triple of fullDeck champion indices, both rule sets
+void test_lookup_table(TestSuite *suite)
+{ printf("\n=== LOOKUP TABLE vs REFERENCE (all combinations) ===\n");
+  bool built = combo_bonus_init();
+  print_test_result("Tables built", 1, built);
+  suite->passed += built;
+  suite->failed += !built;
+  if(!built) return;
+
+  const DeckType rules[2] = {DECK_RANDOM, DECK_MONOCHROME};
+  const char* names[2][2] =
+  { {"Random rules, all pairs", "Random rules, all triples"},
+    {"Prebuilt rules, all pairs", "Prebuilt rules, all triples"}
+  };
+
+  uint8_t champions[FULL_DECK_SIZE];
+  int num_champions = 0;
+  for(int i = 0; i < FULL_DECK_SIZE; i++)
+  { if(fullDeck[i].card_type == CHAMPION_CARD)
+      champions[num_champions++] = (uint8_t)i;
+  }
+
+  for(int r = 0; r < 2; r++)
+  { int pair_mismatches = 0;
+    int triple_mismatches = 0;
+
+    for(int a = 0; a < num_champions; a++)
+      for(int b = 0; b < num_champions; b++)
+      { uint8_t idx[3] = { champions[a], champions[b] };
+        CombatCard cards[3];
+        for(int k = 0; k < 2; k++)
+          cards[k] = (CombatCard)
+        { fullDeck[idx[k]].species, fullDeck[idx[k]].color, fullDeck[idx[k]].order
+        };
+        pair_mismatches += (combo_bonus_lookup(idx, 2, rules[r]) !=
+                            calculate_combo_bonus(cards, 2, rules[r]));
+
+        for(int c = 0; c < num_champions; c++)
+        { idx[2] = champions[c];
+          cards[2] = (CombatCard)
+          { fullDeck[idx[2]].species, fullDeck[idx[2]].color, fullDeck[idx[2]].order
+          };
+          triple_mismatches += (combo_bonus_lookup(idx, 3, rules[r]) !=
+                                calculate_combo_bonus(cards, 3, rules[r]));
+        }
+      }
+
+    print_test_result(names[r][0], 0, pair_mismatches);
+    suite->passed += (pair_mismatches == 0);
+    suite->failed += (pair_mismatches != 0);
+    print_test_result(names[r][1], 0, triple_mismatches);
+    suite->passed += (triple_mismatches == 0);
+    suite->failed += (triple_mismatches != 0);
+  }
+}
+
 int main(void)
 { TestSuite suite = {"Combo Bonus Tests", 0, 0};
 
@@ -313,6 +370,7 @@ int main(void)
   test_random_distribution(&suite);
   test_prebuilt_distribution(&suite);
   test_main_function(&suite);
+  test_lookup_table(&suite);
 
   printf("\n");
   printf("╔════════════════════════════════════════════╗\n");
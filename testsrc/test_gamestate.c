@@ -0,0 +1,371 @@
+// test_gamestate.c
+// Test suite for the packed game state: cache-line layout, clone_gamestate()
+// independence, and card-location membership (bitset or scan, depending on
+// GAMESTATE_CARD_BITSETS) staying consistent through card moves; and binary
+// snapshots (core/game_snapshot.c) of positions and PRNG state, alone and in
+// memory-mapped snapshot files.
+
+#include "../src/core/game_state.h"
+#include "../src/core/game_constants.h"
+#include "../src/core/game_context.h"
+#include "../src/core/game_snapshot.h"
+#include "../src/core/zobrist.h"
+#include "../src/util/rnd.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define TEST_PASS "\033[32m✓ PASS\033[0m"
+#define TEST_FAIL "\033[31m✗ FAIL\033[0m"
+
+typedef struct
+{ const char* name;
+  int passed;
+  int failed;
+} TestSuite;
+
+void print_test_result(const char* test_name, int expected, int actual)
+{ if(expected == actual)
+  { printf("  %s: %s (expected %d, got %d)\n",
+           TEST_PASS, test_name, expected, actual);
+  }
+  else
+  { printf("  %s: %s (expected %d, got %d)\n",
+           TEST_FAIL, test_name, expected, actual);
+  }
+}
+
+static void check(TestSuite* suite, const char* name, int ok)
+{ print_test_result(name, 1, ok);
+  suite->passed += ok;
+  suite->failed += !ok;
+}
+
+void test_layout(TestSuite* suite)
+{ printf("\n=== LAYOUT ===\n");
+
+#if defined(GAMESTATE_CARD_BITSETS)
+  const int expected_size = 448;
+#else
+  const int expected_size = 256;
+#endif
+  print_test_result("sizeof(struct gamestate)", expected_size, (int)sizeof(struct gamestate));
+  suite->passed += (sizeof(struct gamestate) == expected_size);
+  suite->failed += (sizeof(struct gamestate) != expected_size);
+
+  check(suite, "Aligned to a cache line",
+        _Alignof(struct gamestate) == GAMESTATE_ALIGNMENT);
+
+  struct gamestate states[2];
+  check(suite, "Array elements start on cache lines",
+        ((uintptr_t)&states[1] % GAMESTATE_ALIGNMENT) == 0);
+}
+
+void test_clone(TestSuite* suite, GameContext* ctx)
+{ printf("\n=== CLONE ===\n");
+
+  struct gamestate src, dst;
+  setup_game(INITIAL_CASH_DEFAULT, &src, ctx);
+  clone_gamestate(&dst, &src);
+  check(suite, "Clone is byte-identical", memcmp(&dst, &src, sizeof(src)) == 0);
+
+  struct gamestate before;
+  clone_gamestate(&before, &src);
+  uint8_t card = DeckStk_pop(&dst.deck[PLAYER_A]);
+  Hand_add(&dst.hand[PLAYER_A], card);
+  dst.current_energy[PLAYER_B] = 1;
+  check(suite, "Mutating the clone leaves the source intact",
+        memcmp(&before, &src, sizeof(src)) == 0);
+  check(suite, "Clone holds the moved card",
+        Hand_contains(&dst.hand[PLAYER_A], card) &&
+        !DeckStk_contains(&dst.deck[PLAYER_A], card) &&
+        DeckStk_contains(&src.deck[PLAYER_A], card));
+}
+
+static bool scan(const uint8_t* cards, uint8_t size, uint8_t card)
+{ for(uint8_t i = 0; i < size; i++)
+    if(cards[i] == card) return true;
+  return false;
+}
+
+// Every *_contains() answer must match a scan of the arrays, and every dealt
+// card must be in exactly one place
+static bool locations_consistent(const struct gamestate* g)
+{ for(int card = 0; card < FULL_DECK_SIZE; card++)
+  { int places = 0;
+    for(int p = 0; p < 2; p++)
+    { bool in[4] =
+      { scan(g->deck[p].card_indices, g->deck[p].size, card),
+        scan(g->hand[p].cards, g->hand[p].size, card),
+        scan(g->discard[p].cards, g->discard[p].size, card),
+        scan(g->combat_zone[p].cards, g->combat_zone[p].size, card)
+      };
+      if(DeckStk_contains(&g->deck[p], card) != in[0] ||
+         Hand_contains(&g->hand[p], card) != in[1] ||
+         Discard_contains(&g->discard[p], card) != in[2] ||
+         CombatZone_contains(&g->combat_zone[p], card) != in[3])
+        return false;
+      places += in[0] + in[1] + in[2] + in[3];
+    }
+    if(places > 1) return false;
+  }
+  return true;
+}
+
+// One random card move, through one of the collection operations
+static void random_card_move(struct gamestate* g, GameContext* ctx)
+{ PlayerID p = RND_randn(2, ctx);
+  switch(RND_randn(5, ctx))
+  { case 0:
+      if(!DeckStk_isEmpty(&g->deck[p]) && g->hand[p].size < 12)
+        Hand_add(&g->hand[p], DeckStk_pop(&g->deck[p]));
+      break;
+    case 1:
+      if(g->hand[p].size > 0 && g->combat_zone[p].size < 3)
+      { uint8_t card = g->hand[p].cards[RND_randn(g->hand[p].size, ctx)];
+        Hand_remove(&g->hand[p], card);
+        CombatZone_add(&g->combat_zone[p], card);
+      }
+      break;
+    case 2:
+      for(uint8_t i = 0; i < g->combat_zone[p].size; i++)
+        Discard_add(&g->discard[p], g->combat_zone[p].cards[i]);
+      CombatZone_clear(&g->combat_zone[p]);
+      break;
+    case 3:
+      if(g->hand[p].size > 0)
+      { uint8_t card = g->hand[p].cards[RND_randn(g->hand[p].size, ctx)];
+        Hand_remove(&g->hand[p], card);
+        Discard_add(&g->discard[p], card);
+      }
+      break;
+    default:
+      if(DeckStk_isEmpty(&g->deck[p]))
+      { for(uint8_t i = 0; i < g->discard[p].size; i++)
+          DeckStk_push(&g->deck[p], g->discard[p].cards[i]);
+        Discard_clear(&g->discard[p]);
+      }
+      else if(g->discard[p].size > 0)
+      { uint8_t card = g->discard[p].cards[0];
+        Discard_remove(&g->discard[p], card);
+        Hand_add(&g->hand[p], card);
+        if(!Hand_contains(&g->hand[p], card))
+          Discard_add(&g->discard[p], card);  // hand was full
+      }
+  }
+} // random_card_move
+
+void test_membership(TestSuite* suite, GameContext* ctx)
+{ printf("\n=== CARD LOCATION MEMBERSHIP ===\n");
+
+  struct gamestate g;
+  setup_game(INITIAL_CASH_DEFAULT, &g, ctx);
+  bool ok = locations_consistent(&g);
+
+  // Random walk of card moves through every collection operation
+  for(int step = 0; step < 5000 && ok; step++)
+  { random_card_move(&g, ctx);
+    ok = locations_consistent(&g);
+  }
+
+#ifdef GAMESTATE_CARD_BITSETS
+  check(suite, "Bitsets agree with the arrays through 5000 moves", ok);
+#else
+  check(suite, "Scans agree with the arrays through 5000 moves", ok);
+#endif
+}
+
+// Same position: scalars and the cards of every zone, in order
+static bool same_position(const struct gamestate* a, const struct gamestate* b)
+{ bool same = memcmp(a->current_cash_balance, b->current_cash_balance, sizeof(a->current_cash_balance)) == 0 &&
+              a->turn == b->turn && a->current_player == b->current_player &&
+              a->player_to_move == b->player_to_move && a->game_state == b->game_state &&
+              a->turn_phase == b->turn_phase &&
+              memcmp(a->current_energy, b->current_energy, sizeof(a->current_energy)) == 0 &&
+              a->someone_has_zero_energy == b->someone_has_zero_energy;
+  for(int p = 0; p < 2 && same; p++)
+    same = a->deck[p].size == b->deck[p].size && a->hand[p].size == b->hand[p].size &&
+           a->discard[p].size == b->discard[p].size && a->combat_zone[p].size == b->combat_zone[p].size &&
+           memcmp(a->deck[p].card_indices, b->deck[p].card_indices, a->deck[p].size) == 0 &&
+           memcmp(a->hand[p].cards, b->hand[p].cards, a->hand[p].size) == 0 &&
+           memcmp(a->discard[p].cards, b->discard[p].cards, a->discard[p].size) == 0 &&
+           memcmp(a->combat_zone[p].cards, b->combat_zone[p].cards, a->combat_zone[p].size) == 0;
+  return same;
+}
+
+// A mid-game position: random card moves and scalars
+static void random_position(struct gamestate* g, GameContext* ctx)
+{ setup_game(INITIAL_CASH_DEFAULT, g, ctx);
+  int moves = RND_randn(200, ctx);
+  for(int i = 0; i < moves; i++)
+    random_card_move(g, ctx);
+  g->turn = RND_randn(200, ctx);
+  g->current_player = RND_randn(2, ctx);
+  g->player_to_move = RND_randn(2, ctx);
+  g->turn_phase = RND_randn(2, ctx);
+  g->current_cash_balance[PLAYER_B] = 1000 + RND_randn(200, ctx);
+  g->current_energy[PLAYER_A] = RND_randn(100, ctx);
+  zobrist_refresh(g);
+}
+
+void test_snapshot(TestSuite* suite, GameContext* ctx)
+{ printf("\n=== SNAPSHOTS ===\n");
+
+  uint8_t record[GAMESTATE_SNAPSHOT_MT_BYTES], again[GAMESTATE_SNAPSHOT_MT_BYTES];
+  bool same = true, canonical = true, consistent = true, keys = true;
+  for(int i = 0; i < 500; i++)
+  { struct gamestate g, loaded;
+    random_position(&g, ctx);
+    size_t size = gamestate_serialize(&g, NULL, record);
+    same &= size == GAMESTATE_SNAPSHOT_BYTES &&
+            gamestate_deserialize(record, size, &loaded, NULL) && same_position(&g, &loaded);
+    canonical &= gamestate_serialize(&loaded, NULL, again) == size && memcmp(record, again, size) == 0;
+    consistent &= locations_consistent(&loaded);
+    keys &= gamestate_key(&loaded) == gamestate_key(&g) && gamestate_key(&g) == zobrist_compute(&g);
+  }
+  check(suite, "Positions survive a round trip", same);
+  check(suite, "Encoding is canonical", canonical);
+  check(suite, "Loaded membership is consistent", consistent);
+  check(suite, "Loaded key is the saved one's", keys);
+
+  // The PRNG picks up where it was saved, with either backend, and a state
+  // of the other backend is switched over
+  bool streams = true;
+  for(RndBackend backend = RND_BACKEND_MT19937; backend < RND_BACKEND_COUNT; backend++)
+  { RndState saved, loaded, other;
+    RND_init(&saved, backend, 77);
+    for(int i = 0; i < 1000; i++)
+      RND_next32(&saved);
+    memset(&loaded, 0, sizeof(loaded));
+    RND_init(&other, backend == RND_BACKEND_MT19937 ? RND_BACKEND_XOSHIRO256 : RND_BACKEND_MT19937, 5);
+
+    struct gamestate g, out;
+    random_position(&g, ctx);
+    size_t size = gamestate_serialize(&g, &saved, record);
+    streams &= size == gamestate_snapshot_size(backend) &&
+               gamestate_deserialize(record, size, &out, &loaded) &&
+               gamestate_deserialize(record, size, &out, &other) &&
+               loaded.backend == backend && other.backend == backend && loaded.seed == 77;
+    for(int i = 0; i < 2000 && streams; i++)
+    { uint32_t x = RND_next32(&saved);
+      streams = RND_next32(&loaded) == x && RND_next32(&other) == x;
+    }
+    RND_release(&saved);
+    RND_release(&loaded);
+    RND_release(&other);
+  }
+  check(suite, "PRNG state resumes its sequence", streams);
+
+  struct gamestate g, out;
+  random_position(&g, ctx);
+  size_t size = gamestate_serialize(&g, NULL, record);
+  memcpy(again, record, size);
+  again[0]++;
+  bool rejected = !gamestate_deserialize(again, size, &out, NULL);
+  memcpy(again, record, size);
+  again[19] = FULL_DECK_SIZE;   // first card of A's deck
+  again[18] = 1;
+  rejected &= !gamestate_deserialize(again, size, &out, NULL);
+  memcpy(again, record, size);
+  again[18] = MAX_DECK_STACK_SIZE + 1;
+  rejected &= !gamestate_deserialize(again, size, &out, NULL);
+  rejected &= !gamestate_deserialize(record, size - 1, &out, NULL);
+  check(suite, "Bad records rejected", rejected);
+}
+
+void test_snapshot_file(TestSuite* suite, GameContext* ctx)
+{ printf("\n=== SNAPSHOT FILES ===\n");
+
+  char path[] = "/tmp/test_snapshot_XXXXXX";
+  int fd = mkstemp(path);
+  if(fd < 0)
+  { perror("mkstemp");
+    return;
+  }
+  close(fd);
+
+  enum { COUNT = 3000 };
+  static struct gamestate saved[COUNT];
+  GameSnapshotWriter* writer = game_snapshot_file_create(path, RND_BACKEND_XOSHIRO256);
+  bool added = writer != NULL;
+  for(uint64_t k = 0; k < COUNT && added; k++)
+  { random_position(&saved[k], ctx);
+    added = game_snapshot_file_add(writer, &saved[k], &ctx->rng, 1000 + k);
+  }
+  check(suite, "PRNG of another backend refused", !game_snapshot_file_add(writer, &saved[0], NULL, 0));
+  check(suite, "Snapshot file written", added && game_snapshot_file_close(writer));
+
+  GameSnapshotReader reader;
+  bool ok = game_snapshot_file_open(path, &reader);
+  check(suite, "Snapshot file opens", ok && reader.num_snapshots == COUNT &&
+        reader.header->rng_backend == RND_BACKEND_XOSHIRO256);
+
+  // Random access, index included
+  bool loaded = ok, indexed = ok;
+  RndState rng;
+  memset(&rng, 0, sizeof(rng));
+  for(int i = 0; i < 500 && ok; i++)
+  { uint64_t k = RND_randn(250, ctx) * (COUNT / 250) + RND_randn(COUNT / 250, ctx);
+    struct gamestate g;
+    loaded &= game_snapshot_load(&reader, k, &g, &rng) && same_position(&g, &saved[k]) &&
+              rng.backend == RND_BACKEND_XOSHIRO256;
+    const GameSnapshotIndex* entry = &reader.index[k];
+    indexed &= entry->tag == 1000 + k && entry->turn == saved[k].turn &&
+               entry->key == gamestate_key(&saved[k]);
+  }
+  RND_release(&rng);
+  check(suite, "Any position loads from the map", loaded);
+  check(suite, "Index describes each position", indexed);
+  check(suite, "Out of range position", ok && game_snapshot_record(&reader, COUNT) == NULL);
+  size_t file_size = reader.size;
+  if(ok) game_snapshot_reader_close(&reader);
+
+  check(suite, "Truncated file rejected", truncate(path, file_size - 1) == 0 &&
+        !game_snapshot_file_open(path, &reader));
+  writer = game_snapshot_file_create(path, RND_BACKEND_COUNT);
+  game_snapshot_file_add(writer, &saved[0], NULL, 0);
+  fflush(writer->file);
+  check(suite, "Unclosed file rejected", !game_snapshot_file_open(path, &reader));
+  game_snapshot_file_close(writer);
+  check(suite, "File without PRNG state", game_snapshot_file_open(path, &reader) &&
+        reader.header->record_size == GAMESTATE_SNAPSHOT_BYTES &&
+        game_snapshot_load(&reader, 0, &saved[1], NULL));
+  game_snapshot_reader_close(&reader);
+  unlink(path);
+}
+
+int main(void)
+{ TestSuite suite = {"Game State Tests", 0, 0};
+
+  printf("\n");
+  printf("╔════════════════════════════════════════════╗\n");
+  printf("║  ORACLE GAME STATE TEST SUITE              ║\n");
+  printf("╚════════════════════════════════════════════╝\n");
+
+  config_t cfg = {0};
+  cfg.prng_seed = 2024;
+  cfg.prng_backend = RND_BACKEND_XOSHIRO256;
+  GameContext* ctx = create_game_context(&cfg);
+  zobrist_init();
+
+  test_layout(&suite);
+  test_clone(&suite, ctx);
+  test_membership(&suite, ctx);
+  test_snapshot(&suite, ctx);
+  test_snapshot_file(&suite, ctx);
+
+  destroy_game_context(ctx);
+
+  printf("\n");
+  printf("╔════════════════════════════════════════════╗\n");
+  printf("║  TEST SUMMARY                              ║\n");
+  printf("╠════════════════════════════════════════════╣\n");
+  printf("║  Passed: %-3d                               ║\n", suite.passed);
+  printf("║  Failed: %-3d                               ║\n", suite.failed);
+  printf("║  Total:  %-3d                               ║\n",
+         suite.passed + suite.failed);
+  printf("╚════════════════════════════════════════════╝\n");
+
+  return suite.failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,338 @@
+// test_heuristic.c
+// Test suite for the heuristic agent (strat_heuristic1) and its evaluation
+// (ai_strat_lib_heuristics): advantage terms updated from a move's delta
+// against a full rescan of the position after the move, the expected combat
+// damage against exact dice enumeration, the choice of the best-scoring legal
+// move, rollouts, and play strength against the random agent.
+
+#include "../src/actions/action.h"
+#include "../src/ai_strat/ai_strat_heuristic1.h"
+#include "../src/ai_strat/ai_strat_random.h"
+#include "../src/ai_strat/ai_strategy.h"
+#include "../src/core/combat.h"
+#include "../src/core/combo_bonus.h"
+#include "../src/core/game_constants.h"
+#include "../src/core/game_context.h"
+#include "../src/core/game_state.h"
+#include "../src/core/turn_logic.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_PASS "\033[32m✓ PASS\033[0m"
+#define TEST_FAIL "\033[31m✗ FAIL\033[0m"
+
+#define NUM_POSITIONS 400
+#define STRENGTH_GAMES 200
+
+typedef struct
+{ const char* name;
+  int passed;
+  int failed;
+} TestSuite;
+
+void print_test_result(const char* test_name, int expected, int actual)
+{ if(expected == actual)
+  { printf("  %s: %s (expected %d, got %d)\n",
+           TEST_PASS, test_name, expected, actual);
+  }
+  else
+  { printf("  %s: %s (expected %d, got %d)\n",
+           TEST_FAIL, test_name, expected, actual);
+  }
+}
+
+static void check(TestSuite* suite, const char* name, int ok)
+{ print_test_result(name, 1, ok);
+  suite->passed += ok;
+  suite->failed += !ok;
+}
+
+// Decision points of random-vs-random games: attacks at turn start, and
+// defenses after the attacker has put champions out
+static struct gamestate positions[NUM_POSITIONS];
+
+static void collect_positions(GameContext* ctx)
+{ StrategySet strategies = {{random_attack_strategy, random_attack_strategy},
+                              {random_defense_strategy, random_defense_strategy}};
+  int n = 0;
+  while(n < NUM_POSITIONS)
+  { struct gamestate g;
+    setup_game(INITIAL_CASH_DEFAULT, &g, ctx);
+    g.turn = 0;
+    do
+    { begin_of_turn(&g, ctx);
+      if(n < NUM_POSITIONS && RND_randn(3, ctx) == 0)
+        clone_gamestate(&positions[n++], &g);
+      attack_phase(&g, &strategies, ctx);
+      if(g.combat_zone[g.current_player].size > 0)
+      { g.turn_phase = DEFENSE;
+        g.player_to_move = 1 - g.current_player;
+        if(n < NUM_POSITIONS && RND_randn(3, ctx) == 0)
+          clone_gamestate(&positions[n++], &g);
+        defense_phase(&g, &strategies, ctx);
+        resolve_combat(&g, ctx);
+      }
+      if(!g.someone_has_zero_energy)
+        end_of_turn(&g, ctx);
+    }
+    while(g.turn < MAX_NUMBER_OF_TURNS && !g.someone_has_zero_energy);
+  }
+}
+
+static int same_terms(const HeuristicTerms* a, const HeuristicTerms* b)
+{ int ok = a->attacker == b->attacker;
+  for(int p = 0; p < 2; p++)
+  { ok &= a->energy[p] == b->energy[p] && a->cash[p] == b->cash[p] && a->cards[p] == b->cards[p];
+    ok &= a->zone_size[p] == b->zone_size[p];
+    for(int k = 0; k < a->zone_size[p]; k++)
+      ok &= a->zone[p][k] == b->zone[p][k];
+    ok &= fabsf(a->zone_mean[p] - b->zone_mean[p]) < 1e-4f;
+    ok &= fabsf(a->zone_var[p] - b->zone_var[p]) < 1e-4f;
+  }
+  return ok;
+}
+
+void test_incremental_terms(TestSuite* suite, GameContext* ctx)
+{ printf("\n=== INCREMENTAL TERMS VS FULL RESCAN ===\n");
+
+  ActionList moves;
+  uint32_t num_moves = 0, num_draws = 0;
+  int ok = 1, draws_ok = 1;
+  for(int i = 0; i < NUM_POSITIONS; i++)
+  { const struct gamestate* g = &positions[i];
+    PlayerID player = g->player_to_move;
+    HeuristicTerms root;
+    heuristic_terms_init(&root, g);
+    moves.options = ACTIONS_NO_RECALL | ACTIONS_AUTO_EXCHANGE;
+    generate_legal_actions(g, player, &moves);
+    for(uint16_t m = 0; m < moves.count; m++)
+    { const Action* action = &moves.actions[m];
+      HeuristicTerms delta = root, rescan;
+      heuristic_terms_apply(&delta, player, action);
+
+      struct gamestate scratch;
+      clone_gamestate(&scratch, g);
+      apply_action(&scratch, player, action, ctx);
+      heuristic_terms_init(&rescan, &scratch);
+      if(action->type != ACTION_DRAW)
+        ok &= same_terms(&delta, &rescan);
+      else
+      { // Drawn cards can run out (deck and discard both short)
+        uint8_t draw_num = fullDeck[action->card].draw_num;
+        if(g->deck[player].size + g->discard[player].size >= draw_num)
+        { draws_ok &= same_terms(&delta, &rescan);
+          num_draws++;
+        }
+      }
+      num_moves++;
+    }
+  }
+  printf("  %u moves from %d positions (%u draws)\n", num_moves, NUM_POSITIONS, num_draws);
+  check(suite, "Champion, cash and pass deltas match a rescan", ok);
+  check(suite, "Draw deltas match a rescan", draws_ok && num_draws > 0);
+}
+
+// Exact E[min(max(A - D, 0), energy)] and P(A - D >= energy) for attacker
+// dice plus a constant against defender dice, by convolution
+static void exact_damage(const uint8_t* att, int n_att, int att_const, const uint8_t* def,
+                         int n_def, int energy, double* damage, double* kill)
+{ double dist[128] = {0}, next[128];
+  int offset = 64;
+  dist[offset + att_const] = 1.0;
+  for(int i = 0; i < n_att + n_def; i++)
+  { int sides = i < n_att ? att[i] : def[i - n_att];
+    int sign = i < n_att ? 1 : -1;
+    memset(next, 0, sizeof(next));
+    for(int x = 0; x < 128; x++)
+    { if(dist[x] == 0.0) continue;
+      for(int r = 1; r <= sides; r++)
+        next[x + sign * r] += dist[x] / sides;
+    }
+    memcpy(dist, next, sizeof(dist));
+  }
+  *damage = *kill = 0.0;
+  for(int x = 0; x < 128; x++)
+  { int diff = x - offset;
+    if(diff > 0)
+      *damage += dist[x] * (diff < energy ? diff : energy);
+    if(diff >= energy)
+      *kill += dist[x];
+  }
+}
+
+// Index of the first champion with the given dice and base
+static uint8_t find_champion(uint8_t dice, uint8_t base)
+{ for(uint8_t i = 0; i < FULL_DECK_SIZE; i++)
+    if(fullDeck[i].card_type == CHAMPION_CARD && fullDeck[i].defense_dice == dice &&
+       fullDeck[i].attack_base == base)
+      return i;
+  return 0;
+}
+
+void test_combat_expectation(TestSuite* suite)
+{ printf("\n=== EXPECTED COMBAT VS EXACT DICE ===\n");
+
+  // Weights off but for energy; cash, always weighted 1, is taken out below
+  const HeuristicParams energy_only = {1.0, 0.0, 0.0, 0.0};
+  const HeuristicParams energy_and_kill = {1.0, 0.0, 0.0, 1.0};
+  const HeuristicParams cash_only = {0.0, 0.0, 0.0, 0.0};
+  struct
+  { uint8_t att_dice[2], att_base[2], def_dice[2];
+    int n_att, n_def, energy;
+  } cases[] =
+  { {{20, 0}, {0, 0}, {0, 0}, 1, 0, 99},
+    {{8, 0}, {4, 0}, {6, 0}, 1, 1, 99},
+    {{12, 20}, {1, 0}, {8, 0}, 2, 1, 99},
+    {{12, 20}, {1, 0}, {8, 0}, 2, 1, 15},
+    {{6, 0}, {5, 0}, {20, 4}, 1, 2, 3},
+  };
+  int n = sizeof(cases) / sizeof(cases[0]);
+  double max_damage_err = 0.0, max_kill_err = 0.0;
+  for(int c = 0; c < n; c++)
+  { HeuristicTerms t;
+    memset(&t, 0, sizeof(t));
+    t.attacker = PLAYER_A;
+    t.energy[PLAYER_A] = 99;
+    t.energy[PLAYER_B] = cases[c].energy;
+    int att_const = 0;
+    for(int k = 0; k < cases[c].n_att; k++)
+    { Action play = {ACTION_CHAMPIONS, 0, 1, {find_champion(cases[c].att_dice[k], cases[c].att_base[k])}};
+      att_const += cases[c].att_base[k];
+      heuristic_terms_apply(&t, PLAYER_A, &play);
+    }
+    for(int k = 0; k < cases[c].n_def; k++)
+    { Action play = {ACTION_CHAMPIONS, 0, 1, {find_champion(cases[c].def_dice[k], 0)}};
+      heuristic_terms_apply(&t, PLAYER_B, &play);
+    }
+    att_const += combo_bonus_lookup(t.zone[PLAYER_A], t.zone_size[PLAYER_A], DECK_RANDOM) -
+                 combo_bonus_lookup(t.zone[PLAYER_B], t.zone_size[PLAYER_B], DECK_RANDOM);
+    double damage, kill;
+    exact_damage(cases[c].att_dice, cases[c].n_att, att_const, cases[c].def_dice, cases[c].n_def,
+                 cases[c].energy, &damage, &kill);
+    double cash = heuristic_advantage(&t, PLAYER_A, &cash_only);
+    double energy = heuristic_advantage(&t, PLAYER_A, &energy_only) - cash;
+    double normal_damage = energy - (99.0 - cases[c].energy);
+    double normal_kill = heuristic_advantage(&t, PLAYER_A, &energy_and_kill) - cash - energy;
+    printf("  case %d: damage exact %.3f normal %.3f, kill exact %.4f normal %.4f\n",
+           c, damage, normal_damage, kill, normal_kill);
+    max_damage_err = fmax(max_damage_err, fabs(normal_damage - damage));
+    max_kill_err = fmax(max_kill_err, fabs(normal_kill - kill));
+  }
+  check(suite, "Expected damage within 0.5 of exact", max_damage_err < 0.5);
+  check(suite, "Kill probability within 0.03 of exact", max_kill_err < 0.03);
+
+  HeuristicTerms t;
+  memset(&t, 0, sizeof(t));
+  t.attacker = PLAYER_A;
+  t.energy[PLAYER_A] = t.energy[PLAYER_B] = 50;
+  t.cards[PLAYER_A] = 9;
+  t.cards[PLAYER_B] = 9;
+  const HeuristicParams cards_only = {0.0, 1.0, 1.0, 0.0};
+  check(suite, "Attacker's cards past 7 count for nothing",
+        heuristic_advantage(&t, PLAYER_A, &cards_only) == 7.0 - 9.0);
+  t.cash[PLAYER_A] = 10;
+  check(suite, "Cash advantage is own minus opponent's",
+        heuristic_advantage(&t, PLAYER_B, &cash_only) == -10.0);
+}
+
+void test_choice(TestSuite* suite)
+{ printf("\n=== BEST MOVE ===\n");
+
+  ActionList moves;
+  int best_ok = 1, legal_ok = 1, attacks = 0, defenses = 0;
+  for(int i = 0; i < NUM_POSITIONS; i++)
+  { const struct gamestate* g = &positions[i];
+    Action best;
+    double best_advantage;
+    if(!heuristic_choose_move(g, &HEURISTIC_DEFAULT_PARAMS, &best, &best_advantage))
+    { best_ok = 0;
+      continue;
+    }
+    legal_ok &= validate_action(g, g->player_to_move, &best) == ACTION_OK;
+
+    // No legal move (up to card equivalence) scores higher
+    HeuristicTerms root;
+    heuristic_terms_init(&root, g);
+    moves.options = ACTIONS_NO_RECALL | ACTIONS_AUTO_EXCHANGE;
+    generate_legal_actions(g, g->player_to_move, &moves);
+    for(uint16_t m = 0; m < moves.count; m++)
+      best_ok &= heuristic_move_advantage(&root, g->player_to_move, &moves.actions[m],
+                                          &HEURISTIC_DEFAULT_PARAMS) <= best_advantage + 1e-9;
+    attacks += g->turn_phase == ATTACK && best.type != ACTION_PASS;
+    defenses += g->turn_phase == DEFENSE && best.type != ACTION_PASS;
+  }
+  printf("  %d attacks and %d defenses played in %d positions\n", attacks, defenses, NUM_POSITIONS);
+  check(suite, "Chosen move scores the best of every legal move", best_ok);
+  check(suite, "Chosen move is legal", legal_ok);
+  check(suite, "Both attacks and defenses are played", attacks > 0 && defenses > 0);
+}
+
+void test_rollout(TestSuite* suite, GameContext* ctx)
+{ printf("\n=== ROLLOUTS ===\n");
+
+  int terminal = 1;
+  for(int i = 0; i < 50; i++)
+  { struct gamestate g;
+    clone_gamestate(&g, &positions[i]);
+    rollout_heuristic(&g, &HEURISTIC_DEFAULT_PARAMS, ctx);
+    terminal &= is_terminal(&g);
+  }
+  check(suite, "Rollouts from 50 positions end the game", terminal);
+}
+
+void test_strength(TestSuite* suite, GameContext* ctx)
+{ printf("\n=== HEURISTIC VS RANDOM ===\n");
+
+  StrategySet* strategies = create_strategy_set();
+  int wins[2] = {0, 0};
+  for(int seat = 0; seat < 2; seat++)
+  { set_player_strategy_by_type(strategies, seat, AI_STRATEGY_HEURISTIC);
+    set_player_strategy_by_type(strategies, 1 - seat, AI_STRATEGY_RANDOM);
+    for(int i = 0; i < STRENGTH_GAMES; i++)
+    { struct gamestate g;
+      setup_game(INITIAL_CASH_DEFAULT, &g, ctx);
+      g.turn = 0;
+      do
+        play_turn(NULL, &g, strategies, ctx);
+      while(g.turn < MAX_NUMBER_OF_TURNS && !g.someone_has_zero_energy);
+      wins[seat] += g.game_state == (seat == PLAYER_A ? PLAYER_A_WINS : PLAYER_B_WINS);
+    }
+  }
+  free_strategy_set(strategies);
+  printf("  heuristic wins %d/%d as A, %d/%d as B\n", wins[0], STRENGTH_GAMES, wins[1],
+         STRENGTH_GAMES);
+  check(suite, "Wins at least 90% as A", wins[0] >= STRENGTH_GAMES * 9 / 10);
+  check(suite, "Wins at least 90% as B", wins[1] >= STRENGTH_GAMES * 9 / 10);
+}
+
+int main(void)
+{ TestSuite suite = {"Heuristic Agent Tests", 0, 0};
+
+  printf("\n=== ORACLE HEURISTIC AGENT TEST SUITE ===\n");
+
+  if(!combo_bonus_init())
+  { printf("Failed to build combo bonus tables\n");
+    return 1;
+  }
+  actions_init();
+  config_t cfg = {0};
+  cfg.prng_seed = 2024;
+  cfg.prng_backend = RND_BACKEND_XOSHIRO256;
+  GameContext* ctx = create_game_context(&cfg);
+
+  collect_positions(ctx);
+  test_incremental_terms(&suite, ctx);
+  test_combat_expectation(&suite);
+  test_choice(&suite);
+  test_rollout(&suite, ctx);
+  test_strength(&suite, ctx);
+
+  destroy_game_context(ctx);
+
+  printf("\n=== TEST SUMMARY ===\n");
+  printf("Passed: %d, Failed: %d, Total: %d\n",
+         suite.passed, suite.failed, suite.passed + suite.failed);
+
+  return suite.failed > 0 ? 1 : 0;
+}
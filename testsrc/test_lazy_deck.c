@@ -0,0 +1,295 @@
+// test_lazy_deck.c
+// Test suite for the lazy deck (config.lazy_deck): a draw takes a uniformly
+// random card and a reshuffle does not shuffle. Checks card conservation,
+// uniformity of single draws and of draw orders (chi-square, both modes), and
+// that random-vs-random games come out statistically the same as eager ones
+// (game length distribution by Kolmogorov-Smirnov, mean, win rate), and that
+// determinizations leave a reshuffled own deck alone.
+
+#include "../src/actions/action.h"
+#include "../src/ai_strat/ai_strategy.h"
+#include "../src/ai_strat/ai_strat_lib_search.h"
+#include "../src/ai_strat/ai_strat_random.h"
+#include "../src/core/card_actions.h"
+#include "../src/core/combo_bonus.h"
+#include "../src/core/game_constants.h"
+#include "../src/core/game_context.h"
+#include "../src/core/game_state.h"
+#include "../src/core/turn_logic.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_PASS "\033[32m✓ PASS\033[0m"
+#define TEST_FAIL "\033[31m✗ FAIL\033[0m"
+
+// Chi-square critical values at p = 0.001
+#define CHI2_CRIT_19DF 43.82
+#define CHI2_CRIT_23DF 49.73
+// Two-sided normal and two-sample Kolmogorov-Smirnov coefficients, p = 0.001
+#define Z_CRIT 3.29
+#define KS_CRIT 1.95
+
+#define DRAW_TRIALS 40000
+#define ORDER_TRIALS 48000
+#define GAMES_PER_MODE 4000
+
+typedef struct
+{ const char* name;
+  int passed;
+  int failed;
+} TestSuite;
+
+void print_test_result(const char* test_name, int expected, int actual)
+{ if(expected == actual)
+  { printf("  %s: %s (expected %d, got %d)\n",
+           TEST_PASS, test_name, expected, actual);
+  }
+  else
+  { printf("  %s: %s (expected %d, got %d)\n",
+           TEST_FAIL, test_name, expected, actual);
+  }
+}
+
+static void check(TestSuite* suite, const char* name, int ok)
+{ print_test_result(name, 1, ok);
+  suite->passed += ok;
+  suite->failed += !ok;
+}
+
+static double chi_square(const int* counts, int cells, int total)
+{ double expected = (double)total / cells;
+  double chi2 = 0.0;
+  for(int i = 0; i < cells; i++)
+    chi2 += (counts[i] - expected) * (counts[i] - expected) / expected;
+  return chi2;
+}
+
+// Player A with cards 0..n-1 in the discard (in order) and nothing else
+static void discard_only_state(struct gamestate* g, uint8_t n)
+{ memset(g, 0, sizeof(*g));
+  DeckStk_emptyOut(&g->deck[PLAYER_A]);
+  Hand_init(&g->hand[PLAYER_A]);
+  Discard_clear(&g->discard[PLAYER_A]);
+  for(uint8_t c = 0; c < n; c++)
+    Discard_add(&g->discard[PLAYER_A], c);
+}
+
+void test_conservation(TestSuite* suite, GameContext* ctx)
+{ printf("\n=== CARD CONSERVATION ===\n");
+
+  // 10 cards: a hand holds at most 12
+  struct gamestate g;
+  discard_only_state(&g, 10);
+  int ok = 1;
+  for(int i = 0; i < 10; i++)
+  { draw_1_card(&g, PLAYER_A, ctx);
+    ok &= g.deck[PLAYER_A].size + g.hand[PLAYER_A].size == 10;
+    // The deck still holds exactly the cards not yet drawn
+    for(uint8_t c = 0; c < 10; c++)
+      ok &= DeckStk_contains(&g.deck[PLAYER_A], c) != Hand_contains(&g.hand[PLAYER_A], c);
+  }
+  check(suite, "Every card drawn once, deck membership consistent", ok);
+  check(suite, "Discard emptied by the reshuffle", g.discard[PLAYER_A].size == 0);
+}
+
+// First card drawn after a reshuffle of 20 cards: uniform over the 20
+static double first_draw_chi2(GameContext* ctx)
+{ int counts[20] = {0};
+  struct gamestate g;
+  for(int t = 0; t < DRAW_TRIALS; t++)
+  { discard_only_state(&g, 20);
+    draw_1_card(&g, PLAYER_A, ctx);
+    counts[g.hand[PLAYER_A].cards[0]]++;
+  }
+  return chi_square(counts, 20, DRAW_TRIALS);
+}
+
+// Order in which 4 reshuffled cards are drawn: uniform over the 24 orders
+static double draw_order_chi2(GameContext* ctx)
+{ int counts[24] = {0};
+  struct gamestate g;
+  for(int t = 0; t < ORDER_TRIALS; t++)
+  { discard_only_state(&g, 4);
+    uint8_t order[4];
+    for(int i = 0; i < 4; i++)
+    { draw_1_card(&g, PLAYER_A, ctx);
+      order[i] = g.hand[PLAYER_A].cards[i];
+    }
+    // Lehmer code of the permutation
+    int code = 0;
+    for(int i = 0; i < 4; i++)
+    { int smaller = 0;
+      for(int j = i + 1; j < 4; j++)
+        smaller += order[j] < order[i];
+      code = code * (4 - i) + smaller;
+    }
+    counts[code]++;
+  }
+  return chi_square(counts, 24, ORDER_TRIALS);
+}
+
+void test_uniformity(TestSuite* suite, GameContext* ctx)
+{ printf("\n=== DRAW UNIFORMITY (chi-square, p = 0.001) ===\n");
+
+  for(int lazy = 0; lazy <= 1; lazy++)
+  { ctx->config->lazy_deck = lazy;
+    double first = first_draw_chi2(ctx);
+    double order = draw_order_chi2(ctx);
+    printf("  %s: first draw chi2 %.1f (19 df), draw order chi2 %.1f (23 df)\n",
+           lazy ? "lazy " : "eager", first, order);
+    check(suite, lazy ? "Lazy first draw uniform" : "Eager first draw uniform",
+          first < CHI2_CRIT_19DF);
+    check(suite, lazy ? "Lazy draw order uniform" : "Eager draw order uniform",
+          order < CHI2_CRIT_23DF);
+  }
+  ctx->config->lazy_deck = false;
+}
+
+typedef struct
+{ double turn_mean, turn_var;
+  double a_win_rate;
+  int length_counts[MAX_NUMBER_OF_TURNS + 2]; // games by number of turns
+} GameStats;
+
+// Two-sample Kolmogorov-Smirnov statistic of the game length distributions
+// (equal sample sizes)
+static double length_ks(const GameStats* a, const GameStats* b)
+{ int cum_a = 0, cum_b = 0;
+  double d = 0.0;
+  for(int t = 0; t < MAX_NUMBER_OF_TURNS + 2; t++)
+  { cum_a += a->length_counts[t];
+    cum_b += b->length_counts[t];
+    d = fmax(d, fabs(cum_a - cum_b) / (double)GAMES_PER_MODE);
+  }
+  return d;
+}
+
+static void random_games(GameContext* ctx, GameStats* s)
+{ StrategySet strategies = {{random_attack_strategy, random_attack_strategy},
+                              {random_defense_strategy, random_defense_strategy}};
+  struct gamestate g;
+  memset(s, 0, sizeof(*s));
+  double sum = 0.0, sum_sq = 0.0;
+  int a_wins = 0;
+  for(int i = 0; i < GAMES_PER_MODE; i++)
+  { setup_game(INITIAL_CASH_DEFAULT, &g, ctx);
+    g.turn = 0;
+    do
+      play_turn(NULL, &g, &strategies, ctx);
+    while(g.turn < MAX_NUMBER_OF_TURNS && !g.someone_has_zero_energy);
+    sum += g.turn;
+    sum_sq += (double)g.turn * g.turn;
+    a_wins += g.game_state == PLAYER_A_WINS;
+    s->length_counts[g.turn <= MAX_NUMBER_OF_TURNS ? g.turn : MAX_NUMBER_OF_TURNS + 1]++;
+  }
+  s->turn_mean = sum / GAMES_PER_MODE;
+  s->turn_var = sum_sq / GAMES_PER_MODE - s->turn_mean * s->turn_mean;
+  s->a_win_rate = (double)a_wins / GAMES_PER_MODE;
+}
+
+void test_game_equivalence(TestSuite* suite, GameContext* ctx)
+{ printf("\n=== RANDOM GAMES, EAGER VS LAZY ===\n");
+
+  static GameStats eager, lazy;
+  ctx->config->lazy_deck = false;
+  random_games(ctx, &eager);
+  ctx->config->lazy_deck = true;
+  random_games(ctx, &lazy);
+  ctx->config->lazy_deck = false;
+
+  // Independent samples, two-sided tests at p = 0.001
+  double turn_se = sqrt((eager.turn_var + lazy.turn_var) / GAMES_PER_MODE);
+  double win_se = sqrt((eager.a_win_rate * (1 - eager.a_win_rate) +
+                        lazy.a_win_rate * (1 - lazy.a_win_rate)) / GAMES_PER_MODE);
+  double ks = length_ks(&eager, &lazy);
+  double ks_crit = KS_CRIT * sqrt(2.0 / GAMES_PER_MODE);
+  printf("  eager: %.2f turns, A wins %.1f%%; lazy: %.2f turns, A wins %.1f%% (%d games each)\n",
+         eager.turn_mean, 100.0 * eager.a_win_rate, lazy.turn_mean, 100.0 * lazy.a_win_rate,
+         GAMES_PER_MODE);
+  printf("  game length KS distance %.4f (critical %.4f)\n", ks, ks_crit);
+  check(suite, "Game length distribution matches (KS)", ks < ks_crit);
+  check(suite, "Game length mean matches", fabs(eager.turn_mean - lazy.turn_mean) < Z_CRIT * turn_se);
+  check(suite, "Player A win rate matches",
+        fabs(eager.a_win_rate - lazy.a_win_rate) < Z_CRIT * win_se);
+}
+
+// Determinize a (state with its own deck moved to its discard pile) from the
+// same generator state: under lazy decks both draw the same numbers
+static bool same_draws_without_own_deck(const struct gamestate* g, PlayerID obs,
+                                        GameContext* ctx)
+{ struct gamestate a, b;
+  RndState saved = ctx->rng;
+  clone_gamestate(&a, g);
+  randomize_hidden_information(&a, obs, ctx);
+  RndState after = ctx->rng;
+
+  ctx->rng = saved;
+  clone_gamestate(&b, g);
+  while(!DeckStk_isEmpty(&b.deck[obs]))
+    Discard_add(&b.discard[obs], DeckStk_pop(&b.deck[obs]));
+  randomize_hidden_information(&b, obs, ctx);
+  return memcmp(&after.xo, &ctx->rng.xo, sizeof(after.xo)) == 0 &&
+         memcmp(&a.deck[1 - obs], &b.deck[1 - obs], sizeof(a.deck[0])) == 0 &&
+         memcmp(&a.hand[1 - obs], &b.hand[1 - obs], sizeof(a.hand[0])) == 0;
+}
+
+void test_determinization(TestSuite* suite, GameContext* ctx)
+{ printf("\n=== DETERMINIZATION ===\n");
+
+  // Both decks reshuffled from their discard piles, then 3 cards drawn each
+  struct gamestate g, d;
+  ctx->config->lazy_deck = true;
+  setup_game(INITIAL_CASH_DEFAULT, &g, ctx);
+  for(int p = 0; p < 2; p++)
+  { while(!DeckStk_isEmpty(&g.deck[p]))
+      Discard_add(&g.discard[p], DeckStk_pop(&g.deck[p]));
+    for(int i = 0; i < 3; i++)
+      draw_1_card(&g, p, ctx);
+  }
+  PlayerID obs = g.player_to_move;
+
+  clone_gamestate(&d, &g);
+  randomize_hidden_information(&d, obs, ctx);
+  check(suite, "Reshuffled own deck is left in place",
+        memcmp(&d.deck[obs], &g.deck[obs], sizeof(g.deck[0])) == 0);
+  check(suite, "No randomness is drawn for the own deck",
+        same_draws_without_own_deck(&g, obs, ctx));
+
+  // Eager decks shuffle it, so the same comparison tells them apart
+  ctx->config->lazy_deck = false;
+  check(suite, "Eager decks draw for it", !same_draws_without_own_deck(&g, obs, ctx));
+}
+
+int main(void)
+{ TestSuite suite = {"Lazy Deck Tests", 0, 0};
+
+  printf("\n=== ORACLE LAZY DECK TEST SUITE ===\n");
+
+  if(!combo_bonus_init())
+  { printf("Failed to build combo bonus tables\n");
+    return 1;
+  }
+  actions_init();
+
+  config_t cfg = {0};
+  cfg.prng_seed = 2024;
+  cfg.prng_backend = RND_BACKEND_XOSHIRO256;
+  GameContext* ctx = create_game_context(&cfg);
+
+  cfg.lazy_deck = false;
+  test_conservation(&suite, ctx);
+  cfg.lazy_deck = true;
+  test_conservation(&suite, ctx);
+  test_uniformity(&suite, ctx);
+  test_determinization(&suite, ctx);
+  test_game_equivalence(&suite, ctx);
+
+  destroy_game_context(ctx);
+
+  printf("\n=== TEST SUMMARY ===\n");
+  printf("Passed: %d, Failed: %d, Total: %d\n",
+         suite.passed, suite.failed, suite.passed + suite.failed);
+
+  return suite.failed > 0 ? 1 : 0;
+}
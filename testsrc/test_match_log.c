@@ -0,0 +1,302 @@
+// test_match_log.c
+// Test suite for the binary match log (rating/match_log.c): records written by
+// serial and parallel stda.auto runs, block indexing and random access through
+// the memory map, per-turn summaries, rejection of damaged files, and ratings;
+// and single-game replay (roles/stda/stda_replay.c) of replayable runs, from
+// the logged actions and by rerunning the agents
+
+#include "../src/rating/match_log.h"
+#include "../src/roles/stda/stda_auto.h"
+#include "../src/roles/stda/stda_replay.h"
+#include "../src/roles/stda/stda_tournament.h"
+#include "../src/core/combo_bonus.h"
+#include "../src/core/zobrist.h"
+#include "../src/core/game_context.h"
+#include "../src/util/prng_seed.h"
+#include "../src/actions/action.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define TEST_PASS "\033[32m✓ PASS\033[0m"
+#define TEST_FAIL "\033[31m✗ FAIL\033[0m"
+
+// More than one block, so random access crosses block boundaries
+#define TEST_GAMES (MATCH_LOG_BLOCK_GAMES + 904)
+
+typedef struct
+{ const char* name;
+  int passed;
+  int failed;
+} TestSuite;
+
+void print_test_result(const char* test_name, int expected, int actual)
+{ if(expected == actual)
+  { printf("  %s: %s (expected %d, got %d)\n",
+           TEST_PASS, test_name, expected, actual);
+  }
+  else
+  { printf("  %s: %s (expected %d, got %d)\n",
+           TEST_FAIL, test_name, expected, actual);
+  }
+}
+
+static void check(TestSuite* suite, const char* name, int ok)
+{ print_test_result(name, 1, ok);
+  suite->passed += ok;
+  suite->failed += !ok;
+}
+
+static const char names[2][BT_NAME_LEN] = {"Random", "Random #2"};
+
+// Every record is consistent with its turn summaries, every game index in
+// [0, games) appears once, and the results add up to gstats
+static bool log_matches(const MatchLogReader* reader, const struct gamestats* gstats,
+                        uint64_t games)
+{ if(reader->num_games != games) return false;
+
+  uint8_t* seen = calloc(games, 1);
+  uint64_t wins[2] = {0, 0}, draws = 0;
+  bool ok = true;
+  for(uint64_t i = 0; i < reader->num_games && ok; i++)
+  { const MatchLogTurn* turns;
+    const MatchLogGame* game = match_log_record(reader, i, &turns);
+    ok &= game != NULL && game->game < games && !seen[game->game];
+    if(!ok) break;
+    seen[game->game] = 1;
+    if(game->result == DRAW) draws++;
+    else wins[game->result]++;
+
+    // A summary is taken after every turn, so the last one is the final state
+    const MatchLogTurn* last = &turns[game->turns - 1];
+    ok &= game->turns > 0 && last->energy[PLAYER_A] == game->energy[PLAYER_A] &&
+          last->energy[PLAYER_B] == game->energy[PLAYER_B] &&
+          last->cash[PLAYER_A] == game->cash[PLAYER_A];
+  }
+  free(seen);
+  return ok && wins[PLAYER_A] == gstats->cumul_player_wins[PLAYER_A] &&
+         wins[PLAYER_B] == gstats->cumul_player_wins[PLAYER_B] &&
+         draws == gstats->cumul_number_of_draws;
+}
+
+void test_serial(TestSuite* suite, config_t* cfg, StrategySet* strategies, const char* path)
+{ printf("\n=== SERIAL RUN ===\n");
+
+  MatchLog* log = match_log_create(path, cfg->prng_seed, cfg->prng_backend, 0, 2, names);
+  check(suite, "Log created", log != NULL);
+  GameContext* ctx = create_game_context(cfg);
+  ctx->match_log = match_log_buffer_create(log, 0, cfg->prng_seed, 0, PLAYER_A, PLAYER_B);
+
+  struct gamestats gstats;
+  memset(&gstats, 0, sizeof(gstats));
+  run_simulation(TEST_GAMES, 0, INITIAL_CASH_DEFAULT, &gstats, strategies, ctx);
+  match_log_buffer_destroy(ctx->match_log);
+  destroy_game_context(ctx);
+  check(suite, "All games written", log->games == TEST_GAMES);
+  check(suite, "Log closed", match_log_close(log));
+
+  MatchLogReader reader;
+  bool ok = match_log_open(path, &reader);
+  check(suite, "Log opens", ok);
+  check(suite, "Header kept", ok && reader.header->num_agents == 2 &&
+        reader.header->master_seed == cfg->prng_seed &&
+        strcmp(reader.header->agents[1], "Random #2") == 0);
+  check(suite, "Two blocks", ok && reader.num_blocks == 2 &&
+        reader.blocks[1].first_record == MATCH_LOG_BLOCK_GAMES);
+  check(suite, "Records match the games played", ok && log_matches(&reader, &gstats, TEST_GAMES));
+
+  // Serial records are in game order
+  bool ordered = ok;
+  for(uint64_t i = 0; i < reader.num_games && ordered; i++)
+    ordered = match_log_record(&reader, i, NULL)->game == i;
+  check(suite, "Serial records in game order", ordered);
+  check(suite, "Out of range record", ok && match_log_record(&reader, TEST_GAMES, NULL) == NULL);
+
+  BTModel* model = bt_create();
+  check(suite, "Log results feed the rating", match_log_add_to_rating(&reader, model) &&
+        model->num_players == 2 && model->games[0] == TEST_GAMES);
+  bt_destroy(model);
+  match_log_reader_close(&reader);
+}
+
+void test_parallel(TestSuite* suite, config_t* cfg, StrategySet* strategies, const char* path)
+{ printf("\n=== PARALLEL RUN ===\n");
+
+  MatchLog* log = match_log_create(path, cfg->prng_seed, cfg->prng_backend, 0, 2, names);
+  struct gamestats gstats;
+  memset(&gstats, 0, sizeof(gstats));
+  int ret = run_simulation_parallel(TEST_GAMES, INITIAL_CASH_DEFAULT, 3, &gstats, strategies,
+                                    cfg, log);
+  check(suite, "Parallel run logs", ret == EXIT_SUCCESS && match_log_close(log));
+
+  MatchLogReader reader;
+  bool ok = match_log_open(path, &reader);
+  check(suite, "Records match the games of all workers", ok && log_matches(&reader, &gstats, TEST_GAMES));
+
+  bool streams_ok = ok;
+  for(uint64_t i = 0; i < reader.num_games && streams_ok; i++)
+  { const MatchLogGame* game = match_log_record(&reader, i, NULL);
+    // Worker t plays games [t * n / 3, (t + 1) * n / 3)
+    uint64_t t = game->stream;
+    streams_ok = t < 3 && t * TEST_GAMES / 3 <= game->game && game->game < (t + 1) * TEST_GAMES / 3;
+  }
+  check(suite, "Each game tagged with its worker stream", streams_ok);
+  match_log_reader_close(&reader);
+}
+
+// The replayed game ends as the logged one did
+static bool replay_matches(const ReplayResult* r, const MatchLogGame* game)
+{ return r->result == game->result && r->turns == game->turns &&
+         r->energy[PLAYER_A] == game->energy[PLAYER_A] && r->energy[PLAYER_B] == game->energy[PLAYER_B] &&
+         r->cash[PLAYER_A] == game->cash[PLAYER_A] && r->cash[PLAYER_B] == game->cash[PLAYER_B];
+}
+
+// A replayable run with actions, on 3 threads: any game rebuilds alone, from
+// its actions or from its agents, as it was played. Simple MC draws from its
+// own stream many times per move, so a replay from the agents only matches
+// if the agents' streams are seeded per game too.
+void test_replay(TestSuite* suite, config_t* cfg, const char* path)
+{ printf("\n=== REPLAY ===\n");
+
+  const uint64_t games = 60;
+  config_t rcfg = *cfg;
+  rcfg.replayable = true;
+  rcfg.ai_budget = 8;
+  rcfg.ai_players[PLAYER_A] = AI_STRATEGY_SIMPLE_MC;
+  rcfg.ai_players[PLAYER_B] = AI_STRATEGY_RANDOM;
+  StrategySet* strategies = create_strategy_set();
+  set_player_strategy_by_type(strategies, PLAYER_A, AI_STRATEGY_SIMPLE_MC);
+  set_player_strategy_by_type(strategies, PLAYER_B, AI_STRATEGY_RANDOM);
+
+  MatchLog* log = match_log_create(path, rcfg.prng_seed, rcfg.prng_backend,
+                                   MATCH_LOG_REPLAYABLE | MATCH_LOG_ACTIONS, 2, names);
+  struct gamestats gstats;
+  memset(&gstats, 0, sizeof(gstats));
+  int ret = run_simulation_parallel(games, INITIAL_CASH_DEFAULT, 3, &gstats, strategies, &rcfg, log);
+  check(suite, "Replayable run logs", ret == EXIT_SUCCESS && match_log_close(log));
+
+  MatchLogReader reader;
+  bool ok = match_log_open(path, &reader);
+  check(suite, "Replayable log flagged", ok && reader.header->flags == (MATCH_LOG_REPLAYABLE | MATCH_LOG_ACTIONS));
+
+  bool traced = ok, from_actions = ok, from_agents = ok, seeds = ok;
+  for(uint64_t g = 0; g < games && ok; g++)
+  { const uint8_t* actions;
+    const MatchLogGame* game = match_log_find_game(&reader, g, NULL, &actions);
+    traced &= game != NULL && game->action_bytes > 0;
+    if(game == NULL) break;
+    seeds &= game->seed == derive_game_seed(rcfg.prng_seed, g, GAME_STREAM_CHANCE);
+
+    ReplayResult r;
+    from_actions &= replay_game(&rcfg, 0, g, actions, game->action_bytes, NULL, NULL, &r) &&
+                    r.trace_ok && replay_matches(&r, game);
+    if(g % 6 == 0)   // the agents are slower
+      from_agents &= replay_game(&rcfg, 0, g, NULL, 0, NULL, NULL, &r) && replay_matches(&r, game);
+  }
+  check(suite, "Every game has its actions", traced);
+  check(suite, "Records carry the game's chance seed", seeds);
+  check(suite, "Replays from the actions match the log", from_actions);
+  check(suite, "Replays from the agents match the log", from_agents);
+
+  // A damaged trace is caught instead of replaying another game
+  const uint8_t* actions;
+  const MatchLogGame* game = ok ? match_log_find_game(&reader, 7, NULL, &actions) : NULL;
+  ReplayResult r;
+  check(suite, "Truncated trace detected", game != NULL &&
+        replay_game(&rcfg, 0, 7, actions, game->action_bytes / 2, NULL, NULL, &r) && !r.trace_ok);
+  check(suite, "Game outside the log not found", ok && match_log_find_game(&reader, games, NULL, NULL) == NULL);
+  check(suite, "-P match has job 0 only", !replay_game(&rcfg, 1, 0, NULL, 0, NULL, NULL, &r));
+  if(ok) match_log_reader_close(&reader);
+
+  // Tournament games replay through their job too: the same game twice, the
+  // second time without the first
+  rcfg.tournament = "rand,simplemc";
+  rcfg.numsim = 20;
+  ReplayResult a, b, c;
+  check(suite, "Tournament game replays the same", replay_game(&rcfg, 1, 13, NULL, 0, NULL, NULL, &a) &&
+        replay_game(&rcfg, 1, 5, NULL, 0, NULL, NULL, &b) &&
+        replay_game(&rcfg, 1, 13, NULL, 0, NULL, NULL, &c) &&
+        a.result == c.result && a.turns == c.turns && a.energy[0] == c.energy[0] &&
+        a.cash[1] == c.cash[1] && strcmp(a.agents[PLAYER_A], "simplemc") == 0);
+  check(suite, "Tournament game out of range", !replay_game(&rcfg, 1, 20, NULL, 0, NULL, NULL, &a) &&
+        !replay_game(&rcfg, 2, 0, NULL, 0, NULL, NULL, &a));
+
+  uint32_t job;
+  uint64_t g;
+  check(suite, "Replay argument parsed", parse_replay_arg("3:734112", &job, &g) && job == 3 && g == 734112);
+  check(suite, "Bad replay arguments rejected", !parse_replay_arg("3", &job, &g) &&
+        !parse_replay_arg("3:", &job, &g) && !parse_replay_arg("-1:2", &job, &g) &&
+        !parse_replay_arg("1:2x", &job, &g));
+  free_strategy_set(strategies);
+} // test_replay
+
+void test_damaged(TestSuite* suite, const char* path)
+{ printf("\n=== DAMAGED FILES ===\n");
+
+  MatchLogReader reader;
+  FILE* f = fopen(path, "r+b");
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  fclose(f);
+
+  check(suite, "Truncated log rejected", truncate(path, size - 1) == 0 && !match_log_open(path, &reader));
+
+  f = fopen(path, "r+b");
+  fputc('X', f);
+  fclose(f);
+  check(suite, "Wrong magic rejected", !match_log_open(path, &reader));
+  check(suite, "Missing file rejected", !match_log_open("/nonexistent/log.oml", &reader));
+}
+
+int main(void)
+{ TestSuite suite = {"Match Log Tests", 0, 0};
+
+  printf("\n");
+  printf("╔════════════════════════════════════════════╗\n");
+  printf("║  ORACLE MATCH LOG TEST SUITE               ║\n");
+  printf("╚════════════════════════════════════════════╝\n");
+
+  if(!combo_bonus_init())
+  { printf("Failed to build combo bonus tables\n");
+    return 1;
+  }
+  actions_init();
+  zobrist_init();
+
+  config_t cfg = {0};
+  cfg.prng_seed = 4242;
+  cfg.prng_backend = RND_BACKEND_MT19937;
+
+  StrategySet* strategies = create_strategy_set();
+  set_player_strategy_by_type(strategies, PLAYER_A, AI_STRATEGY_RANDOM);
+  set_player_strategy_by_type(strategies, PLAYER_B, AI_STRATEGY_RANDOM);
+
+  char path[] = "/tmp/test_match_log_XXXXXX";
+  int fd = mkstemp(path);
+  if(fd < 0)
+  { perror("mkstemp");
+    return 1;
+  }
+  close(fd);
+
+  test_serial(&suite, &cfg, strategies, path);
+  test_parallel(&suite, &cfg, strategies, path);
+  test_replay(&suite, &cfg, path);
+  test_damaged(&suite, path);
+
+  unlink(path);
+  free_strategy_set(strategies);
+
+  printf("\n");
+  printf("╔════════════════════════════════════════════╗\n");
+  printf("║  TEST SUMMARY                              ║\n");
+  printf("╠════════════════════════════════════════════╣\n");
+  printf("║  Passed: %-3d                               ║\n", suite.passed);
+  printf("║  Failed: %-3d                               ║\n", suite.failed);
+  printf("║  Total:  %-3d                               ║\n",
+         suite.passed + suite.failed);
+  printf("╚════════════════════════════════════════════╝\n");
+
+  return suite.failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,342 @@
+// test_rating.c
+// Test suite for the Bradley-Terry rating engine (rating/bt_rating.c): pair
+// aggregation, recovery of known strengths by MM and Newton, warm starts,
+// bootstrap intervals and refit speed; the SPRT (rating/sprt.c).
+
+#include "../src/rating/bt_rating.h"
+#include "../src/rating/sprt.h"
+#include "../src/util/xoshiro.h"
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define TEST_PASS "\033[32m✓ PASS\033[0m"
+#define TEST_FAIL "\033[31m✗ FAIL\033[0m"
+
+typedef struct
+{ const char* name;
+  int passed;
+  int failed;
+} TestSuite;
+
+void print_test_result(const char* test_name, int expected, int actual)
+{ if(expected == actual)
+  { printf("  %s: %s (expected %d, got %d)\n",
+           TEST_PASS, test_name, expected, actual);
+  }
+  else
+  { printf("  %s: %s (expected %d, got %d)\n",
+           TEST_FAIL, test_name, expected, actual);
+  }
+}
+
+static void check(TestSuite* suite, const char* name, int ok)
+{ print_test_result(name, 1, ok);
+  suite->passed += ok;
+  suite->failed += !ok;
+}
+
+static double elapsed_ms(const struct timespec* start)
+{ struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (now.tv_sec - start->tv_sec) * 1e3 + (now.tv_nsec - start->tv_nsec) / 1e6;
+}
+
+static double expected_score(double elo_a, double elo_b)
+{ return 1.0 / (1.0 + pow(10.0, (elo_b - elo_a) / 400.0));
+}
+
+// Round robin with `games` per pair, results drawn from the true Elo: 6% draws,
+// and the expected score (wins + draws / 2) matches the Elo difference
+static BTModel* simulate(const double* true_elo, int n, uint64_t games, uint64_t seed)
+{ BTModel* model = bt_create();
+  char name[16];
+  for(int i = 0; i < n; i++)
+  { snprintf(name, sizeof(name), "agent%d", i);
+    bt_add_player(model, name);
+  }
+
+  Xoshiro256 rng = seedXoshiro(seed);
+  for(int i = 0; i < n; i++)
+    for(int j = i + 1; j < n; j++)
+    { double p = expected_score(true_elo[i], true_elo[j]);
+      uint64_t wins_i = 0, wins_j = 0, draws = 0;
+      for(uint64_t g = 0; g < games; g++)
+      { double u = (double)(nextXoshiro(&rng) >> 11) * 0x1.0p-53;
+        if(u < 0.06) draws++;
+        else if(u < 0.03 + p) wins_i++;
+        else wins_j++;
+      }
+      bt_add_games(model, i, j, wins_i, wins_j, draws);
+    }
+  return model;
+}
+
+void test_aggregation(TestSuite* suite)
+{ printf("\n=== PAIR AGGREGATION ===\n");
+
+  BTModel* model = bt_create();
+  bt_add_player(model, "A");
+  bt_add_player(model, "B");
+  bt_add_player(model, "C");
+  bt_add_games(model, 0, 1, 3, 1, 2);
+  bt_add_games(model, 1, 0, 1, 3, 2);     // same results, seats listed the other way
+  bt_add_games(model, 2, 1, 5, 0, 0);
+
+  check(suite, "Finds players by name", bt_find_player(model, "C") == 2 && bt_find_player(model, "D") == -1);
+  check(suite, "One entry per pair", model->num_pairs == 2);
+  check(suite, "Counts merge in either order",
+        model->pairs[0].games == 12 && model->pairs[0].half_wins_i == 16 && model->pairs[0].draws == 4);
+  check(suite, "Per-player totals", model->games[1] == 17 && model->half_wins[1] == 8);
+  check(suite, "Rejects self-play and unknown players",
+        !bt_add_games(model, 1, 1, 1, 0, 0) && !bt_add_games(model, 0, 7, 1, 0, 0));
+  bt_destroy(model);
+
+  // Many players: the pair table grows and stays exact
+  model = bt_create();
+  for(int i = 0; i < 300; i++)
+    bt_add_player(model, "p");
+  uint64_t total = 0;
+  for(uint32_t i = 0; i < 300; i++)
+    for(uint32_t j = i + 1; j < 300; j += 7)
+    { bt_add_games(model, j, i, 1, 1, 0);
+      bt_add_games(model, i, j, 1, 0, 1);
+      total += 4;
+    }
+  uint64_t games = 0;
+  bool exact = true;
+  for(uint32_t k = 0; k < model->num_pairs; k++)
+  { games += model->pairs[k].games;
+    exact &= model->pairs[k].games == 4 && model->pairs[k].half_wins_i == 5;
+  }
+  check(suite, "Thousands of pairs aggregate exactly", exact && games == total);
+  bt_destroy(model);
+}
+
+void test_fitting(TestSuite* suite)
+{ printf("\n=== FITTING ===\n");
+
+  const double true_elo[6] = {0, 150, -200, 320, 60, -90};
+  BTModel* model = simulate(true_elo, 6, 4000, 11);
+  model->prior = 0.0;
+
+  int newton_it = bt_fit(model, BT_FIT_NEWTON, BT_DEFAULT_TOLERANCE, 100);
+  double newton_elo[6], max_error = 0.0;
+  for(int i = 0; i < 6; i++)
+  { newton_elo[i] = bt_elo(model, i);
+    max_error = fmax(max_error, fabs(newton_elo[i] - true_elo[i]));
+  }
+  printf("  Newton: %d iterations, max Elo error %.1f\n", newton_it, max_error);
+  check(suite, "Newton converges", newton_it > 0 && newton_it < 20);
+  check(suite, "Recovers the true Elo within 20", max_error < 20.0);
+
+  // Gradient check: the fit is a maximum of the likelihood
+  double ll = bt_log_likelihood(model);
+  model->strength[3] *= 1.05;
+  bool is_max = bt_log_likelihood(model) < ll;
+  model->strength[3] /= 1.05 * 1.05;
+  is_max &= bt_log_likelihood(model) < ll;
+  check(suite, "Fit maximizes the likelihood", is_max);
+
+  for(int i = 0; i < 6; i++)
+    model->strength[i] = 1.0;
+  int mm_it = bt_fit(model, BT_FIT_MM, 1e-12, BT_DEFAULT_MAX_ITERATIONS);
+  double max_diff = 0.0;
+  for(int i = 0; i < 6; i++)
+    max_diff = fmax(max_diff, fabs(bt_elo(model, i) - newton_elo[i]));
+  printf("  MM: %d iterations, max difference to Newton %.2e Elo\n", mm_it, max_diff);
+  check(suite, "MM and Newton agree", mm_it > 0 && max_diff < 1e-6);
+
+  check(suite, "Win probability matches the Elo difference",
+        fabs(bt_win_probability(model, 3, 2) - expected_score(newton_elo[3], newton_elo[2])) < 1e-9);
+  bt_destroy(model);
+
+  // Unbeaten player: finite with the prior
+  model = bt_create();
+  bt_add_player(model, "strong");
+  bt_add_player(model, "weak");
+  bt_add_games(model, 0, 1, 50, 0, 0);
+  int it = bt_fit(model, BT_FIT_NEWTON, BT_DEFAULT_TOLERANCE, 100);
+  check(suite, "Unbeaten player gets a finite rating with the prior",
+        it > 0 && isfinite(bt_elo(model, 1)) && bt_elo(model, 1) < -300.0);
+  bt_destroy(model);
+}
+
+void test_warm_start(TestSuite* suite)
+{ printf("\n=== INCREMENTAL UPDATES ===\n");
+
+  const double true_elo[5] = {0, 100, -100, 200, 50};
+  BTModel* model = simulate(true_elo, 5, 2000, 5);
+  int cold = bt_fit(model, BT_FIT_NEWTON, BT_DEFAULT_TOLERANCE, 100);
+
+  // A new batch of games, then a new agent
+  BTModel* batch = simulate(true_elo, 5, 200, 6);
+  for(uint32_t k = 0; k < batch->num_pairs; k++)
+  { const BTPair* p = &batch->pairs[k];
+    uint64_t wins_i = (p->half_wins_i - p->draws) / 2;
+    bt_add_games(model, p->i, p->j, wins_i, p->games - p->draws - wins_i, p->draws);
+  }
+  bt_destroy(batch);
+  int newcomer = bt_add_player(model, "newcomer");
+  for(int i = 0; i < 5; i++)
+    bt_add_games(model, newcomer, i, 60, 40, 0);
+
+  int warm = bt_fit(model, BT_FIT_NEWTON, BT_DEFAULT_TOLERANCE, 100);
+  double warm_elo = bt_elo(model, 1);
+  for(uint32_t i = 0; i < model->num_players; i++)
+    model->strength[i] = 1.0;
+  int refit = bt_fit(model, BT_FIT_NEWTON, BT_DEFAULT_TOLERANCE, 100);
+
+  printf("  Newton iterations: cold %d, warm after new games %d, cold refit %d\n",
+         cold, warm, refit);
+  check(suite, "Warm start needs fewer iterations", warm > 0 && warm < refit);
+  check(suite, "Warm and cold fits agree", fabs(bt_elo(model, 1) - warm_elo) < 1e-6);
+  check(suite, "New agent is rated", bt_elo(model, newcomer) > 0.0);
+  bt_destroy(model);
+}
+
+void test_bootstrap(TestSuite* suite)
+{ printf("\n=== BOOTSTRAP INTERVALS ===\n");
+
+  const double true_elo[6] = {0, 150, -200, 320, 60, -90};
+  BTModel* model = simulate(true_elo, 6, 1000, 21);
+  bt_fit(model, BT_FIT_NEWTON, BT_DEFAULT_TOLERANCE, 100);
+
+  BTInterval one[6], four[6];
+  bool ok = bt_bootstrap(model, 200, 1, 99, 0.95, one);
+  ok &= bt_bootstrap(model, 200, 4, 99, 0.95, four);
+  check(suite, "Bootstrap runs", ok);
+  check(suite, "Same seed, same intervals on 1 or 4 threads", memcmp(one, four, sizeof(one)) == 0);
+
+  int covered = 0;
+  bool ordered = true;
+  for(int i = 0; i < 6; i++)
+  { covered += true_elo[i] >= one[i].low && true_elo[i] <= one[i].high;
+    ordered &= one[i].low <= one[i].elo + 1.0 && one[i].elo <= one[i].high + 1.0 &&
+               (i == 0 || one[i].stderr_elo > 0.0);
+  }
+  bt_print(model, one, stdout);
+  check(suite, "Intervals contain the estimate", ordered);
+  check(suite, "Intervals cover the true Elo (>= 5 of 6)", covered >= 5);
+  check(suite, "Anchor has zero width", one[0].low == 0.0 && one[0].high == 0.0);
+  bt_destroy(model);
+
+  model = simulate(true_elo, 6, 8000, 22);
+  bt_fit(model, BT_FIT_NEWTON, BT_DEFAULT_TOLERANCE, 100);
+  BTInterval more[6];
+  bt_bootstrap(model, 200, 2, 99, 0.95, more);
+  check(suite, "More games, narrower intervals", more[3].stderr_elo < 0.6 * one[3].stderr_elo);
+  bt_destroy(model);
+}
+
+void test_speed(TestSuite* suite)
+{ printf("\n=== REFIT SPEED ===\n");
+
+  double true_elo[50];
+  for(int i = 0; i < 50; i++)
+    true_elo[i] = -400.0 + 16.0 * i;
+  BTModel* model = simulate(true_elo, 50, 100, 31);
+
+  struct timespec start;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  int cold = bt_fit(model, BT_FIT_NEWTON, BT_DEFAULT_TOLERANCE, 100);
+  double cold_ms = elapsed_ms(&start);
+
+  bt_add_games(model, 10, 20, 3, 1, 0);
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  int warm = bt_fit(model, BT_FIT_NEWTON, BT_DEFAULT_TOLERANCE, 100);
+  double warm_ms = elapsed_ms(&start);
+
+  printf("  50 agents, %u pairs: cold fit %d iterations %.2f ms, warm refit %d iterations %.2f ms\n",
+         model->num_pairs, cold, cold_ms, warm, warm_ms);
+  check(suite, "Refitting 50 agents takes milliseconds", warm > 0 && warm_ms < 100.0);
+  bt_destroy(model);
+}
+
+// Games at a true Elo difference (same draw model as simulate) until the SPRT
+// decides; returns the decision and the games it took
+static SPRTDecision run_sprt(const SPRTSpec* spec, double true_elo, Xoshiro256* rng,
+                             uint64_t* games)
+{ double p = expected_score(true_elo, 0.0), sum = 0.0, sum_sq = 0.0;
+  SPRTDecision decision = SPRT_CONTINUE;
+  uint64_t n = 0;
+  while(decision == SPRT_CONTINUE && n < 1000000)
+  { double u = (double)(nextXoshiro(rng) >> 11) * 0x1.0p-53;
+    double score = u < 0.06 ? 0.5 : (u < 0.03 + p ? 1.0 : 0.0);
+    sum += score;
+    sum_sq += score * score;
+    n++;
+    decision = sprt_decide(spec, sprt_llr(spec, n, sum, sum_sq));
+  }
+  *games = n;
+  return decision;
+}
+
+void test_sprt(TestSuite* suite)
+{ printf("\n=== SPRT ===\n");
+
+  SPRTSpec spec;
+  check(suite, "Parses ELO0,ELO1 with default errors",
+        parse_sprt_arg("0,20", &spec) && spec.elo1 == 20.0 && spec.alpha == 0.05 && spec.beta == 0.05);
+  check(suite, "Parses explicit errors",
+        parse_sprt_arg("-5,5,0.01,0.1", &spec) && spec.alpha == 0.01 && spec.beta == 0.1);
+  check(suite, "Rejects ELO0 >= ELO1", !parse_sprt_arg("10,0", &spec));
+  check(suite, "Rejects malformed specs",
+        !parse_sprt_arg("0", &spec) && !parse_sprt_arg("0,x", &spec) &&
+        !parse_sprt_arg("0,10,0.5,0.6", &spec) && !parse_sprt_arg("0,10,0.05,0.05,1", &spec));
+
+  parse_sprt_arg("0,20", &spec);
+  check(suite, "Bounds are log(beta/(1-alpha)) and log((1-beta)/alpha)",
+        fabs(sprt_lower_bound(&spec) + log(19.0)) < 1e-12 && fabs(sprt_upper_bound(&spec) - log(19.0)) < 1e-12);
+  double mid = sprt_elo_to_score(10.0);
+  check(suite, "LLR sign follows the score",
+        sprt_llr(&spec, 1000, 1000 * (mid + 0.02), 1000 * 0.3) > 0.0 &&
+        sprt_llr(&spec, 1000, 1000 * (mid - 0.02), 1000 * 0.3) < 0.0 &&
+        sprt_llr(&spec, 1000, 500.0, 500.0) < 0.0);
+  check(suite, "No LLR without variance", sprt_llr(&spec, 10, 10.0, 10.0) == 0.0);
+
+  // Error rates: with alpha = beta = 0.05, at most a few wrong calls in 100
+  Xoshiro256 rng = seedXoshiro(2024);
+  int wrong_h0 = 0, wrong_h1 = 0;
+  uint64_t games, total_h0 = 0, total_h1 = 0;
+  for(int r = 0; r < 100; r++)
+  { wrong_h0 += run_sprt(&spec, 0.0, &rng, &games) != SPRT_ACCEPT_H0;
+    total_h0 += games;
+    wrong_h1 += run_sprt(&spec, 20.0, &rng, &games) != SPRT_ACCEPT_H1;
+    total_h1 += games;
+  }
+  printf("  100 tests each: at Elo 0 %d wrong, %.0f games on average; at Elo 20 %d wrong, %.0f games\n",
+         wrong_h0, total_h0 / 100.0, wrong_h1, total_h1 / 100.0);
+  check(suite, "Error rates near alpha and beta", wrong_h0 <= 12 && wrong_h1 <= 12);
+  run_sprt(&spec, 200.0, &rng, &games);
+  check(suite, "A clear difference decides in a few hundred games", games < 500);
+}
+
+int main(void)
+{ TestSuite suite = {"Rating Tests", 0, 0};
+
+  printf("\n");
+  printf("╔════════════════════════════════════════════╗\n");
+  printf("║  ORACLE BRADLEY-TERRY RATING TEST SUITE    ║\n");
+  printf("╚════════════════════════════════════════════╝\n");
+
+  test_aggregation(&suite);
+  test_fitting(&suite);
+  test_warm_start(&suite);
+  test_bootstrap(&suite);
+  test_speed(&suite);
+  test_sprt(&suite);
+
+  printf("\n");
+  printf("╔════════════════════════════════════════════╗\n");
+  printf("║  TEST SUMMARY                              ║\n");
+  printf("╠════════════════════════════════════════════╣\n");
+  printf("║  Passed: %-3d                               ║\n", suite.passed);
+  printf("║  Failed: %-3d                               ║\n", suite.failed);
+  printf("║  Total:  %-3d                               ║\n",
+         suite.passed + suite.failed);
+  printf("╚════════════════════════════════════════════╝\n");
+
+  return suite.failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,514 @@
+// test_search.c
+// Test suite for the Monte Carlo search primitives (ai_strat/ai_strat_lib_search.c)
+// and the agents built on them (ai_strat/ai_strat_simplemc1.c, ai_strat_ismcts1.c):
+// move legality, card conservation through DoMove, information-set
+// determinization, Zobrist keys and the transposition table, and the agents'
+// budget handling and strength against the random strategy.
+
+#include "../src/actions/action.h"
+#include "../src/ai_strat/ai_strat_lib_search.h"
+#include "../src/ai_strat/ai_strat_lib_tt.h"
+#include "../src/ai_strat/ai_strat_simplemc1.h"
+#include "../src/ai_strat/ai_strat_ismcts1.h"
+#include "../src/ai_strat/ai_strat_random.h"
+#include "../src/core/card_actions.h"
+#include "../src/core/combo_bonus.h"
+#include "../src/core/game_constants.h"
+#include "../src/core/game_context.h"
+#include "../src/core/game_state.h"
+#include "../src/core/turn_logic.h"
+#include "../src/core/zobrist.h"
+#include "../src/util/arena.h"
+#include "../src/util/rnd.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+#define TEST_PASS "\033[32m✓ PASS\033[0m"
+#define TEST_FAIL "\033[31m✗ FAIL\033[0m"
+
+typedef struct
+{ const char* name;
+  int passed;
+  int failed;
+} TestSuite;
+
+void print_test_result(const char* test_name, int expected, int actual)
+{ if(expected == actual)
+  { printf("  %s: %s (expected %d, got %d)\n",
+           TEST_PASS, test_name, expected, actual);
+  }
+  else
+  { printf("  %s: %s (expected %d, got %d)\n",
+           TEST_FAIL, test_name, expected, actual);
+  }
+}
+
+static void check(TestSuite* suite, const char* name, int ok)
+{ print_test_result(name, 1, ok);
+  suite->passed += ok;
+  suite->failed += !ok;
+}
+
+// A fresh game at player A's first attack decision
+static void start_game(struct gamestate* g, GameContext* ctx)
+{ setup_game(INITIAL_CASH_DEFAULT, g, ctx);
+  g->turn = 0;
+  begin_of_turn(g, ctx);
+}
+
+// Every dealt card is in exactly one pile and 80 cards are in play
+static bool cards_conserved(const struct gamestate* g)
+{ int seen[FULL_DECK_SIZE] = {0};
+  int total = 0;
+  for(int p = 0; p < 2; p++)
+  { for(uint8_t i = 0; i < g->deck[p].size; i++, total++)
+      seen[g->deck[p].card_indices[i]]++;
+    for(uint8_t i = 0; i < g->hand[p].size; i++, total++)
+      seen[g->hand[p].cards[i]]++;
+    for(uint8_t i = 0; i < g->discard[p].size; i++, total++)
+      seen[g->discard[p].cards[i]]++;
+    for(uint8_t i = 0; i < g->combat_zone[p].size; i++, total++)
+      seen[g->combat_zone[p].cards[i]]++;
+  }
+  for(int c = 0; c < FULL_DECK_SIZE; c++)
+    if(seen[c] > 1) return false;
+  return total == 2 * MAX_DECK_STACK_SIZE;
+}
+
+static bool move_is_legal(const struct gamestate* g, const Action* a)
+{ return validate_action(g, g->player_to_move, a) == ACTION_OK;
+}
+
+void test_do_move(TestSuite* suite, GameContext* ctx)
+{ printf("\n=== MOVES AND DoMove ===\n");
+
+  ActionList moves;
+  bool legal = true, conserved = true, terminated = true, phases = true, overflow = false;
+  uint16_t max_moves = 0;
+
+  for(int game = 0; game < 50; game++)
+  { struct gamestate g;
+    start_game(&g, ctx);
+
+    int steps = 0;
+    while(!is_terminal(&g) && steps < 2 * MAX_NUMBER_OF_TURNS + 2)
+    { get_search_actions(&g, &moves);
+      uint16_t n = moves.count;
+      if(n > max_moves) max_moves = n;
+      overflow |= moves.overflow;
+      for(uint16_t i = 0; i < n; i++)
+        legal &= move_is_legal(&g, &moves.actions[i]);
+
+      PlayerID mover = g.player_to_move;
+      do_move(&g, &moves.actions[RND_randn(n > 255 ? 255 : n, ctx)], ctx);
+      conserved &= cards_conserved(&g);
+
+      // Next decision: defender answers the attack, or a new attack turn
+      if(!is_terminal(&g))
+        phases &= (g.turn_phase == DEFENSE) ? (g.player_to_move != mover)
+                  : (g.player_to_move == g.current_player);
+      steps++;
+    }
+    get_search_actions(&g, &moves);
+    terminated &= is_terminal(&g) && moves.count == 0;
+  }
+
+  check(suite, "All generated moves are legal and affordable", legal);
+  check(suite, "Cards are conserved through DoMove", conserved);
+  check(suite, "Phases and player to move advance correctly", phases);
+  check(suite, "Games reach a terminal state", terminated);
+  check(suite, "Move lists never overflow", max_moves > 1 && !overflow);
+}
+
+void test_determinization(TestSuite* suite, GameContext* ctx)
+{ printf("\n=== DETERMINIZATION ===\n");
+
+  struct gamestate g, d;
+  start_game(&g, ctx);
+  // Play a few random turns so discards are not empty
+  for(int t = 0; t < 6 && !is_terminal(&g); t++)
+  { ActionList moves;
+    get_search_actions(&g, &moves);
+    do_move(&g, &moves.actions[RND_randn(moves.count > 255 ? 255 : moves.count, ctx)], ctx);
+  }
+
+  PlayerID obs = g.player_to_move, opp = 1 - obs;
+  bool visible_kept = true, sizes_kept = true, conserved = true;
+  int opp_hand_changed = 0;
+
+  for(int i = 0; i < 200; i++)
+  { clone_gamestate(&d, &g);
+    randomize_hidden_information(&d, obs, ctx);
+
+    visible_kept &= memcmp(&d.hand[obs], &g.hand[obs], sizeof(Hand)) == 0 &&
+                    memcmp(d.discard, g.discard, sizeof(g.discard)) == 0 &&
+                    memcmp(d.combat_zone, g.combat_zone, sizeof(g.combat_zone)) == 0 &&
+                    d.current_cash_balance[opp] == g.current_cash_balance[opp];
+    sizes_kept &= d.hand[opp].size == g.hand[opp].size &&
+                  d.deck[obs].size == g.deck[obs].size &&
+                  d.deck[opp].size == g.deck[opp].size;
+    conserved &= cards_conserved(&d);
+    opp_hand_changed += memcmp(d.hand[opp].cards, g.hand[opp].cards, g.hand[opp].size) != 0;
+  }
+
+  check(suite, "Observer's visible information is untouched", visible_kept);
+  check(suite, "Pile sizes are preserved", sizes_kept);
+  check(suite, "No card is duplicated", conserved);
+  check(suite, "Opponent hand is resampled", opp_hand_changed > 190);
+
+  // Both decks reshuffled from their discard piles, then 3 cards drawn each:
+  // the decks' cards are known, the opponent's drawn ones not told apart
+  start_game(&g, ctx);
+  for(int p = 0; p < 2; p++)
+  { while(!DeckStk_isEmpty(&g.deck[p]))
+      Discard_add(&g.discard[p], DeckStk_pop(&g.deck[p]));
+    for(int i = 0; i < 3; i++)
+      draw_1_card(&g, p, ctx);
+  }
+  zobrist_refresh(&g);
+  bool own_deck_kept = true, opp_deck_known = true;
+  int opp_deck_changed = 0;
+  for(int i = 0; i < 200; i++)
+  { clone_gamestate(&d, &g);
+    randomize_hidden_information(&d, obs, ctx);
+    for(uint8_t k = 0; k < d.deck[obs].size; k++)
+      own_deck_kept &= DeckStk_contains(&g.deck[obs], d.deck[obs].card_indices[k]);
+    for(uint8_t k = 0; k < d.deck[opp].size; k++)
+    { uint8_t c = d.deck[opp].card_indices[k];
+      opp_deck_known &= CardBitset_contains(&g.reshuffled, c) &&
+                        (DeckStk_contains(&g.deck[opp], c) || Hand_contains(&g.hand[opp], c));
+    }
+    opp_deck_changed += memcmp(d.deck[opp].card_indices, g.deck[opp].card_indices,
+                               g.deck[opp].size) != 0;
+    conserved &= cards_conserved(&d);
+  }
+  check(suite, "Reshuffled own deck keeps its cards", own_deck_kept);
+  check(suite, "Reshuffled opponent deck only holds its known cards", opp_deck_known);
+  check(suite, "Reshuffled opponent deck is resampled", opp_deck_changed > 190);
+  check(suite, "No card is duplicated after reshuffles", conserved);
+}
+
+// Index of the n-th affordable champion in the attacker's hand, or -1
+static int nth_champion(const struct gamestate* g, int n)
+{ PlayerID p = g->current_player;
+  for(uint8_t i = 0; i < g->hand[p].size; i++)
+  { uint8_t c = g->hand[p].cards[i];
+    if(fullDeck[c].card_type == CHAMPION_CARD && n-- == 0) return c;
+  }
+  return -1;
+}
+
+void test_zobrist(TestSuite* suite, GameContext* ctx)
+{ printf("\n=== ZOBRIST KEYS ===\n");
+
+  // Two champions played in either order reach the same state
+  struct gamestate g, ab, ba, a_only;
+  int c1 = -1, c2 = -1;
+  for(int tries = 0; tries < 100 && c2 < 0; tries++)
+  { start_game(&g, ctx);
+    g.current_cash_balance[g.current_player] = 100;
+    c1 = nth_champion(&g, 0);
+    c2 = nth_champion(&g, 1);
+  }
+  PlayerID p = g.current_player;
+  clone_gamestate(&ab, &g);
+  play_champion(&ab, p, c1, ctx);
+  play_champion(&ab, p, c2, ctx);
+  clone_gamestate(&ba, &g);
+  play_champion(&ba, p, c2, ctx);
+  play_champion(&ba, p, c1, ctx);
+  clone_gamestate(&a_only, &g);
+  play_champion(&a_only, p, c1, ctx);
+
+  check(suite, "Move orders transpose to one key",
+        c2 >= 0 && gamestate_key(&ab) == gamestate_key(&ba) &&
+        memcmp(&ab.combat_zone[p], &ba.combat_zone[p], sizeof(CombatZone)) != 0);
+  check(suite, "Different card locations give different keys",
+        gamestate_key(&ab) != gamestate_key(&a_only) && gamestate_key(&g) != gamestate_key(&a_only));
+  ab.current_cash_balance[p]++;
+  check(suite, "Cash is part of the key", gamestate_key(&ab) != gamestate_key(&ba));
+
+  // The key the engine maintains matches the from-scratch key at every step
+  bool consistent = true;
+  int steps = 0;
+  for(int game = 0; game < 20; game++)
+  { start_game(&g, ctx);
+    consistent &= gamestate_key(&g) == zobrist_compute(&g);
+    while(!is_terminal(&g) && steps < 100000)
+    { ActionList moves;
+      moves.options = ACTIONS_ALL;
+      generate_legal_actions(&g, g.player_to_move, &moves);
+      do_move(&g, &moves.actions[RND_randn(moves.count > 255 ? 255 : moves.count, ctx)], ctx);
+      consistent &= gamestate_key(&g) == zobrist_compute(&g);
+      if(steps++ % 7 == 0)
+      { clone_gamestate(&a_only, &g);
+        randomize_hidden_information(&a_only, g.player_to_move, ctx);
+        consistent &= gamestate_key(&a_only) == zobrist_compute(&a_only);
+      }
+    }
+  }
+#ifdef GAMESTATE_ZOBRIST
+  printf("  (incremental keys, %d moves)\n", steps);
+#else
+  printf("  (keys computed on demand, %d moves)\n", steps);
+#endif
+  check(suite, "Key matches a full recomputation through random games", consistent);
+}
+
+typedef struct
+{ TranspositionTable* tt;
+  int rounds;
+} TTWorker;
+
+#define TT_TEST_KEYS 64
+
+static void* tt_worker_main(void* arg)
+{ TTWorker* w = arg;
+  for(int r = 0; r < w->rounds; r++)
+    for(uint64_t k = 0; k < TT_TEST_KEYS; k++)
+      tt_add(w->tt, k * 0x9E3779B97F4A7C15ULL, 1, (uint32_t)(k % 3));
+  return NULL;
+}
+
+void test_transposition_table(TestSuite* suite)
+{ printf("\n=== TRANSPOSITION TABLE ===\n");
+
+  check(suite, "Rejects a table smaller than a bucket", tt_create(2) == NULL);
+
+  TranspositionTable* tt = tt_create(12);
+  TTStats stats;
+  uint64_t key = 0x123456789ABCDEF0ULL;
+  check(suite, "Empty table misses", !tt_probe(tt, key, &stats));
+  tt_add(tt, key, 1, 2);
+  tt_add(tt, key, 3, 1);
+  check(suite, "Adds accumulate", tt_probe(tt, key, &stats) && stats.visits == 4 && stats.half_wins == 3);
+  check(suite, "Other tag misses", !tt_probe(tt, key ^ (1ULL << 60), &stats));
+
+  // Five keys in one bucket: the least visited entry is evicted
+  for(uint64_t i = 1; i <= TT_BUCKET_SLOTS; i++)
+    tt_add(tt, key + (i << 48), 10 * (uint32_t)i, 0);
+  bool evicted = !tt_probe(tt, key, &stats);
+  bool kept = true;
+  for(uint64_t i = 1; i <= TT_BUCKET_SLOTS; i++)
+    kept &= tt_probe(tt, key + (i << 48), &stats) && stats.visits == 10 * i;
+  check(suite, "Full bucket evicts the least visited entry", evicted && kept);
+
+  // Saturation halves both counts, keeping the mean
+  tt_add(tt, 7, TT_MAX_VISITS, TT_MAX_VISITS);
+  tt_add(tt, 7, 2, 2);
+  check(suite, "Saturated entry keeps its mean",
+        tt_probe(tt, 7, &stats) && stats.visits <= TT_MAX_VISITS &&
+        stats.visits > TT_MAX_VISITS / 2 && stats.half_wins + 2 >= stats.visits &&
+        stats.half_wins <= stats.visits + 2);
+
+  tt_clear(tt);
+  check(suite, "Clear empties the table", tt_count(tt) == 0);
+
+  // Concurrent adds to shared entries are never lost
+  enum { THREADS = 4, ROUNDS = 5000 };
+  pthread_t threads[THREADS];
+  TTWorker worker = {tt, ROUNDS};
+  for(int t = 0; t < THREADS; t++)
+    pthread_create(&threads[t], NULL, tt_worker_main, &worker);
+  for(int t = 0; t < THREADS; t++)
+    pthread_join(threads[t], NULL);
+
+  bool exact = tt_count(tt) == TT_TEST_KEYS;
+  for(uint64_t k = 0; k < TT_TEST_KEYS; k++)
+    exact &= tt_probe(tt, k * 0x9E3779B97F4A7C15ULL, &stats) &&
+             stats.visits == THREADS * ROUNDS && stats.half_wins == THREADS * ROUNDS * (k % 3);
+  check(suite, "Concurrent adds from 4 threads sum exactly", exact);
+
+  tt_destroy(tt);
+}
+
+// Games won by the given strategy against the random strategy, playing
+// `games_per_seat` games as A and as many as B
+static int wins_against_random(AttackStrategyFunc attack, DefenseStrategyFunc defense,
+                               int games_per_seat, GameContext* ctx)
+{ StrategySet strategies;
+  struct gamestate g;
+  int wins = 0;
+
+  for(PlayerID agent = PLAYER_A; agent <= PLAYER_B; agent++)
+  { set_player_strategy(&strategies, agent, attack, defense);
+    set_player_strategy(&strategies, 1 - agent, random_attack_strategy, random_defense_strategy);
+    for(int i = 0; i < games_per_seat; i++)
+    { setup_game(INITIAL_CASH_DEFAULT, &g, ctx);
+      g.turn = 0;
+      do
+        play_turn(NULL, &g, &strategies, ctx);
+      while(g.turn < MAX_NUMBER_OF_TURNS && !g.someone_has_zero_energy);
+      wins += g.someone_has_zero_energy &&
+              g.game_state == (agent == PLAYER_A ? PLAYER_A_WINS : PLAYER_B_WINS);
+    }
+  }
+  return wins;
+}
+
+void test_simplemc(TestSuite* suite, GameContext* ctx)
+{ printf("\n=== SIMPLE MC AGENT ===\n");
+
+  struct gamestate g, before;
+  start_game(&g, ctx);
+  clone_gamestate(&before, &g);
+
+  SimpleMCParams params = {400, 0};
+  SimpleMCReport report;
+  Action best;
+  bool found = simplemc_choose_move(&g, &params, ctx, &best, &report);
+
+  check(suite, "Returns a legal move", found && move_is_legal(&g, &best));
+  check(suite, "Leaves the root state untouched", memcmp(&g, &before, sizeof(g)) == 0);
+  check(suite, "Stays within the playout budget",
+        report.playouts >= report.num_moves &&
+        report.playouts <= params.playouts + 2 * report.num_moves);
+
+  SimpleMCParams timed = {100000000, 20};
+  simplemc_choose_move(&g, &timed, ctx, &best, &report);
+  check(suite, "Honors the time limit", report.elapsed_ms < 200);
+
+  int games = 20;
+  int mc_wins = wins_against_random(simplemc_attack_strategy, simplemc_defense_strategy,
+                                    games / 2, ctx);
+  printf("  SimpleMC won %d of %d games against random\n", mc_wins, games);
+  check(suite, "Beats the random strategy (>= 80%)", mc_wins * 10 >= games * 8);
+}
+
+void test_ismcts(TestSuite* suite, GameContext* ctx)
+{ printf("\n=== ISMCTS AGENT ===\n");
+
+  struct gamestate g, before;
+  start_game(&g, ctx);
+  clone_gamestate(&before, &g);
+
+  ISMCTSParams params = {500, 0, ISMCTS_DEFAULT_EXPLORATION};
+  ISMCTSReport report;
+  Action best;
+  bool found = ismcts_choose_move(&g, &params, ctx, &best, &report);
+
+  check(suite, "Returns a legal move", found && move_is_legal(&g, &best));
+  check(suite, "Leaves the root state untouched", memcmp(&g, &before, sizeof(g)) == 0);
+  check(suite, "Runs exactly the iteration budget", report.iterations == params.iterations);
+  check(suite, "Adds at most one node per iteration",
+        report.nodes >= 2 && report.nodes <= params.iterations + 1);
+  check(suite, "Reports arena usage",
+        report.arena_bytes > 0 && report.peak_arena_bytes >= report.arena_bytes);
+
+  // The arena is rewound per decision, so a smaller search reuses the memory
+  // of the larger one and leaves the peak where it was
+  size_t peak = report.peak_arena_bytes;
+  size_t reserved = ctx->arena->reserved;
+  params.iterations = 50;
+  ismcts_choose_move(&g, &params, ctx, &best, &report);
+  check(suite, "Arena is reset between decisions",
+        report.arena_bytes < peak && report.peak_arena_bytes == peak &&
+        ctx->arena->reserved == reserved);
+
+  ISMCTSParams timed = {100000000, 20, ISMCTS_DEFAULT_EXPLORATION};
+  ismcts_choose_move(&g, &timed, ctx, &best, &report);
+  check(suite, "Honors the time limit", report.elapsed_ms < 200);
+
+  int games = 20;
+  int wins = wins_against_random(ismcts_attack_strategy, ismcts_defense_strategy,
+                                 games / 2, ctx);
+  printf("  ISMCTS won %d of %d games against random\n", wins, games);
+  check(suite, "Beats the random strategy (>= 80%)", wins * 10 >= games * 8);
+}
+
+void test_parallel_ismcts(TestSuite* suite, GameContext* ctx)
+{ printf("\n=== PARALLEL ISMCTS ===\n");
+
+  struct gamestate g, before;
+  start_game(&g, ctx);
+  clone_gamestate(&before, &g);
+
+  ISMCTSParams params = {600, 0, ISMCTS_DEFAULT_EXPLORATION, 3, AI_PARALLEL_ROOT};
+  ISMCTSReport report;
+  Action best;
+  bool found = ismcts_choose_move(&g, &params, ctx, &best, &report);
+
+  check(suite, "Root parallel: returns a legal move", found && move_is_legal(&g, &best));
+  check(suite, "Root parallel: threads share the iteration budget",
+        report.threads == 3 && report.iterations == params.iterations);
+  check(suite, "Root parallel: one tree per thread",
+        report.nodes >= 3 && report.nodes <= params.iterations + 3);
+
+  // Root parallel searches are reproducible: same seed, same move
+  config_t cfg = *ctx->config;
+  GameContext* ctx1 = create_game_context(&cfg);
+  GameContext* ctx2 = create_game_context(&cfg);
+  Action best1, best2;
+  ismcts_choose_move(&g, &params, ctx1, &best1, NULL);
+  ismcts_choose_move(&g, &params, ctx2, &best2, NULL);
+  check(suite, "Root parallel: reproducible for a given seed",
+        memcmp(&best1, &best2, sizeof(Action)) == 0);
+  destroy_game_context(ctx1);
+  destroy_game_context(ctx2);
+
+  params.parallel = AI_PARALLEL_TREE;
+  found = ismcts_choose_move(&g, &params, ctx, &best, &report);
+  check(suite, "Tree parallel: returns a legal move", found && move_is_legal(&g, &best));
+  check(suite, "Tree parallel: threads share the iteration budget",
+        report.threads == 3 && report.iterations == params.iterations);
+  check(suite, "Tree parallel: one shared tree",
+        report.nodes >= 2 && report.nodes <= params.iterations + 1);
+  check(suite, "Leaves the root state untouched", memcmp(&g, &before, sizeof(g)) == 0);
+
+  config_t* saved_cfg = ctx->config;
+  cfg.ai_threads = 2;
+  cfg.ai_parallel = AI_PARALLEL_TREE;
+  ctx->config = &cfg;
+  int games = 10;
+  int wins = wins_against_random(ismcts_attack_strategy, ismcts_defense_strategy,
+                                 games / 2, ctx);
+  ctx->config = saved_cfg;
+  printf("  Tree-parallel ISMCTS (2 threads) won %d of %d games against random\n",
+         wins, games);
+  check(suite, "Tree parallel: beats the random strategy (>= 80%)", wins * 10 >= games * 8);
+}
+
+int main(void)
+{ TestSuite suite = {"Search Tests", 0, 0};
+
+  printf("\n");
+  printf("╔════════════════════════════════════════════╗\n");
+  printf("║  ORACLE MONTE CARLO SEARCH TEST SUITE      ║\n");
+  printf("╚════════════════════════════════════════════╝\n");
+
+  if(!combo_bonus_init())
+  { printf("Failed to build combo bonus tables\n");
+    return 1;
+  }
+  actions_init();
+  zobrist_init();
+
+  config_t cfg = {0};
+  cfg.prng_seed = 2024;
+  cfg.prng_backend = RND_BACKEND_XOSHIRO256;
+  cfg.ai_budget = 300;
+  GameContext* ctx = create_game_context(&cfg);
+
+  test_do_move(&suite, ctx);
+  test_determinization(&suite, ctx);
+  test_zobrist(&suite, ctx);
+  test_transposition_table(&suite);
+  test_simplemc(&suite, ctx);
+  test_ismcts(&suite, ctx);
+  test_parallel_ismcts(&suite, ctx);
+
+  destroy_game_context(ctx);
+
+  printf("\n");
+  printf("╔════════════════════════════════════════════╗\n");
+  printf("║  TEST SUMMARY                              ║\n");
+  printf("╠════════════════════════════════════════════╣\n");
+  printf("║  Passed: %-3d                               ║\n", suite.passed);
+  printf("║  Failed: %-3d                               ║\n", suite.failed);
+  printf("║  Total:  %-3d                               ║\n",
+         suite.passed + suite.failed);
+  printf("╚════════════════════════════════════════════╝\n");
+
+  return suite.failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,291 @@
+// test_tournament.c
+// Test suite for the round-robin tournament runner (roles/stda/stda_tournament.c):
+// agent list parsing, job and batch bookkeeping, results independent of the
+// thread count, the hand-off to the Bradley-Terry rating, paired deals, and
+// SPRT early stopping
+
+#include "../src/roles/stda/stda_tournament.h"
+#include "../src/core/combo_bonus.h"
+#include "../src/core/zobrist.h"
+#include "../src/actions/action.h"
+#include "../src/util/prng_seed.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+#define TEST_PASS "\033[32m✓ PASS\033[0m"
+#define TEST_FAIL "\033[31m✗ FAIL\033[0m"
+
+typedef struct
+{ const char* name;
+  int passed;
+  int failed;
+} TestSuite;
+
+void print_test_result(const char* test_name, int expected, int actual)
+{ if(expected == actual)
+  { printf("  %s: %s (expected %d, got %d)\n",
+           TEST_PASS, test_name, expected, actual);
+  }
+  else
+  { printf("  %s: %s (expected %d, got %d)\n",
+           TEST_FAIL, test_name, expected, actual);
+  }
+}
+
+static void check(TestSuite* suite, const char* name, int ok)
+{ print_test_result(name, 1, ok);
+  suite->passed += ok;
+  suite->failed += !ok;
+}
+
+void test_parsing(TestSuite* suite)
+{ printf("\n=== AGENT LIST PARSING ===\n");
+
+  TournamentSpec spec;
+  memset(&spec, 0, sizeof(spec));
+  check(suite, "Parses a list of shorthands",
+        parse_tournament_agents("rand,SimpleMC,ismcts", &spec) && spec.num_agents == 3 &&
+        spec.agents[1] == AI_STRATEGY_SIMPLE_MC && strcmp(spec.names[2], "ismcts") == 0);
+  check(suite, "Rejects an unknown agent", !parse_tournament_agents("rand,nobody", &spec));
+  check(suite, "Rejects an agent listed twice", !parse_tournament_agents("rand,simplemc,rand", &spec));
+  check(suite, "Rejects an unimplemented agent", !parse_tournament_agents("rand,ismctsnn", &spec));
+  check(suite, "Rejects a single agent", !parse_tournament_agents("rand", &spec));
+}
+
+void test_round_robin(TestSuite* suite, config_t* cfg)
+{ printf("\n=== ROUND ROBIN ===\n");
+
+  TournamentSpec spec;
+  memset(&spec, 0, sizeof(spec));
+  parse_tournament_agents("rand,simplemc,ismcts", &spec);
+  spec.games_per_job = 5;      // one full batch of 4 and one of 1 per job
+  spec.num_threads = 1;
+
+  TournamentResult* serial = malloc(sizeof(TournamentResult));
+  TournamentResult* parallel = malloc(sizeof(TournamentResult));
+  bool ok = run_tournament(&spec, cfg, serial);
+  check(suite, "Serial tournament runs", ok);
+  check(suite, "Six jobs (pairings x seat orders), 30 games", serial->num_jobs == 6 && serial->games == 30);
+
+  bool jobs_ok = true;
+  for(uint32_t k = 0; k < serial->num_jobs; k++)
+  { const TournamentJob* job = &serial->jobs[k];
+    jobs_ok &= job->games == 5 && job->agent[PLAYER_A] != job->agent[PLAYER_B] &&
+               job->seat_wins[PLAYER_A] + job->seat_wins[PLAYER_B] + job->draws == 5 &&
+               job->turn_sum >= 5;
+  }
+  check(suite, "Every job plays its games", jobs_ok);
+
+  bool matrix_ok = true;
+  for(uint32_t i = 0; i < 3; i++)
+    for(uint32_t j = 0; j < 3; j++)
+      if(i != j)
+        matrix_ok &= serial->wins[i][j] + serial->wins[j][i] + serial->draws[i][j] == 10 &&
+                     serial->draws[i][j] == serial->draws[j][i];
+  check(suite, "Each pairing has 10 games over both seats", matrix_ok);
+
+  spec.num_threads = 3;
+  ok = run_tournament(&spec, cfg, parallel);
+  check(suite, "Parallel tournament runs", ok);
+  check(suite, "Same results on 1 or 3 threads",
+        memcmp(serial->jobs, parallel->jobs, sizeof(serial->jobs)) == 0 &&
+        memcmp(serial->wins, parallel->wins, sizeof(serial->wins)) == 0);
+  printf("  30 games: %.1f ms on 1 thread, %.1f ms on 3 threads\n",
+         serial->elapsed_ms, parallel->elapsed_ms);
+
+  spec.batch_games = 1;
+  ok = run_tournament(&spec, cfg, parallel);
+  check(suite, "Batches of one game run", ok && parallel->games == 30);
+
+  present_tournament(&spec, serial, stdout);
+
+  // Rating: players are found by name, so a second tournament adds to the first
+  BTModel* model = bt_create();
+  spec.batch_games = 0;
+  ok = tournament_add_to_rating(&spec, serial, model);
+  check(suite, "Results feed the rating", ok && model->num_players == 3 && model->num_pairs == 3 &&
+        model->pairs[0].games == 10);
+  ok = tournament_add_to_rating(&spec, parallel, model);
+  check(suite, "A second tournament adds to the same players",
+        ok && model->num_players == 3 && model->games[0] == 40);
+  check(suite, "Ratings fit", bt_fit(model, BT_FIT_NEWTON, BT_DEFAULT_TOLERANCE, 100) > 0);
+  bt_print(model, NULL, stdout);
+  bt_destroy(model);
+
+  free(serial);
+  free(parallel);
+}
+
+void test_paired(TestSuite* suite, config_t* cfg)
+{ printf("\n=== PAIRED DEALS ===\n");
+
+  check(suite, "Game seeds depend on game and stream only",
+        derive_game_seed(5, 1000000, 1) == derive_game_seed(5, 1000000, 1) &&
+        derive_game_seed(5, 1000000, 1) != derive_game_seed(5, 1000001, 1) &&
+        derive_game_seed(5, 1000000, 1) != derive_game_seed(5, 1000000, 2) &&
+        derive_game_seed(5, 1000000, 1) != derive_game_seed(6, 1000000, 1));
+
+  TournamentSpec spec;
+  memset(&spec, 0, sizeof(spec));
+  parse_tournament_agents("rand,simplemc,ismcts", &spec);
+  spec.games_per_job = 6;
+  spec.paired = true;
+  spec.num_threads = 1;
+
+  TournamentResult* three = malloc(sizeof(TournamentResult));
+  TournamentResult* two = malloc(sizeof(TournamentResult));
+  bool ok = run_tournament(&spec, cfg, three);
+  check(suite, "Paired tournament runs", ok);
+  check(suite, "One job per pairing, two games per deal",
+        three->num_jobs == 3 && three->games == 36 && three->jobs[0].deals == 6);
+
+  bool sums_ok = true;
+  for(uint32_t k = 0; k < three->num_jobs; k++)
+  { const TournamentJob* job = &three->jobs[k];
+    sums_ok &= job->deal_sum == 2 * job->agent_wins[0] + job->draws &&
+               job->agent_wins[0] + job->agent_wins[1] == job->seat_wins[0] + job->seat_wins[1];
+  }
+  check(suite, "Deal sums match the game counts", sums_ok);
+
+  spec.num_threads = 3;
+  ok = run_tournament(&spec, cfg, two);
+  check(suite, "Same paired results on 1 or 3 threads",
+        ok && memcmp(three->jobs, two->jobs, sizeof(three->jobs)) == 0);
+
+  // Deals are keyed by deal index alone: the same pairing in a smaller
+  // tournament replays the same games
+  parse_tournament_agents("rand,simplemc", &spec);
+  spec.num_threads = 1;
+  ok = run_tournament(&spec, cfg, two);
+  check(suite, "Every pairing gets the same deals",
+        ok && memcmp(&three->jobs[0], &two->jobs[0], sizeof(TournamentJob)) == 0);
+
+  TournamentPairedEstimate est;
+  ok = tournament_paired_estimate(&three->jobs[0], &est);
+  printf("  %s vs %s: %+.1f%% +/- %.1f (unpaired +/- %.1f)\n", spec.names[0], spec.names[1],
+         100.0 * est.difference, 100.0 * est.paired_stderr, 100.0 * est.unpaired_stderr);
+  check(suite, "Paired estimate", ok && fabs(est.difference - (2.0 * est.score - 1.0)) < 1e-12 &&
+        est.paired_stderr >= 0.0 && est.unpaired_stderr > 0.0);
+
+  // A job where the first agent scores 1, 1/2, 1/2 on three deals
+  TournamentJob job;
+  memset(&job, 0, sizeof(job));
+  job.games = 6;
+  job.deals = 3;
+  job.agent_wins[0] = 4;
+  job.agent_wins[1] = 2;
+  job.deal_sum = 4 + 2 + 2;
+  job.deal_sq_sum = 16 + 4 + 4;
+  tournament_paired_estimate(&job, &est);
+  // Deal scores 1, 0.5, 0.5: variance 1/12, stderr of the mean 1/6, doubled
+  check(suite, "Paired standard error by hand",
+        fabs(est.score - 2.0 / 3.0) < 1e-12 && fabs(est.paired_stderr - 1.0 / 3.0) < 1e-12);
+
+  free(three);
+  free(two);
+}
+
+void test_sprt_stop(TestSuite* suite, config_t* cfg)
+{ printf("\n=== SPRT EARLY STOP ===\n");
+
+  TournamentSpec spec;
+  memset(&spec, 0, sizeof(spec));
+  parse_tournament_agents("rand,simplemc", &spec);
+  spec.games_per_job = 200;
+  spec.num_threads = 1;
+  spec.use_sprt = parse_sprt_arg("0,50", &spec.sprt);
+
+  TournamentResult* serial = malloc(sizeof(TournamentResult));
+  TournamentResult* parallel = malloc(sizeof(TournamentResult));
+  bool ok = run_tournament(&spec, cfg, serial);
+  check(suite, "SPRT match runs", ok);
+  check(suite, "A lopsided match stops early",
+        serial->sprt_decision != SPRT_CONTINUE && serial->games < serial->planned_games);
+  check(suite, "The stop is at a committed batch",
+        serial->games % TOURNAMENT_BATCH_GAMES == 0 &&
+        serial->jobs[0].games + serial->jobs[1].games == serial->games);
+  check(suite, "The trajectory ends at the decision",
+        serial->num_trajectory > 0 &&
+        serial->trajectory[serial->num_trajectory - 1].games == serial->games &&
+        sprt_decide(&spec.sprt, serial->trajectory[serial->num_trajectory - 1].llr) ==
+          serial->sprt_decision);
+
+  spec.num_threads = 3;
+  ok = run_tournament(&spec, cfg, parallel);
+  check(suite, "Same stop on 1 or 3 threads",
+        ok && parallel->games == serial->games && parallel->llr == serial->llr &&
+        memcmp(serial->jobs, parallel->jobs, sizeof(serial->jobs)) == 0);
+  present_tournament(&spec, parallel, stdout);
+
+  spec.paired = true;
+  spec.games_per_job = 100;
+  ok = run_tournament(&spec, cfg, parallel);
+  check(suite, "Paired SPRT match stops early",
+        ok && parallel->sprt_decision != SPRT_CONTINUE && parallel->games < parallel->planned_games);
+
+  // Undecided after 1026 one-game batches: the trajectory is full at batch
+  // 1024 and the last point is off the stride
+  // (a mirror match, as tournament_spec_from_config() builds for -P rand,rand)
+  parse_tournament_agents("rand,simplemc", &spec);
+  spec.agents[1] = spec.agents[0];
+  snprintf(spec.names[1], BT_NAME_LEN, "rand #2");
+  spec.paired = false;
+  spec.games_per_job = 513;
+  spec.batch_games = 1;
+  spec.use_sprt = parse_sprt_arg("-1,1,1e-12,1e-12", &spec.sprt);
+  ok = run_tournament(&spec, cfg, parallel);
+  bool increasing = true;
+  for(uint32_t i = 1; i < parallel->num_trajectory && i < TOURNAMENT_TRAJECTORY_POINTS; i++)
+    increasing &= parallel->trajectory[i].games > parallel->trajectory[i - 1].games;
+  check(suite, "A full trajectory takes the last point",
+        ok && parallel->sprt_decision == SPRT_CONTINUE && parallel->games == 1026 &&
+        parallel->num_trajectory <= TOURNAMENT_TRAJECTORY_POINTS && increasing &&
+        parallel->trajectory[parallel->num_trajectory - 1].games == 1026);
+  spec.batch_games = 0;
+
+  parse_tournament_agents("rand,simplemc,ismcts", &spec);
+  check(suite, "SPRT refuses more than 2 agents", !run_tournament(&spec, cfg, parallel));
+
+  free(serial);
+  free(parallel);
+}
+
+int main(void)
+{ TestSuite suite = {"Tournament Tests", 0, 0};
+
+  printf("\n");
+  printf("╔════════════════════════════════════════════╗\n");
+  printf("║  ORACLE TOURNAMENT TEST SUITE              ║\n");
+  printf("╚════════════════════════════════════════════╝\n");
+
+  if(!combo_bonus_init())
+  { printf("Failed to build combo bonus tables\n");
+    return 1;
+  }
+  actions_init();
+  zobrist_init();
+
+  config_t cfg = {0};
+  cfg.prng_seed = 77;
+  cfg.prng_backend = RND_BACKEND_XOSHIRO256;
+  cfg.ai_budget = 8;
+
+  test_parsing(&suite);
+  test_round_robin(&suite, &cfg);
+  test_paired(&suite, &cfg);
+  test_sprt_stop(&suite, &cfg);
+
+  printf("\n");
+  printf("╔════════════════════════════════════════════╗\n");
+  printf("║  TEST SUMMARY                              ║\n");
+  printf("╠════════════════════════════════════════════╣\n");
+  printf("║  Passed: %-3d                               ║\n", suite.passed);
+  printf("║  Failed: %-3d                               ║\n", suite.failed);
+  printf("║  Total:  %-3d                               ║\n",
+         suite.passed + suite.failed);
+  printf("╚════════════════════════════════════════════╝\n");
+
+  return suite.failed > 0 ? 1 : 0;
+}
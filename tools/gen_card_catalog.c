@@ -0,0 +1,197 @@
+// gen_card_catalog.c
+// Generator of src/core/card_catalog.c (see card_catalog.h) from
+// fullDeck's base fields: type, cost, dice, attack base, draw_num and
+// exchange_cash, and combo_bonus.c for the pair synergies.
+//
+// Before writing, fullDeck's hand-coded float fields (expected_attack,
+// expected_defense, the efficiencies and power) are checked against the
+// derived values. A literal off by more than its 2-decimal rounding is
+// reported and nothing is written (exit status 1).
+//
+// usage: gen_card_catalog <output.c>
+
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../src/core/card_catalog.h"
+#include "../src/core/combo_bonus.h"
+
+// A free card's cost in the per-cost metrics
+#define FREE_CARD_COST 0.25
+
+// fullDeck's literals are written to 2 decimals
+#define LITERAL_TOLERANCE (0.005 + 1e-6)
+
+typedef struct
+{ double attack_mean, defense_mean, dice_var;
+  double attack_per_cost, defense_per_cost, power;
+  double attack_pmf[CARD_PMF_SIZE], defense_pmf[CARD_PMF_SIZE];
+} CardStats;
+
+static CardStats stats[FULL_DECK_SIZE];
+static uint8_t synergy[2][CARD_CATALOG_CHAMPIONS][CARD_CATALOG_CHAMPIONS];
+
+static int derive(void)
+{ int errors = 0;
+  for(int i = 0; i < FULL_DECK_SIZE; i++)
+  { const struct card* c = &fullDeck[i];
+    CardStats* s = &stats[i];
+    if((c->card_type == CHAMPION_CARD) != (i < CARD_CATALOG_CHAMPIONS))
+    { fprintf(stderr, "fullDeck[%d]: champions must come first, %d of them\n", i,
+              CARD_CATALOG_CHAMPIONS);
+      errors++;
+      continue;
+    }
+    if(c->card_type == DRAW_CARD)
+      s->power = c->draw_num;
+    else if(c->card_type == CASH_CARD)
+      s->power = c->exchange_cash / 2.0;
+    if(c->card_type != CHAMPION_CARD) continue;
+
+    int n = c->defense_dice;
+    if(n == 0 || c->attack_base + n >= CARD_PMF_SIZE)
+    { fprintf(stderr, "fullDeck[%d]: D%d + %d out of range\n", i, n, c->attack_base);
+      errors++;
+      continue;
+    }
+    double cost = c->cost > 0 ? c->cost : FREE_CARD_COST;
+    s->defense_mean = (n + 1) / 2.0;
+    s->attack_mean = c->attack_base + s->defense_mean;
+    s->dice_var = (n * n - 1) / 12.0;
+    s->attack_per_cost = s->attack_mean / cost;
+    s->defense_per_cost = s->defense_mean / cost;
+    s->power = (s->attack_per_cost + s->defense_per_cost) / 2.0;
+    for(int r = 1; r <= n; r++)
+    { s->attack_pmf[c->attack_base + r] = 1.0 / n;
+      s->defense_pmf[r] = 1.0 / n;
+    }
+  }
+
+  for(int rules = 0; rules < 2; rules++)
+    for(int i = 0; i < CARD_CATALOG_CHAMPIONS; i++)
+      for(int j = 0; j < CARD_CATALOG_CHAMPIONS; j++)
+      { uint8_t pair[2] = {i, j};
+        synergy[rules][i][j] =
+          combo_bonus_lookup(pair, 2, rules == 0 ? DECK_RANDOM : DECK_MONOCHROME);
+      }
+  return errors;
+} // derive
+
+static int check_literal(int card, const char* field, float literal, double derived,
+                         int* rounded)
+{ double diff = fabs(literal - derived);
+  if(diff > LITERAL_TOLERANCE)
+  { fprintf(stderr, "fullDeck[%d].%s = %g, derived %.6g\n", card, field, literal, derived);
+    return 1;
+  }
+  *rounded += diff > 1e-6;
+  return 0;
+}
+
+static int check_literals(void)
+{ int errors = 0, rounded = 0;
+  for(int i = 0; i < FULL_DECK_SIZE; i++)
+  { const struct card* c = &fullDeck[i];
+    const CardStats* s = &stats[i];
+    errors += check_literal(i, "expected_attack", c->expected_attack, s->attack_mean, &rounded);
+    errors += check_literal(i, "expected_defense", c->expected_defense, s->defense_mean, &rounded);
+    errors += check_literal(i, "attack_efficiency", c->attack_efficiency, s->attack_per_cost,
+                            &rounded);
+    errors += check_literal(i, "defense_efficiency", c->defense_efficiency, s->defense_per_cost,
+                            &rounded);
+    errors += check_literal(i, "power", c->power, s->power, &rounded);
+  }
+  if(errors > 0)
+    fprintf(stderr, "gen_card_catalog: %d fullDeck literals inconsistent with the card fields\n",
+            errors);
+  else
+    fprintf(stderr, "gen_card_catalog: fullDeck literals consistent (%d rounded to 2 decimals)\n",
+            rounded);
+  return errors;
+}
+
+// A float literal: %.9g round-trips a float, plus a decimal point for C
+static void put_float(FILE* out, double v)
+{ char buf[32];
+  snprintf(buf, sizeof(buf), "%.9g", (float)v);
+  fprintf(out, "%s%sf", buf, strpbrk(buf, ".e") ? "" : ".0");
+}
+
+static void write_floats(FILE* out, const char* name, size_t offset)
+{ fprintf(out, "\nconst float %s[FULL_DECK_SIZE] =\n{", name);
+  for(int i = 0; i < FULL_DECK_SIZE; i++)
+  { double v = *(const double*)((const char*)&stats[i] + offset);
+    fprintf(out, "%s", i % 8 == 0 ? (i == 0 ? " " : "\n  ") : " ");
+    put_float(out, v);
+    fprintf(out, "%s", i + 1 < FULL_DECK_SIZE ? "," : "");
+  }
+  fprintf(out, "\n};\n");
+}
+
+static void write_pmf(FILE* out, const char* name, size_t offset)
+{ fprintf(out, "\nconst float %s[FULL_DECK_SIZE][CARD_PMF_SIZE] =\n{", name);
+  for(int i = 0; i < FULL_DECK_SIZE; i++)
+  { const double* pmf = (const double*)((const char*)&stats[i] + offset);
+    fprintf(out, "%s{", i == 0 ? " " : "\n  ");
+    for(int x = 0; x < CARD_PMF_SIZE; x++)
+    { put_float(out, pmf[x]);
+      fprintf(out, "%s", x + 1 < CARD_PMF_SIZE ? ", " : "");
+    }
+    fprintf(out, "}%s", i + 1 < FULL_DECK_SIZE ? "," : "");
+  }
+  fprintf(out, "\n};\n");
+}
+
+static void write_synergy(FILE* out)
+{ fprintf(out, "\nconst uint8_t card_pair_synergy[2][CARD_CATALOG_CHAMPIONS][CARD_CATALOG_CHAMPIONS] =\n{");
+  for(int rules = 0; rules < 2; rules++)
+  { fprintf(out, "%s{ // %s\n", rules == 0 ? " " : ",\n  ", rules == 0 ? "random" : "prebuilt");
+    for(int i = 0; i < CARD_CATALOG_CHAMPIONS; i++)
+    { fprintf(out, "    {");
+      for(int j = 0; j < CARD_CATALOG_CHAMPIONS; j++)
+        fprintf(out, "%s%d%s", j > 0 && j % 34 == 0 ? "\n     " : "", synergy[rules][i][j],
+                j + 1 < CARD_CATALOG_CHAMPIONS ? "," : "");
+      fprintf(out, "}%s\n", i + 1 < CARD_CATALOG_CHAMPIONS ? "," : "");
+    }
+    fprintf(out, "  }");
+  }
+  fprintf(out, "\n};\n");
+}
+
+int main(int argc, char** argv)
+{ if(argc != 2)
+  { fprintf(stderr, "usage: %s <output.c>\n", argv[0]);
+    return 2;
+  }
+  if(!combo_bonus_init() || derive() > 0 || check_literals() > 0)
+    return 1;
+
+  // Written aside and renamed, so a failed run leaves the old catalog
+  char tmp[4096];
+  snprintf(tmp, sizeof(tmp), "%s.tmp", argv[1]);
+  FILE* out = fopen(tmp, "w");
+  if(out == NULL)
+  { perror(tmp);
+    return 1;
+  }
+  fprintf(out, "// card_catalog.c\n"
+               "// GENERATED by tools/gen_card_catalog.c from fullDeck -- do not edit\n\n"
+               "#include \"card_catalog.h\"\n");
+  write_floats(out, "card_attack_mean", offsetof(CardStats, attack_mean));
+  write_floats(out, "card_defense_mean", offsetof(CardStats, defense_mean));
+  write_floats(out, "card_dice_var", offsetof(CardStats, dice_var));
+  write_floats(out, "card_attack_per_cost", offsetof(CardStats, attack_per_cost));
+  write_floats(out, "card_defense_per_cost", offsetof(CardStats, defense_per_cost));
+  write_floats(out, "card_power", offsetof(CardStats, power));
+  write_pmf(out, "card_attack_pmf", offsetof(CardStats, attack_pmf));
+  write_pmf(out, "card_defense_pmf", offsetof(CardStats, defense_pmf));
+  write_synergy(out);
+  if(fclose(out) != 0 || rename(tmp, argv[1]) != 0)
+  { perror(argv[1]);
+    return 1;
+  }
+  return 0;
+} // main